@@ -1,27 +1,33 @@
 #include "rndr/context.h"
 #include "rndr/math/ops.h"
+#include "rndr/memory/readback_queue.h"
+#include "rndr/profiling/gpu_profiler.h"
+#include "rndr/profiling/trace.h"
+#include "rndr/render/depth_target.h"
+#include "rndr/render/dynamic_resolution.h"
+#include "rndr/render/render_thread.h"
 #include "rndr/utils/helpers.h"
 #include <cassert>
+#include <chrono>
+#include <cmath>
 #include <iostream>
-#include <sstream>
+#include <numbers>
+#include <string_view>
+#include <thread>
 
 constexpr int w = 640;
 constexpr int h = 480;
 
 ustd::result  performBufferCopies(rndr::Context &program_gpu)
 {
-  const wgpu::Device &device = program_gpu.getDevice();
-
   /* buffer write test */
   wgpu::BufferDescriptor buffer_desc;
   buffer_desc.label = "Some GPU-side data buffer";
   buffer_desc.usage = wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::CopySrc;
   buffer_desc.size  = 16 * sizeof(float);
   buffer_desc.mappedAtCreation = false;
-  wgpu::Buffer buffer1         = device.CreateBuffer(&buffer_desc);
-
-  buffer_desc.usage = wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::MapRead;
-  wgpu::Buffer       buffer2 = device.CreateBuffer(&buffer_desc);
+  rndr::TrackedBuffer buffer1
+      = program_gpu.createBuffer(buffer_desc, rndr::MemoryCategory::Other);
 
   std::vector<float> nums(16), nums_out(16);
   std::fill(nums.begin(), nums.end(), 5.2f);
@@ -30,74 +36,65 @@ ustd::result  performBufferCopies(rndr::Context &program_gpu)
   program_gpu.getQueue().WriteBuffer(buffer1, 0, nums.data(),
                                      nums.size() * sizeof(float));
 
-  wgpu::CommandEncoderDescriptor enc_desc{};
-  wgpu::CommandEncoder           enc = device.CreateCommandEncoder(&enc_desc);
-  enc.CopyBufferToBuffer(buffer1, 0, buffer2, 0, 16 * sizeof(float));
-  wgpu::CommandBufferDescriptor buf_desc{};
-  wgpu::CommandBuffer           temp_cbuf = enc.Finish(&buf_desc);
-  program_gpu.getQueue().Submit(1, &temp_cbuf);
-  auto copy_future = program_gpu.getSubmittedWorkFuture();
-  program_gpu.processEvents();
-  program_gpu.blockOnFuture(copy_future);
-
-  /* buffer 2 map operation */
-  struct Context {
-    std::vector<float> &out;
-    wgpu::Buffer        buffer;
-  };
-  Context ctx{nums_out, buffer2};
-
-  auto    cbk = [&](wgpu::MapAsyncStatus status, const char *message) {
-    float *range = (float *)buffer2.GetConstMappedRange(0, 16 * sizeof(float));
-    std::copy(range, range + 16, nums_out.begin());
-    bool equal = std::equal(range, range + nums.size(), nums.begin());
-    std::cout << "BUFFER2 COPY SUCCESS?:" << equal << std::endl;
-    buffer2.Unmap();
-  };
-
-  buffer2.MapAsync(wgpu::MapMode::Read, 0, 16 * sizeof(float),
-                   wgpu::CallbackMode::AllowProcessEvents, cbk);
+  /* read it back through a pooled, mapped staging chunk */
+  rndr::ReadbackQueue readbacks(program_gpu);
+  ustd::result        read_result = readbacks.read(
+      buffer1, 0, 16 * sizeof(float),
+      [&](ustd::result status, rndr::ReadbackQueue::Mapping mapping) {
+        if (!status) {
+          std::cerr << status << std::endl;
+          return;
+        }
+
+        auto range = mapping.as<float>();
+        std::copy(range.begin(), range.end(), nums_out.begin());
+        bool equal = std::equal(range.begin(), range.end(), nums.begin());
+        std::cout << "BUFFER2 COPY SUCCESS?:" << equal << std::endl;
+      });
+  if (!read_result) {
+    return read_result;
+  }
 
-  program_gpu.processEvents();
-  auto map_future = program_gpu.getSubmittedWorkFuture();
-  program_gpu.blockOnFuture(map_future);
+  if (auto submit_result = readbacks.submit(); !submit_result) {
+    return submit_result;
+  }
+  readbacks.wait();
 
-  buffer1.Destroy();
-  buffer2.Destroy();
+  /* no need to wait for the copy, it is destroyed once the GPU is done */
+  program_gpu.destroyLater(std::move(buffer1));
 
   return {};
 }
 
-ustd::result renderFrame(rndr::Context &program_gpu)
+/* draws the state of simulation tick `tick`, at 120 ticks a second */
+ustd::result renderFrame(rndr::Context           &program_gpu,
+                         rndr::GpuProfiler       &profiler,
+                         rndr::DepthTarget       &depth,
+                         rndr::DynamicResolution &resolution,
+                         uint64_t                 tick)
 {
+  RNDR_TRACE_ZONE("renderFrame");
 
-  const wgpu::Device  &device   = program_gpu.getDevice();
+  const wgpu::Device  &device = program_gpu.getDevice();
 
-  wgpu::RenderPipeline pipeline = rndr::createRenderPipeline(program_gpu);
+  wgpu::RenderPipeline pipeline
+      = rndr::createRenderPipeline(program_gpu, depth.getFormat());
 
   /* check async ops */
   program_gpu.processEvents();
 
-  /* get current texture to write to */
-  auto surface_optional = program_gpu.getSurface();
-  if (!surface_optional) {
-    return ustd::unexpected(surface_optional.message());
+  /* get current texture to write to, after the frame latency limit */
+  auto frame = program_gpu.acquireFrame();
+  if (!frame) {
+    return ustd::unexpected(frame.message());
   }
 
-  const wgpu::Surface &surface = *surface_optional;
-
-  wgpu::SurfaceTexture surface_tex;
-  surface.GetCurrentTexture(&surface_tex);
-
-  if (surface_tex.status != wgpu::SurfaceGetCurrentTextureStatus::Success) {
-    std::ostringstream oss;
-    oss << "Surface did not provide next texture. "
-           "SurfaceGetCurrentTextureStatus:"
-        << static_cast<uint32_t>(surface_tex.status);
-    return ustd::unexpected(oss.str());
+  /* nothing to draw into, e.g. while minimized */
+  if (!*frame) {
+    return {};
   }
 
-  wgpu::Texture               next_tex_src = surface_tex.texture;
+  wgpu::Texture               next_tex_src = *frame;
   wgpu::TextureViewDescriptor next_tex_descriptor;
 
   next_tex_descriptor.format = next_tex_src.GetFormat();
@@ -110,27 +107,40 @@ ustd::result renderFrame(rndr::Context &program_gpu)
     return ustd::unexpected("Cannot acquire next swap chain texture");
   }
 
+  /* the scene renders at a fraction of the surface, then is upscaled */
+  resolution.fit(next_tex_src);
+  depth.fit(resolution.getTexture());
+
+  profiler.beginFrame();
+
   /* create the command encoder */
   wgpu::CommandEncoderDescriptor encoder_desc = {};
   encoder_desc.nextInChain                    = nullptr;
   encoder_desc.label                          = "Default Command Encoder";
   wgpu::CommandEncoder encoder = device.CreateCommandEncoder(&encoder_desc);
 
+  /* the background pulses once every two seconds of simulation */
+  double pulse = 0.25 * (1.0 - std::cos(static_cast<double>(tick % 240)
+                                        * std::numbers::pi / 120.0));
+
   /* describe render pass color attachment */
   wgpu::RenderPassColorAttachment color_attachment = {};
   color_attachment.nextInChain                     = nullptr;
-  color_attachment.view                            = next_tex;
+  color_attachment.view                            = resolution.getView();
   color_attachment.loadOp                          = wgpu::LoadOp::Clear;
   color_attachment.storeOp                         = wgpu::StoreOp::Store;
-  color_attachment.clearValue                      = {0, 0, 0, 1};
+  color_attachment.clearValue                      = {0, 0, pulse, 1};
+
+  /* describe render pass depth attachment */
+  wgpu::RenderPassDepthStencilAttachment depth_attachment = depth.attachment();
 
   /* describe render pass */
   wgpu::RenderPassDescriptor pass_desc = {};
   pass_desc.label                      = "Default Render Pass Encoder";
   pass_desc.colorAttachmentCount       = 1;
   pass_desc.colorAttachments           = &color_attachment;
-  pass_desc.timestampWrites            = nullptr;
-  pass_desc.depthStencilAttachment     = nullptr;
+  pass_desc.timestampWrites            = profiler.renderPass("main");
+  pass_desc.depthStencilAttachment     = &depth_attachment;
 
   /* create render pass encoder */
   wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&pass_desc);
@@ -142,6 +152,10 @@ ustd::result renderFrame(rndr::Context &program_gpu)
   /* finish encoding render pass */
   pass.End();
 
+  resolution.upscale(encoder, next_tex, profiler.renderPass("upscale"));
+
+  profiler.resolve(encoder);
+
   /* describe the command buffer */
   wgpu::CommandBufferDescriptor command_buffer_desc = {};
   command_buffer_desc.nextInChain                   = nullptr;
@@ -150,46 +164,167 @@ ustd::result renderFrame(rndr::Context &program_gpu)
   /* encode the command buffer, push to queue */
   wgpu::CommandBuffer command_buffer = encoder.Finish(&command_buffer_desc);
   program_gpu.getQueue().Submit(1, &command_buffer);
+  profiler.endFrame();
+  program_gpu.getMemoryTracker().endFrame();
 
-  wgpu::Future work_future = program_gpu.getSubmittedWorkFuture();
-  /* program_gpu.blockOnFuture(work_future); */
+  /* timings lag a few frames, which the controller's interval absorbs */
+  resolution.addFrame(
+      profiler.getLatest("main") + profiler.getLatest("upscale"),
+      profiler.getLatest(rndr::GpuProfiler::cpu_fallback_name));
 
   /* finally, present the next texture */
-  surface.Present();
+  program_gpu.present();
 
   return {};
 }
 
-int main()
+/* what the application thread hands the render thread each tick */
+struct FrameDescription {
+  uint64_t tick = 0;
+};
+
+int main(int argc, char **argv)
 {
   rndr::Context program_gpu;
-  ustd::result  init_result = program_gpu.initialize();
+
+  /* low latency where the surface allows it, never more than a frame ahead */
+  program_gpu.setPresentConfig(
+      {.present_modes     = {wgpu::PresentMode::Mailbox,
+                             wgpu::PresentMode::Immediate,
+                             wgpu::PresentMode::Fifo},
+       .max_frame_latency = 1});
+
+  ustd::result init_result = program_gpu.beginInitialize();
+
+  /* anything not needing the device, e.g. asset loading, can overlap here */
+
+  if (init_result) {
+    init_result = program_gpu.finishInitialize();
+  }
 
   if (!init_result.ok()) {
     std::cerr << "Initialization failed for reason: " << init_result;
     return 1;
   }
 
+  const auto &timings = program_gpu.getInitTimings();
+  std::cout << "Initialized in " << timings.total_ms << "ms (window "
+            << timings.window_ms << "ms, adapter " << timings.adapter_ms
+            << "ms, device " << timings.device_ms << "ms, waited "
+            << timings.device_wait_ms << "ms)" << std::endl;
+
   ustd::result buffer_copy_result = performBufferCopies(program_gpu);
   if (!buffer_copy_result) {
     std::cerr << buffer_copy_result << std::endl;
     return 1;
   }
 
-  ustd::result render_result
+  rndr::GpuProfiler profiler(program_gpu);
+  ustd::result      profiler_result = profiler.initialize();
+  if (!profiler_result) {
+    std::cerr << profiler_result << std::endl;
+    return 1;
+  }
+
+  rndr::DepthTarget depth(program_gpu);
+
+  /* the scene pipeline draws in the surface format, see
+   * `createRenderPipeline()` */
+  rndr::ResourceCache             cache(program_gpu);
+  rndr::DynamicResolution::Config resolution_config = {};
+  resolution_config.color_format  = program_gpu.getSurfaceFormat();
+  resolution_config.output_format = program_gpu.getSurfaceFormat();
+  resolution_config.filter        = rndr::DynamicResolution::Filter::Sharpen;
+
+  rndr::DynamicResolution resolution(program_gpu, cache, resolution_config);
+  ustd::result            resolution_result = resolution.initialize();
+  if (!resolution_result) {
+    std::cerr << resolution_result << std::endl;
+    return 1;
+  }
+
+  ustd::result      render_result
       = ustd::unexpected("Did not complete first frame.");
 
-  do {
-    if (glfwWindowShouldClose(program_gpu.getWindow())) {
-      render_result = {};
-      break;
+  /* `--render-thread` encodes, submits and presents on a thread of its own */
+  bool threaded = argc > 1 && std::string_view(argv[1]) == "--render-thread";
+
+  if (threaded) {
+    rndr::RenderThread<FrameDescription> renderer(
+        [&](const FrameDescription &frame) {
+          return renderFrame(program_gpu, profiler, depth, resolution,
+                             frame.tick);
+        });
+    renderer.start();
+
+    /* the simulation ticks at a fixed rate, whatever the renderer does */
+    constexpr auto tick_length = std::chrono::microseconds(1000000 / 120);
+    auto           next_tick   = std::chrono::steady_clock::now();
+    uint64_t       tick        = 0;
+
+    while (!glfwWindowShouldClose(program_gpu.getWindow())
+           && renderer.isRunning()) {
+      glfwPollEvents();
+
+      renderer.beginFrame().tick = tick++;
+      renderer.submit();
+
+      next_tick += tick_length;
+      std::this_thread::sleep_until(next_tick);
     }
-    // Check whether the user clicked on the close button (and any other
-    // mouse/key event, which we don't use so far)
-    glfwPollEvents();
 
-    render_result = renderFrame(program_gpu);
-  } while (render_result);
+    renderer.stop();
+    render_result = renderer.getResult();
+
+    auto stats    = renderer.getStats();
+    std::cout << "Render thread: " << stats.rendered << " of "
+              << stats.submitted << " ticks drawn, avg " << stats.avg_ms
+              << "ms per frame" << std::endl;
+  }
+  else {
+    uint64_t tick = 0;
+    do {
+      if (glfwWindowShouldClose(program_gpu.getWindow())) {
+        render_result = {};
+        break;
+      }
+      // Check whether the user clicked on the close button (and any other
+      // mouse/key event, which we don't use so far)
+      glfwPollEvents();
+
+      render_result
+          = renderFrame(program_gpu, profiler, depth, resolution, tick++);
+    } while (render_result);
+  }
+
+  for (const auto &pass : profiler.getStats()) {
+    std::cout << pass.name << ": min " << pass.min_ms << "ms, avg "
+              << pass.avg_ms << "ms, p99 " << pass.p99_ms << "ms" << std::endl;
+  }
+
+  const auto &present = program_gpu.getPresentStats();
+  std::cout << "Acquire to present: avg " << present.avg_ms << "ms, max "
+            << present.max_ms << "ms over " << present.frames << " frames, "
+            << present.reconfigures << " surface reconfigures" << std::endl;
+
+  std::cout << "Render scale: " << resolution.getScale() << " after "
+            << resolution.getController().getAdjustments() << " adjustments"
+            << std::endl;
+
+  auto memory = program_gpu.getMemoryTracker().snapshot();
+  for (size_t i = 0; i < rndr::MemoryTracker::category_count; ++i) {
+    if (memory.peak[i] > 0) {
+      std::cout << rndr::toString(static_cast<rndr::MemoryCategory>(i))
+                << " memory: peak " << memory.peak[i] << " bytes" << std::endl;
+    }
+  }
+
+#ifdef RNDR_ENABLE_TRACING
+  if (auto trace_result = rndr::trace::writeChromeTrace("rndr_trace.json");
+      !trace_result) {
+    std::cerr << trace_result << std::endl;
+  }
+#endif
 
   auto &stream = render_result ? std::cout : std::cerr;
   std::cout << render_result << std::endl;
@@ -0,0 +1,304 @@
+/**
+ * @file asset_manager.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "asset_manager.h"
+#include "rndr/profiling/trace.h"
+#include "rndr/utils/obj_parser.h"
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+
+namespace rndr {
+
+static uint64_t mesh_bytes(const RenderableMesh &mesh)
+{
+  return mesh.getVertexCount() * sizeof(math::vec3)
+         + mesh.getIndexCount() * sizeof(uint32_t);
+}
+
+AssetManager::AssetManager(Context         &context,
+                           JobSystem       &jobs,
+                           BufferAllocator &allocator,
+                           UploadRing      &uploads)
+    : AssetManager(context, jobs, allocator, uploads, Config{})
+{
+}
+
+AssetManager::AssetManager(Context         &context,
+                           JobSystem       &jobs,
+                           BufferAllocator &allocator,
+                           UploadRing      &uploads,
+                           Config           config)
+    : GlobalAccess(context), allocator_(allocator), uploads_(uploads),
+      config_(config), assets_(jobs)
+{
+  callback_id_ = context.addEventCallback([this] { update(); });
+}
+
+AssetManager::~AssetManager()
+{
+  getContext().removeEventCallback(callback_id_);
+}
+
+MeshHandle AssetManager::loadMesh(const std::filesystem::path &path)
+{
+  auto [handle, created] = assets_.load(path, [path] {
+    RNDR_TRACE_ZONE("AssetManager::parse");
+
+    Parsed parsed;
+    if (auto mesh_data = parseObjFile(path)) {
+      parsed.mesh = std::make_unique<RenderableMesh>(*mesh_data);
+    }
+    else {
+      parsed.error = "Failed to parse " + path.string();
+    }
+    return parsed;
+  });
+
+  Slot &slot     = *assets_.get(handle);
+  slot.last_used = updates_;
+  if (created) {
+    slot.state = State::Loading;
+  }
+  else {
+    ++stats_.dedup_hits;
+  }
+
+  return handle;
+}
+
+void AssetManager::acquire(MeshHandle handle)
+{
+  assets_.acquire(handle);
+}
+
+void AssetManager::release(MeshHandle handle)
+{
+  /* a failed load caches nothing worth keeping */
+  if (assets_.release(handle)
+      && assets_.get(handle)->state == State::Failed) {
+    destroySlot(handle.id);
+  }
+}
+
+AssetManager::State AssetManager::getState(MeshHandle handle) const
+{
+  const Slot *slot = assets_.get(handle);
+  return slot != nullptr ? slot->state : State::Invalid;
+}
+
+bool AssetManager::isReady(MeshHandle handle) const
+{
+  return getState(handle) == State::Ready;
+}
+
+const std::string &AssetManager::getError(MeshHandle handle) const
+{
+  static const std::string none;
+  const Slot              *slot = assets_.get(handle);
+  return slot != nullptr ? slot->error : none;
+}
+
+const RenderableMesh *AssetManager::getMesh(MeshHandle handle)
+{
+  Slot *slot = assets_.get(handle);
+  if (slot == nullptr || slot->state != State::Ready) {
+    return nullptr;
+  }
+
+  slot->last_used = updates_;
+  return slot->mesh.get();
+}
+
+void AssetManager::update()
+{
+  RNDR_TRACE_ZONE("AssetManager::update");
+
+  /* never walk the upload queue while an outer update is partway through it */
+  if (updating_) {
+    return;
+  }
+  updating_ = true;
+  ++updates_;
+
+  for (auto &[id, parsed] : assets_.takeFinished()) {
+    Slot &slot = assets_.at(id);
+    if (!parsed.mesh) {
+      slot.state = State::Failed;
+      slot.error = std::move(parsed.error);
+      ++stats_.failed;
+      if (assets_.getRefs(id) == 0) {
+        destroySlot(id);
+      }
+      continue;
+    }
+
+    slot.mesh  = std::move(parsed.mesh);
+    slot.bytes = mesh_bytes(*slot.mesh);
+    upload_queue_.push_back(id);
+  }
+
+  uploadParsed();
+  updating_ = false;
+}
+
+AssetManager::Stats AssetManager::getStats() const
+{
+  Stats stats   = stats_;
+  stats.assets  = assets_.size();
+  stats.ready   = 0;
+  stats.pending = 0;
+  for (uint32_t id = 0; id < assets_.capacity(); ++id) {
+    const Slot &slot = assets_.at(id);
+    stats.ready += slot.state == State::Ready;
+    stats.pending += slot.state == State::Loading
+                     || slot.state == State::Uploading;
+  }
+  return stats;
+}
+
+void AssetManager::uploadParsed()
+{
+  uint64_t              uploaded = 0;
+  uint64_t              batch    = next_batch_;
+  size_t                done     = 0;
+  std::vector<uint32_t> waiting;
+
+  for (; done < upload_queue_.size(); ++done) {
+    uint32_t id   = upload_queue_[done];
+    Slot    &slot = assets_.at(id);
+
+    /* always make progress, but spread big batches over several updates */
+    if (uploaded > 0
+        && uploaded + slot.bytes > config_.upload_bytes_per_update) {
+      break;
+    }
+
+    if (slot.bytes > config_.budget_bytes) {
+      slot.state = State::Failed;
+      slot.error = "Mesh of " + std::to_string(slot.bytes)
+                   + " bytes exceeds the residency budget";
+      slot.mesh.reset();
+      ++stats_.failed;
+      if (assets_.getRefs(id) == 0) {
+        destroySlot(id);
+      }
+      continue;
+    }
+
+    if (stats_.resident_bytes + slot.bytes > config_.budget_bytes
+        && !evict(stats_.resident_bytes + slot.bytes - config_.budget_bytes)) {
+      /* wait for references to drop, without holding up smaller meshes */
+      waiting.push_back(id);
+      continue;
+    }
+
+    if (auto result = slot.mesh->upload(allocator_, uploads_); !result) {
+      slot.state = State::Failed;
+      slot.error = result.message();
+      slot.mesh.reset();
+      ++stats_.failed;
+      continue;
+    }
+
+    slot.state  = State::Uploading;
+    slot.batch  = batch;
+    uploaded   += slot.bytes;
+    stats_.resident_bytes += slot.bytes;
+    stats_.peak_bytes = std::max(stats_.peak_bytes, stats_.resident_bytes);
+  }
+
+  upload_queue_.erase(upload_queue_.begin(), upload_queue_.begin() + done);
+  upload_queue_.insert(upload_queue_.end(), waiting.begin(), waiting.end());
+
+  if (uploaded == 0) {
+    return;
+  }
+
+  if (auto result = uploads_.submit(); !result) {
+    for (uint32_t id = 0; id < assets_.capacity(); ++id) {
+      Slot &slot = assets_.at(id);
+      if (slot.state == State::Uploading && slot.batch == batch) {
+        slot.state = State::Failed;
+        slot.error = result.message();
+        ++stats_.failed;
+      }
+    }
+    return;
+  }
+  ++next_batch_;
+
+  /* fires from a later `processEvents()` once the copies have executed */
+  std::weak_ptr<bool> alive = alive_;
+  getContext().getQueue().OnSubmittedWorkDone(
+      wgpu::CallbackMode::AllowProcessEvents,
+      [this, batch, alive](wgpu::QueueWorkDoneStatus status) {
+        if (alive.expired()) {
+          return;
+        }
+
+        for (uint32_t id = 0; id < assets_.capacity(); ++id) {
+          Slot &slot = assets_.at(id);
+          if (slot.state == State::Uploading && slot.batch == batch) {
+            slot.state = status == wgpu::QueueWorkDoneStatus::Success
+                             ? State::Ready
+                             : State::Failed;
+          }
+        }
+      });
+}
+
+bool AssetManager::evict(uint64_t bytes)
+{
+  std::vector<uint32_t> candidates;
+  for (uint32_t id = 0; id < assets_.capacity(); ++id) {
+    if (assets_.getRefs(id) == 0 && assets_.at(id).state == State::Ready) {
+      candidates.push_back(id);
+    }
+  }
+
+  std::sort(candidates.begin(), candidates.end(), [this](uint32_t a, uint32_t b) {
+    return assets_.at(a).last_used < assets_.at(b).last_used;
+  });
+
+  /* only evict once the candidates are known to cover `bytes`, so that
+   * nothing is thrown away for an upload that cannot happen anyway */
+  size_t   count = 0;
+  uint64_t freed = 0;
+  for (; count < candidates.size() && freed < bytes; ++count) {
+    freed += assets_.at(candidates[count]).bytes;
+  }
+
+  if (freed < bytes) {
+    return false;
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    destroySlot(candidates[i]);
+    ++stats_.evictions;
+  }
+
+  return true;
+}
+
+void AssetManager::destroySlot(uint32_t id)
+{
+  const Slot &slot = assets_.at(id);
+  if (slot.state == State::Uploading || slot.state == State::Ready) {
+    stats_.resident_bytes -= slot.bytes;
+  }
+
+  /* the mesh returns its ranges to the allocator on destruction */
+  assets_.destroy(id);
+}
+
+} // namespace rndr
@@ -0,0 +1,142 @@
+/**
+ * @file asset_manager.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_ASSET_MANAGER_H_
+#define RNDR_ASSET_MANAGER_H_
+
+#include "asset_table.h"
+#include "rndr/context.h"
+#include "rndr/jobs/job_system.h"
+#include "rndr/memory/buffer_allocator.h"
+#include "rndr/memory/upload_ring.h"
+#include "rndr/resources/renderable_mesh.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rndr {
+
+class AssetManager;
+using MeshHandle = AssetHandle<AssetManager>;
+
+/**
+ * @brief Loads meshes in the background and hands out handles right away.
+ *
+ * Files are parsed as `JobSystem` jobs through an `AssetTable`. Parsed meshes are uploaded through the
+ * `UploadRing` from the `Context::processEvents()` callback, at most
+ * `Config::upload_bytes_per_update` per call so that streaming never stalls a
+ * frame, and become ready once the queue reports the upload done.
+ *
+ * Loading the same path twice returns the same handle. Handles are reference
+ * counted; meshes nobody references stay resident as a cache until the
+ * memory budget needs their space, least recently used first.
+ */
+class AssetManager : public GlobalAccess {
+public:
+  enum class State { Loading, Uploading, Ready, Failed, Invalid };
+
+  struct Config {
+    /* GPU bytes resident meshes may take up */
+    uint64_t budget_bytes            = 256ull << 20;
+    uint64_t upload_bytes_per_update = 16ull << 20;
+  };
+
+  struct Stats {
+    size_t   assets         = 0;
+    size_t   ready          = 0;
+    size_t   pending        = 0;
+    size_t   failed         = 0;
+    size_t   dedup_hits     = 0;
+    size_t   evictions      = 0;
+    uint64_t resident_bytes = 0;
+    uint64_t peak_bytes     = 0;
+  };
+
+  AssetManager(Context         &context,
+               JobSystem       &jobs,
+               BufferAllocator &allocator,
+               UploadRing      &uploads);
+  AssetManager(Context         &context,
+               JobSystem       &jobs,
+               BufferAllocator &allocator,
+               UploadRing      &uploads,
+               Config           config);
+  ~AssetManager();
+
+  AssetManager(const AssetManager &)            = delete;
+  AssetManager &operator=(const AssetManager &) = delete;
+
+  AssetManager(AssetManager &&)                 = delete;
+  AssetManager &operator=(AssetManager &&)      = delete;
+
+  /* start loading `path`, or reference it again if it already is */
+  MeshHandle            loadMesh(const std::filesystem::path &path);
+
+  void                  acquire(MeshHandle handle);
+  void                  release(MeshHandle handle);
+
+  State                 getState(MeshHandle handle) const;
+  bool                  isReady(MeshHandle handle) const;
+  /* reason the load failed, empty otherwise */
+  const std::string    &getError(MeshHandle handle) const;
+
+  /* the mesh if it is ready, otherwise `nullptr` */
+  const RenderableMesh *getMesh(MeshHandle handle);
+
+  /* integrate finished loads; runs from `Context::processEvents()`, and does
+   * nothing when reached from within itself */
+  void                  update();
+
+  Stats                 getStats() const;
+
+private:
+  struct Slot {
+    State                           state     = State::Invalid;
+    std::unique_ptr<RenderableMesh> mesh      = {};
+    uint64_t                        bytes     = 0;
+    uint64_t                        batch     = 0;
+    uint64_t                        last_used = 0;
+    std::string                     error     = {};
+  };
+
+  struct Parsed {
+    std::unique_ptr<RenderableMesh> mesh  = {};
+    std::string                     error = {};
+  };
+
+  void uploadParsed();
+  bool evict(uint64_t bytes);
+  void destroySlot(uint32_t id);
+
+  BufferAllocator                         &allocator_;
+  UploadRing                              &uploads_;
+  const Config                             config_;
+  uint32_t                                 callback_id_  = 0;
+
+  AssetTable<AssetManager, Slot, Parsed>   assets_;
+
+  std::vector<uint32_t>                    upload_queue_ = {};
+  uint64_t                                 next_batch_   = 1;
+  uint64_t                                 updates_      = 0;
+  bool                                     updating_     = false;
+
+  Stats                                    stats_        = {};
+
+  /* lets work-done callbacks outliving the manager know to bail */
+  std::shared_ptr<bool> alive_ = std::make_shared<bool>(true);
+};
+
+} // namespace rndr
+
+#endif
@@ -0,0 +1,241 @@
+/**
+ * @file asset_table.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_ASSET_TABLE_H_
+#define RNDR_ASSET_TABLE_H_
+
+#include "rndr/jobs/job_system.h"
+
+#include <cassert>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace rndr {
+
+/**
+ * @brief A reference to an asset of the loader `Owner`, which goes stale once
+ * the asset is destroyed and its slot reused.
+ */
+template <typename Owner> struct AssetHandle {
+  static constexpr uint32_t invalid_id = UINT32_MAX;
+  uint32_t                  id         = invalid_id;
+  uint32_t                  generation = 0;
+
+  bool                      valid() const
+  {
+    return id != invalid_id;
+  }
+
+  bool operator==(const AssetHandle &other) const = default;
+};
+
+/**
+ * @brief The bookkeeping shared by the asset loaders: slots behind
+ * generational handles, reference counts, deduplication by path, and loading
+ * on the `JobSystem` with the results collected on the owner's thread.
+ *
+ * `Slot` holds whatever the owner tracks per asset and is reset to `Slot{}`
+ * when the asset is destroyed. `Loaded` is what a load job produces.
+ */
+template <typename Owner, typename Slot, typename Loaded> class AssetTable {
+public:
+  using Handle       = AssetHandle<Owner>;
+  /* runs on a worker thread, touching nothing but what it captured */
+  using LoadFunction = std::function<Loaded()>;
+
+  struct Finished {
+    uint32_t id     = 0;
+    Loaded   loaded = {};
+  };
+
+  explicit AssetTable(JobSystem &jobs) : jobs_(jobs)
+  {
+  }
+
+  ~AssetTable()
+  {
+    /* load jobs write into this object */
+    jobs_.wait(loading_);
+  }
+
+  AssetTable(const AssetTable &)            = delete;
+  AssetTable &operator=(const AssetTable &) = delete;
+
+  AssetTable(AssetTable &&)                 = delete;
+  AssetTable &operator=(AssetTable &&)      = delete;
+
+  /**
+   * @brief Reference the asset at `path` again, or give it a slot and start
+   * `load` in the background.
+   *
+   * @return the handle, and true if the slot is new
+   */
+  std::pair<Handle, bool> load(const std::filesystem::path &path,
+                               LoadFunction                 load)
+  {
+    std::error_code ec;
+    std::string key = std::filesystem::weakly_canonical(path, ec).string();
+    if (ec) {
+      key = path.lexically_normal().string();
+    }
+
+    if (auto existing = paths_.find(key); existing != paths_.end()) {
+      Entry &entry = entries_[existing->second];
+      ++entry.refs;
+      return {Handle{existing->second, entry.generation}, false};
+    }
+
+    uint32_t id;
+    if (!free_ids_.empty()) {
+      id = free_ids_.back();
+      free_ids_.pop_back();
+    }
+    else {
+      id = static_cast<uint32_t>(entries_.size());
+      entries_.emplace_back();
+    }
+
+    Entry &entry = entries_[id];
+    entry.key    = key;
+    entry.refs   = 1;
+    entry.live   = true;
+    paths_[key]  = id;
+
+    jobs_.run(
+        [this, id, load = std::move(load)] {
+          Finished finished{id, load()};
+
+          std::lock_guard lock(finished_mutex_);
+          finished_.push_back(std::move(finished));
+        },
+        &loading_);
+
+    return {Handle{id, entry.generation}, true};
+  }
+
+  /* the loads completed since the last call */
+  std::vector<Finished> takeFinished()
+  {
+    std::vector<Finished> finished;
+    std::lock_guard       lock(finished_mutex_);
+    finished.swap(finished_);
+    return finished;
+  }
+
+  /* the slot `handle` refers to, or `nullptr` if it is stale */
+  Slot *get(Handle handle)
+  {
+    if (!handle.valid() || handle.id >= entries_.size()) {
+      return nullptr;
+    }
+
+    Entry &entry = entries_[handle.id];
+    if (!entry.live || entry.generation != handle.generation) {
+      return nullptr;
+    }
+
+    return &entry.slot;
+  }
+
+  const Slot *get(Handle handle) const
+  {
+    return const_cast<AssetTable *>(this)->get(handle);
+  }
+
+  /* any slot below `capacity()`, destroyed ones hold `Slot{}` */
+  Slot &at(uint32_t id)
+  {
+    return entries_[id].slot;
+  }
+
+  const Slot &at(uint32_t id) const
+  {
+    return entries_[id].slot;
+  }
+
+  uint32_t getRefs(uint32_t id) const
+  {
+    return entries_[id].refs;
+  }
+
+  void acquire(Handle handle)
+  {
+    if (get(handle) != nullptr) {
+      ++entries_[handle.id].refs;
+    }
+  }
+
+  /* drop a reference, true if it was the last one */
+  bool release(Handle handle)
+  {
+    if (get(handle) == nullptr) {
+      return false;
+    }
+
+    Entry &entry = entries_[handle.id];
+    assert(entry.refs > 0);
+    return --entry.refs == 0;
+  }
+
+  /* free the slot for reuse, after the owner released what it holds */
+  void destroy(uint32_t id)
+  {
+    Entry &entry = entries_[id];
+    paths_.erase(entry.key);
+
+    uint32_t generation = entry.generation + 1;
+    entry               = Entry{};
+    entry.generation    = generation;
+    free_ids_.push_back(id);
+  }
+
+  /* slots ever allocated, live or not */
+  uint32_t capacity() const
+  {
+    return static_cast<uint32_t>(entries_.size());
+  }
+
+  /* live assets */
+  size_t size() const
+  {
+    return entries_.size() - free_ids_.size();
+  }
+
+private:
+  struct Entry {
+    Slot        slot       = {};
+    std::string key        = {};
+    uint32_t    generation = 0;
+    uint32_t    refs       = 0;
+    bool        live       = false;
+  };
+
+  JobSystem                                &jobs_;
+
+  std::vector<Entry>                        entries_  = {};
+  std::vector<uint32_t>                     free_ids_ = {};
+  std::unordered_map<std::string, uint32_t> paths_    = {};
+
+  /* written by load jobs, drained by `takeFinished()` */
+  std::mutex                                finished_mutex_ = {};
+  std::vector<Finished>                     finished_       = {};
+  JobSystem::Counter                        loading_        = {};
+};
+
+} // namespace rndr
+
+#endif
@@ -0,0 +1,501 @@
+/**
+ * @file texture_streamer.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "texture_streamer.h"
+#include "rndr/profiling/trace.h"
+#include "rndr/utils/ppm_parser.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+namespace rndr {
+
+static uint32_t align_up(uint32_t value, uint32_t alignment)
+{
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+/* 2 x 2 box filter down to 1 x 1, clamped at the edges of odd-sized levels */
+static std::vector<ImageData> build_mip_chain(ImageData image)
+{
+  RNDR_TRACE_ZONE("TextureStreamer::buildMipChain");
+
+  std::vector<ImageData> levels;
+  levels.push_back(std::move(image));
+
+  while (levels.back().width > 1 || levels.back().height > 1) {
+    const ImageData &src = levels.back();
+    ImageData        dst{std::max(src.width / 2, 1u),
+                  std::max(src.height / 2, 1u),
+                  {}};
+    dst.pixels.resize(size_t{dst.width} * dst.height * 4);
+
+    for (uint32_t y = 0; y < dst.height; ++y) {
+      uint32_t y0 = std::min(2 * y, src.height - 1);
+      uint32_t y1 = std::min(2 * y + 1, src.height - 1);
+      for (uint32_t x = 0; x < dst.width; ++x) {
+        uint32_t x0 = std::min(2 * x, src.width - 1);
+        uint32_t x1 = std::min(2 * x + 1, src.width - 1);
+        for (uint32_t c = 0; c < 4; ++c) {
+          auto texel = [&](uint32_t sx, uint32_t sy) {
+            return uint32_t{src.pixels[(size_t{sy} * src.width + sx) * 4 + c]};
+          };
+          uint32_t sum = texel(x0, y0) + texel(x1, y0) + texel(x0, y1)
+                         + texel(x1, y1);
+          dst.pixels[(size_t{y} * dst.width + x) * 4 + c]
+              = static_cast<uint8_t>((sum + 2) / 4);
+        }
+      }
+    }
+
+    levels.push_back(std::move(dst));
+  }
+
+  return levels;
+}
+
+TextureStreamer::TextureStreamer(Context    &context,
+                                 JobSystem  &jobs,
+                                 UploadRing &uploads)
+    : TextureStreamer(context, jobs, uploads, Config{})
+{
+}
+
+TextureStreamer::TextureStreamer(Context    &context,
+                                 JobSystem  &jobs,
+                                 UploadRing &uploads,
+                                 Config      config)
+    : GlobalAccess(context), uploads_(uploads), config_(config),
+      textures_(jobs)
+{
+  callback_id_ = context.addEventCallback([this] { update(); });
+}
+
+TextureStreamer::~TextureStreamer()
+{
+  getContext().removeEventCallback(callback_id_);
+}
+
+TextureHandle TextureStreamer::load(const std::filesystem::path &path)
+{
+  auto [handle, created] = textures_.load(path, [path] {
+    RNDR_TRACE_ZONE("TextureStreamer::decode");
+
+    Decoded decoded;
+    if (auto image = parsePpmFile(path)) {
+      decoded.levels = build_mip_chain(std::move(*image));
+    }
+    else {
+      decoded.error = "Failed to decode " + path.string();
+    }
+    return decoded;
+  });
+
+  if (created) {
+    textures_.get(handle)->state = State::Loading;
+  }
+  else {
+    ++stats_.dedup_hits;
+  }
+
+  return handle;
+}
+
+void TextureStreamer::acquire(TextureHandle handle)
+{
+  textures_.acquire(handle);
+}
+
+void TextureStreamer::release(TextureHandle handle)
+{
+  /* a failed load caches nothing worth keeping */
+  if (textures_.release(handle)
+      && textures_.get(handle)->state == State::Failed) {
+    destroySlot(handle.id);
+  }
+}
+
+void TextureStreamer::request(TextureHandle handle, float screen_size)
+{
+  Slot *slot = textures_.get(handle);
+  if (slot == nullptr || slot->levels.empty()) {
+    return;
+  }
+
+  uint32_t level = levelFor(slot->levels[0].width, slot->levels[0].height,
+                            screen_size);
+  if (slot->last_requested != updates_) {
+    slot->requested      = level;
+    slot->last_requested = updates_;
+  }
+  else {
+    slot->requested = std::min(slot->requested, level);
+  }
+}
+
+TextureStreamer::State TextureStreamer::getState(TextureHandle handle) const
+{
+  const Slot *slot = textures_.get(handle);
+  return slot != nullptr ? slot->state : State::Invalid;
+}
+
+const std::string &TextureStreamer::getError(TextureHandle handle) const
+{
+  static const std::string none;
+  const Slot              *slot = textures_.get(handle);
+  return slot != nullptr ? slot->error : none;
+}
+
+const wgpu::TextureView *TextureStreamer::getView(TextureHandle handle)
+{
+  Slot *slot = textures_.get(handle);
+  if (slot == nullptr || slot->state != State::Resident) {
+    return nullptr;
+  }
+  return &slot->view;
+}
+
+uint32_t TextureStreamer::getResidentLevel(TextureHandle handle) const
+{
+  const Slot *slot = textures_.get(handle);
+  return slot != nullptr ? slot->resident : 0;
+}
+
+uint32_t TextureStreamer::getLevelCount(TextureHandle handle) const
+{
+  const Slot *slot = textures_.get(handle);
+  return slot != nullptr ? static_cast<uint32_t>(slot->levels.size()) : 0;
+}
+
+void TextureStreamer::update()
+{
+  RNDR_TRACE_ZONE("TextureStreamer::update");
+
+  /* never page levels while an outer update has its encoder open */
+  if (updating_) {
+    return;
+  }
+  updating_ = true;
+  ++updates_;
+
+  for (auto &[id, decoded] : textures_.takeFinished()) {
+    Slot &slot = textures_.at(id);
+    if (decoded.levels.empty()) {
+      slot.state = State::Failed;
+      slot.error = std::move(decoded.error);
+      ++stats_.failed;
+      if (textures_.getRefs(id) == 0) {
+        destroySlot(id);
+      }
+      continue;
+    }
+
+    slot.levels   = std::move(decoded.levels);
+    slot.resident = static_cast<uint32_t>(slot.levels.size());
+    slot.tail     = slot.resident - 1;
+    while (slot.tail > 0
+           && std::max(slot.levels[slot.tail - 1].width,
+                       slot.levels[slot.tail - 1].height)
+                  <= config_.tail_size) {
+      --slot.tail;
+    }
+    slot.requested = slot.tail;
+  }
+
+  wgpu::CommandEncoderDescriptor encoder_desc = {};
+  encoder_desc.label = "Texture Streamer Command Encoder";
+  wgpu::CommandEncoder encoder
+      = getDevice().CreateCommandEncoder(&encoder_desc);
+
+  uint64_t paged_before = stats_.levels_paged_in + stats_.levels_paged_out;
+  uint64_t uploaded     = 0;
+  /* textures with levels staged on the ring this update */
+  std::vector<uint32_t> staged;
+
+  /* tails first, so that every texture is usable before any gets sharper */
+  for (uint32_t id = 0; id < textures_.capacity(); ++id) {
+    Slot &slot = textures_.at(id);
+    if (slot.state != State::Loading || slot.levels.empty()) {
+      continue;
+    }
+
+    uint64_t bytes = levelBytes(slot, slot.tail);
+    if (uploaded > 0 && uploaded + bytes > config_.upload_bytes_per_update) {
+      break;
+    }
+    if (!makeRoom(bytes, id, encoder)) {
+      break;
+    }
+
+    uploaded   += setResidency(id, slot.tail, encoder);
+    slot.state  = State::Resident;
+    staged.push_back(id);
+  }
+
+  /* then one finer level per texture, for the largest deficits first */
+  std::vector<uint32_t> wanting;
+  for (uint32_t id = 0; id < textures_.capacity(); ++id) {
+    const Slot &slot = textures_.at(id);
+    if (slot.state == State::Resident && wantedLevel(slot) < slot.resident) {
+      wanting.push_back(id);
+    }
+  }
+
+  std::sort(wanting.begin(), wanting.end(), [this](uint32_t a, uint32_t b) {
+    const Slot &lhs = textures_.at(a), &rhs = textures_.at(b);
+    return lhs.resident - wantedLevel(lhs) > rhs.resident - wantedLevel(rhs);
+  });
+
+  for (uint32_t id : wanting) {
+    Slot    &slot   = textures_.at(id);
+    uint32_t target = slot.resident - 1;
+
+    uint64_t bytes  = slot.levels[target].pixels.size();
+    if (uploaded > 0 && uploaded + bytes > config_.upload_bytes_per_update) {
+      break;
+    }
+    if (!makeRoom(levelBytes(slot, target) - slot.bytes, id, encoder)) {
+      continue;
+    }
+
+    uploaded += setResidency(id, target, encoder);
+    staged.push_back(id);
+  }
+
+  if (stats_.levels_paged_in + stats_.levels_paged_out == paged_before) {
+    updating_ = false;
+    return;
+  }
+
+  /* copies between old and new textures, then the newly staged levels */
+  wgpu::CommandBuffer commands = encoder.Finish();
+  getContext().getQueue().Submit(1, &commands);
+
+  if (auto result = uploads_.submit(); !result) {
+    for (uint32_t id : staged) {
+      textures_.at(id).state = State::Failed;
+      textures_.at(id).error = result.message();
+      ++stats_.failed;
+    }
+  }
+  updating_ = false;
+}
+
+TextureStreamer::Stats TextureStreamer::getStats() const
+{
+  Stats stats    = stats_;
+  stats.textures = textures_.size();
+  stats.resident = 0;
+  stats.loading  = 0;
+  for (uint32_t id = 0; id < textures_.capacity(); ++id) {
+    const Slot &slot = textures_.at(id);
+    stats.resident += slot.state == State::Resident;
+    stats.loading  += slot.state == State::Loading;
+  }
+  return stats;
+}
+
+uint32_t
+TextureStreamer::levelFor(uint32_t width, uint32_t height, float screen_size)
+{
+  uint32_t size   = std::max(width, height);
+  uint32_t levels = std::bit_width(std::max(size, 1u));
+
+  if (screen_size <= 0.f) {
+    return levels - 1;
+  }
+
+  float ratio = static_cast<float>(size) / screen_size;
+  if (ratio <= 1.f) {
+    return 0;
+  }
+
+  return std::min(static_cast<uint32_t>(std::floor(std::log2(ratio))),
+                  levels - 1);
+}
+
+uint32_t TextureStreamer::wantedLevel(const Slot &slot) const
+{
+  if (updates_ - slot.last_requested > config_.idle_updates) {
+    return slot.tail;
+  }
+  return std::min(slot.requested, slot.tail);
+}
+
+uint64_t TextureStreamer::levelBytes(const Slot &slot, uint32_t level) const
+{
+  uint64_t bytes = 0;
+  for (size_t l = level; l < slot.levels.size(); ++l) {
+    bytes += slot.levels[l].pixels.size();
+  }
+  return bytes;
+}
+
+uint64_t TextureStreamer::setResidency(uint32_t                    id,
+                                       uint32_t                    level,
+                                       const wgpu::CommandEncoder &encoder)
+{
+  Slot                   &slot         = textures_.at(id);
+  const ImageData        &base         = slot.levels[level];
+  wgpu::TextureFormat     srgb_format  = wgpu::TextureFormat::RGBA8UnormSrgb;
+
+  wgpu::TextureDescriptor texture_desc = {};
+  texture_desc.label                   = "Streamed Texture";
+  texture_desc.size                    = {base.width, base.height, 1};
+  texture_desc.format                  = wgpu::TextureFormat::RGBA8Unorm;
+  texture_desc.mipLevelCount
+      = static_cast<uint32_t>(slot.levels.size()) - level;
+  texture_desc.usage = wgpu::TextureUsage::TextureBinding
+                       | wgpu::TextureUsage::CopyDst
+                       | wgpu::TextureUsage::CopySrc;
+  if (config_.srgb) {
+    texture_desc.viewFormatCount = 1;
+    texture_desc.viewFormats     = &srgb_format;
+  }
+  TrackedTexture texture = getContext().createTexture(texture_desc);
+
+  uint64_t      staged  = 0;
+  for (uint32_t l = level; l < slot.levels.size(); ++l) {
+    const ImageData       &image = slot.levels[l];
+    wgpu::Extent3D         size  = {image.width, image.height, 1};
+
+    wgpu::ImageCopyTexture dst   = {};
+    dst.texture                  = texture;
+    dst.mipLevel                 = l - level;
+
+    /* levels resident already never leave the GPU */
+    if (slot.texture && l >= slot.resident) {
+      wgpu::ImageCopyTexture src = {};
+      src.texture                = slot.texture;
+      src.mipLevel               = l - slot.resident;
+      encoder.CopyTextureToTexture(&src, &dst, &size);
+      continue;
+    }
+
+    uint32_t row_bytes     = image.width * 4;
+    uint32_t bytes_per_row = align_up(row_bytes, UploadRing::row_alignment);
+    auto     staging
+        = uploads_.reserveTexture(dst, size, bytes_per_row, image.height);
+    /* rows are aligned above, which is all that may fail */
+    assert(staging.ok());
+
+    for (uint32_t y = 0; y < image.height; ++y) {
+      std::memcpy((*staging).data() + size_t{y} * bytes_per_row,
+                  image.pixels.data() + size_t{y} * row_bytes, row_bytes);
+    }
+    staged += image.pixels.size();
+    ++stats_.levels_paged_in;
+  }
+
+  if (slot.texture && level > slot.resident) {
+    stats_.levels_paged_out += level - slot.resident;
+  }
+
+  uint64_t bytes         = levelBytes(slot, level);
+  stats_.resident_bytes  = stats_.resident_bytes - slot.bytes + bytes;
+  stats_.peak_bytes      = std::max(stats_.peak_bytes, stats_.resident_bytes);
+
+  wgpu::TextureViewDescriptor view_desc = {};
+  view_desc.dimension = wgpu::TextureViewDimension::e2D;
+  if (config_.srgb) {
+    view_desc.format = srgb_format;
+  }
+
+  /* the old texture may still be sampled by work in flight */
+  getContext().destroyLater(std::move(slot.texture));
+
+  slot.texture  = texture;
+  slot.view     = texture.CreateView(&view_desc);
+  slot.bytes    = bytes;
+  slot.resident = level;
+
+  return staged;
+}
+
+bool TextureStreamer::makeRoom(uint64_t                    bytes,
+                               uint32_t                    except,
+                               const wgpu::CommandEncoder &encoder)
+{
+  if (stats_.resident_bytes + bytes <= config_.budget_bytes) {
+    return true;
+  }
+  uint64_t needed = stats_.resident_bytes + bytes - config_.budget_bytes;
+
+  std::vector<uint32_t> candidates;
+  for (uint32_t id = 0; id < textures_.capacity(); ++id) {
+    if (id != except && textures_.at(id).state == State::Resident) {
+      candidates.push_back(id);
+    }
+  }
+
+  /* unreferenced textures first, then least recently requested */
+  std::sort(candidates.begin(), candidates.end(),
+            [this](uint32_t a, uint32_t b) {
+              bool lhs_unused = textures_.getRefs(a) == 0;
+              bool rhs_unused = textures_.getRefs(b) == 0;
+              if (lhs_unused != rhs_unused) {
+                return lhs_unused;
+              }
+              return textures_.at(a).last_requested
+                     < textures_.at(b).last_requested;
+            });
+
+  /* unreferenced textures go entirely, the others page out whatever is finer
+   * than what they were recently asked for */
+  auto reclaimable = [this](uint32_t id) -> uint64_t {
+    const Slot &slot = textures_.at(id);
+    if (textures_.getRefs(id) == 0) {
+      return slot.bytes;
+    }
+    uint32_t wanted = wantedLevel(slot);
+    return slot.resident < wanted ? slot.bytes - levelBytes(slot, wanted) : 0;
+  };
+
+  /* only act once the candidates are known to cover `bytes`, so that nothing
+   * is evicted or paged out for an upload that cannot happen anyway */
+  size_t   count = 0;
+  uint64_t freed = 0;
+  for (; count < candidates.size() && freed < needed; ++count) {
+    freed += reclaimable(candidates[count]);
+  }
+
+  if (freed < needed) {
+    return false;
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t id = candidates[i];
+    if (textures_.getRefs(id) == 0) {
+      destroySlot(id);
+      ++stats_.evictions;
+    }
+    else if (uint32_t wanted = wantedLevel(textures_.at(id));
+             textures_.at(id).resident < wanted) {
+      setResidency(id, wanted, encoder);
+    }
+  }
+
+  return true;
+}
+
+void TextureStreamer::destroySlot(uint32_t id)
+{
+  Slot &slot             = textures_.at(id);
+  stats_.resident_bytes -= slot.bytes;
+
+  getContext().destroyLater(std::move(slot.texture));
+  textures_.destroy(id);
+}
+
+} // namespace rndr
@@ -0,0 +1,179 @@
+/**
+ * @file texture_streamer.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_TEXTURE_STREAMER_H_
+#define RNDR_TEXTURE_STREAMER_H_
+
+#include "asset_table.h"
+#include "rndr/context.h"
+#include "rndr/jobs/job_system.h"
+#include "rndr/memory/upload_ring.h"
+#include "rndr/types/types.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+class TextureStreamer;
+using TextureHandle = AssetHandle<TextureStreamer>;
+
+/**
+ * @brief Streams textures in by mip level, keeping only the levels the screen
+ * asks for resident on the GPU.
+ *
+ * Images are decoded, and their mip chains built, as `JobSystem` jobs
+ * through an `AssetTable`, like the meshes of an `AssetManager`. The
+ * levels no larger than `Config::tail_size` are made resident first, so that
+ * a texture is usable as soon as possible. Each frame, `request()` records the
+ * finest level a texture is drawn at; `update()`, run from
+ * `Context::processEvents()`, then pages finer levels in through the
+ * `UploadRing`, at most `Config::upload_bytes_per_update` per call.
+ *
+ * WebGPU cannot allocate part of a mip chain, so changing residency replaces
+ * the texture with one whose base is the new finest level, copying the levels
+ * both have on the GPU. Views therefore change whenever residency does.
+ *
+ * When paging in would exceed `Config::budget_bytes`, unreferenced textures
+ * are evicted, then levels finer than their recent requests are paged out of
+ * the others, least recently requested first. The tail is never paged out.
+ */
+class TextureStreamer : public GlobalAccess {
+public:
+  enum class State { Loading, Resident, Failed, Invalid };
+
+  struct Config {
+    /* GPU bytes resident levels may take up */
+    uint64_t budget_bytes            = 128ull << 20;
+    uint64_t upload_bytes_per_update = 8ull << 20;
+    /* levels this size and smaller are loaded first and always resident */
+    uint32_t tail_size               = 64;
+    /* updates without a `request()` before a texture only wants its tail */
+    uint32_t idle_updates            = 120;
+    bool     srgb                    = false;
+  };
+
+  struct Stats {
+    size_t   textures         = 0;
+    size_t   resident         = 0;
+    size_t   loading          = 0;
+    size_t   failed           = 0;
+    size_t   dedup_hits       = 0;
+    size_t   evictions        = 0;
+    uint64_t levels_paged_in  = 0;
+    uint64_t levels_paged_out = 0;
+    uint64_t resident_bytes   = 0;
+    uint64_t peak_bytes       = 0;
+  };
+
+  TextureStreamer(Context &context, JobSystem &jobs, UploadRing &uploads);
+  TextureStreamer(Context    &context,
+                  JobSystem  &jobs,
+                  UploadRing &uploads,
+                  Config      config);
+  ~TextureStreamer();
+
+  TextureStreamer(const TextureStreamer &)            = delete;
+  TextureStreamer &operator=(const TextureStreamer &) = delete;
+
+  TextureStreamer(TextureStreamer &&)                 = delete;
+  TextureStreamer &operator=(TextureStreamer &&)      = delete;
+
+  /* start streaming the `.ppm` at `path`, or reference it again */
+  TextureHandle            load(const std::filesystem::path &path);
+
+  void                     acquire(TextureHandle handle);
+  void                     release(TextureHandle handle);
+
+  /**
+   * @brief Ask for the level that covers `screen_size` pixels along the
+   * texture's longer side. The finest level asked for since the last
+   * `update()` wins.
+   */
+  void                     request(TextureHandle handle, float screen_size);
+
+  State                    getState(TextureHandle handle) const;
+  /* reason the load failed, empty otherwise */
+  const std::string       &getError(TextureHandle handle) const;
+
+  /* a view of the resident levels, or `nullptr` if none are */
+  const wgpu::TextureView *getView(TextureHandle handle);
+  /* finest resident level, where 0 is full resolution, once `Resident` */
+  uint32_t                 getResidentLevel(TextureHandle handle) const;
+  uint32_t                 getLevelCount(TextureHandle handle) const;
+
+  /* integrate finished loads and page levels; runs from `processEvents()`,
+   * and does nothing when reached from within itself */
+  void                     update();
+
+  Stats                    getStats() const;
+
+  /* finest level worth having for `screen_size` pixels of a texture */
+  static uint32_t levelFor(uint32_t width, uint32_t height, float screen_size);
+
+private:
+  struct Slot {
+    State                  state          = State::Invalid;
+    /* the decoded mip chain, level 0 first */
+    std::vector<ImageData> levels         = {};
+    /* coarsest level that is always resident */
+    uint32_t               tail           = 0;
+    /* finest resident level, `levels.size()` while none are */
+    uint32_t               resident       = 0;
+    uint32_t               requested      = 0;
+    uint64_t               last_requested = 0;
+    TrackedTexture         texture        = {};
+    wgpu::TextureView      view           = {};
+    uint64_t               bytes          = 0;
+    std::string            error          = {};
+  };
+
+  struct Decoded {
+    std::vector<ImageData> levels = {};
+    std::string            error  = {};
+  };
+
+  /* level a slot needs this update: its request if recent, else its tail */
+  uint32_t    wantedLevel(const Slot &slot) const;
+  uint64_t    levelBytes(const Slot &slot, uint32_t level) const;
+
+  /**
+   * @brief Replace the slot's texture with one whose finest level is `level`,
+   * copying shared levels on `encoder` and staging the rest.
+   *
+   * @return bytes staged for upload
+   */
+  uint64_t    setResidency(uint32_t                    id,
+                           uint32_t                    level,
+                           const wgpu::CommandEncoder &encoder);
+  bool        makeRoom(uint64_t                    bytes,
+                       uint32_t                    except,
+                       const wgpu::CommandEncoder &encoder);
+  void        destroySlot(uint32_t id);
+
+  UploadRing                                 &uploads_;
+  const Config                                config_;
+  uint32_t                                    callback_id_ = 0;
+
+  AssetTable<TextureStreamer, Slot, Decoded>  textures_;
+
+  uint64_t                                    updates_     = 0;
+  bool                                        updating_    = false;
+  Stats                                       stats_       = {};
+};
+
+} // namespace rndr
+
+#endif
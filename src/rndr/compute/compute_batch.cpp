@@ -0,0 +1,108 @@
+/**
+ * @file compute_batch.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "compute_batch.h"
+#include "rndr/profiling/trace.h"
+
+namespace rndr {
+
+ComputeBatch::ComputeBatch(Context &context) : GlobalAccess(context)
+{
+}
+
+ustd::result ComputeBatch::add(const ComputeKernel   &kernel,
+                               const wgpu::BindGroup &group,
+                               Size                   invocations)
+{
+  auto workgroups = kernel.workgroupsFor(invocations);
+  if (!workgroups) {
+    return ustd::unexpected(workgroups.message());
+  }
+
+  /* an empty dispatch is valid but pointless */
+  if ((*workgroups)[0] == 0 || (*workgroups)[1] == 0 || (*workgroups)[2] == 0) {
+    return {};
+  }
+
+  dispatches_.push_back(
+      {.kernel = &kernel, .group = group, .workgroups = *workgroups});
+  return {};
+}
+
+void ComputeBatch::record(const wgpu::CommandEncoder &encoder)
+{
+  RNDR_TRACE_ZONE("ComputeBatch::record");
+
+  if (dispatches_.empty()) {
+    return;
+  }
+
+  wgpu::ComputePassDescriptor pass_desc = {};
+  pass_desc.label                       = "Compute Batch Pass";
+  wgpu::ComputePassEncoder pass         = encoder.BeginComputePass(&pass_desc);
+
+  const ComputeKernel     *kernel       = nullptr;
+  const void              *group        = nullptr;
+  for (const Dispatch &dispatch : dispatches_) {
+    if (dispatch.kernel != kernel) {
+      kernel = dispatch.kernel;
+      pass.SetPipeline(kernel->getPipeline());
+      ++stats_.pipelines;
+    }
+    if (dispatch.group.Get() != group) {
+      group = dispatch.group.Get();
+      pass.SetBindGroup(0, dispatch.group);
+      ++stats_.bind_groups;
+    }
+
+    pass.DispatchWorkgroups(dispatch.workgroups[0], dispatch.workgroups[1],
+                            dispatch.workgroups[2]);
+  }
+  pass.End();
+
+  stats_.dispatches += dispatches_.size();
+  ++stats_.passes;
+  dispatches_.clear();
+}
+
+void ComputeBatch::submit()
+{
+  if (dispatches_.empty()) {
+    return;
+  }
+
+  wgpu::CommandEncoderDescriptor encoder_desc = {};
+  encoder_desc.label                          = "Compute Batch Encoder";
+  wgpu::CommandEncoder encoder = getDevice().CreateCommandEncoder(&encoder_desc);
+
+  record(encoder);
+
+  wgpu::CommandBuffer commands = encoder.Finish();
+  getContext().getQueue().Submit(1, &commands);
+  ++stats_.submits;
+}
+
+size_t ComputeBatch::size() const
+{
+  return dispatches_.size();
+}
+
+const ComputeBatch::Stats &ComputeBatch::getStats() const
+{
+  return stats_;
+}
+
+void ComputeBatch::resetStats()
+{
+  stats_ = {};
+}
+
+} // namespace rndr
@@ -0,0 +1,82 @@
+/**
+ * @file compute_batch.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_COMPUTE_BATCH_H_
+#define RNDR_COMPUTE_BATCH_H_
+
+#include "rndr/compute/compute_kernel.h"
+#include "rndr/context.h"
+#include "ustd/expected.h"
+
+#include <cstdint>
+#include <vector>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+/**
+ * @brief Collects dispatches and records them back to back in a single
+ * compute pass, so that a chain of small kernels costs one pass and one
+ * submit rather than one of each per dispatch.
+ *
+ * WebGPU orders storage writes between dispatches of the same pass, so later
+ * dispatches see what earlier ones wrote. Pipeline and bind group changes are
+ * only recorded when they differ from the previous dispatch.
+ */
+class ComputeBatch : public GlobalAccess {
+public:
+  using Size = ComputeKernel::Size;
+
+  struct Stats {
+    uint32_t dispatches  = 0;
+    uint32_t pipelines   = 0;
+    uint32_t bind_groups = 0;
+    uint32_t passes      = 0;
+    uint32_t submits     = 0;
+  };
+
+  ComputeBatch(Context &context);
+
+  ComputeBatch(const ComputeBatch &)            = delete;
+  ComputeBatch &operator=(const ComputeBatch &) = delete;
+
+  ComputeBatch(ComputeBatch &&)                 = delete;
+  ComputeBatch &operator=(ComputeBatch &&)      = delete;
+
+  /* queue a dispatch of `kernel` covering `invocations` threads */
+  [[nodiscard]] ustd::result add(const ComputeKernel   &kernel,
+                                 const wgpu::BindGroup &group,
+                                 Size                   invocations);
+
+  /* record every queued dispatch into one pass of `encoder`, then clear */
+  void                       record(const wgpu::CommandEncoder &encoder);
+
+  /* record into a command buffer of its own and submit it */
+  void                       submit();
+
+  size_t                     size() const;
+  const Stats               &getStats() const;
+  void                       resetStats();
+
+private:
+  struct Dispatch {
+    const ComputeKernel *kernel     = nullptr;
+    wgpu::BindGroup      group      = {};
+    Size                 workgroups = {};
+  };
+
+  std::vector<Dispatch> dispatches_ = {};
+  Stats                 stats_      = {};
+};
+
+} // namespace rndr
+
+#endif
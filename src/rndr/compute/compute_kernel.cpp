@@ -0,0 +1,129 @@
+/**
+ * @file compute_kernel.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "compute_kernel.h"
+#include "rndr/utils/helpers.h"
+
+
+namespace rndr {
+
+static constexpr const char *size_overrides[3]
+    = {"WORKGROUP_SIZE_X", "WORKGROUP_SIZE_Y", "WORKGROUP_SIZE_Z"};
+
+ComputeKernel::ComputeKernel(Context &context, ResourceCache &cache, Config config)
+    : GlobalAccess(context), cache_(cache), config_(std::move(config))
+{
+}
+
+ustd::result ComputeKernel::initialize()
+{
+  if (config_.source.empty()) {
+    return ustd::unexpected("Compute kernel has no shader source");
+  }
+
+  limits_ = getContext().getLimits();
+  if (!helpers::workgroup_size_supported(config_.workgroup_size, limits_)) {
+    return ustd::unexpected("Workgroup size of " + config_.entry_point
+                            + " exceeds the device's compute limits");
+  }
+
+  layout_ = cache_.getBindGroupLayout(config_.entries);
+
+  std::vector<wgpu::ConstantEntry> constants;
+  for (size_t i = 0; i < 3; ++i) {
+    if (helpers::declares_override(config_.source, size_overrides[i])) {
+      constants.push_back({.key   = size_overrides[i],
+                           .value = double(config_.workgroup_size[i])});
+    }
+  }
+
+  /* pipelines are keyed by everything that goes into them */
+  ResourceCache::ComputePipelineKey key = {};
+  key.source                            = config_.source;
+  key.entry_point                       = config_.entry_point;
+  key.layout                            = layout_.Get();
+  for (const wgpu::ConstantEntry &constant : constants) {
+    key.constants.emplace_back(constant.key, constant.value);
+  }
+
+  wgpu::ShaderModuleWGSLDescriptor shader_code_desc = {};
+  shader_code_desc.code = config_.source.c_str();
+
+  wgpu::ShaderModuleDescriptor shader_module_desc = {};
+  shader_module_desc.label                        = "Compute Kernel Module";
+  shader_module_desc.nextInChain                  = &shader_code_desc;
+
+  wgpu::PipelineLayout pipeline_layout = cache_.getPipelineLayout({&layout_, 1});
+
+  wgpu::ComputePipelineDescriptor pipeline_desc = {};
+  pipeline_desc.layout                          = pipeline_layout;
+  pipeline_desc.compute.entryPoint              = config_.entry_point.c_str();
+  pipeline_desc.compute.constantCount           = constants.size();
+  pipeline_desc.compute.constants               = constants.data();
+
+  /* only compile the module if the pipeline is not cached already */
+  if (!cache_.findComputePipeline(key)) {
+    pipeline_desc.compute.module
+        = getDevice().CreateShaderModule(&shader_module_desc);
+  }
+  pipeline_ = cache_.getComputePipeline(key, pipeline_desc);
+
+  if (!pipeline_) {
+    return ustd::unexpected("Failed to create compute pipeline for "
+                            + config_.entry_point);
+  }
+
+  return {};
+}
+
+const wgpu::BindGroup &
+ComputeKernel::bind(std::span<const wgpu::BindGroupEntry> entries)
+{
+  return cache_.getBindGroup(layout_, entries);
+}
+
+ustd::expected<ComputeKernel::Size>
+ComputeKernel::workgroupsFor(Size invocations) const
+{
+  return helpers::workgroup_count(invocations, config_.workgroup_size, limits_);
+}
+
+ustd::result ComputeKernel::dispatch(const wgpu::ComputePassEncoder &pass,
+                                     const wgpu::BindGroup          &group,
+                                     Size invocations) const
+{
+  auto workgroups = workgroupsFor(invocations);
+  if (!workgroups) {
+    return ustd::unexpected(workgroups.message());
+  }
+
+  pass.SetPipeline(pipeline_);
+  pass.SetBindGroup(0, group);
+  pass.DispatchWorkgroups((*workgroups)[0], (*workgroups)[1], (*workgroups)[2]);
+  return {};
+}
+
+const wgpu::ComputePipeline &ComputeKernel::getPipeline() const
+{
+  return pipeline_;
+}
+
+const wgpu::BindGroupLayout &ComputeKernel::getBindGroupLayout() const
+{
+  return layout_;
+}
+
+const ComputeKernel::Size &ComputeKernel::getWorkgroupSize() const
+{
+  return config_.workgroup_size;
+}
+
+} // namespace rndr
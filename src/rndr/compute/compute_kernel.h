@@ -0,0 +1,85 @@
+/**
+ * @file compute_kernel.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_COMPUTE_KERNEL_H_
+#define RNDR_COMPUTE_KERNEL_H_
+
+#include "rndr/context.h"
+#include "rndr/resources/resource_cache.h"
+#include "ustd/expected.h"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+/**
+ * @brief A compute pipeline built from WGSL through the `ResourceCache`, with
+ * an explicit layout for bind group 0.
+ *
+ * If the shader declares `override WORKGROUP_SIZE_X: u32` (and `_Y`, `_Z`),
+ * they are set from `Config::workgroup_size`, so that one source can be
+ * compiled for whatever the device's limits allow.
+ */
+class ComputeKernel : public GlobalAccess {
+public:
+  using Size = std::array<uint32_t, 3>;
+
+  struct Config {
+    std::string                             source         = {};
+    std::string                             entry_point    = "main";
+    /* must match `@workgroup_size` unless set through the overrides */
+    Size                                    workgroup_size = {64, 1, 1};
+    std::vector<wgpu::BindGroupLayoutEntry> entries        = {};
+  };
+
+  ComputeKernel(Context &context, ResourceCache &cache, Config config);
+
+  ComputeKernel(const ComputeKernel &)            = delete;
+  ComputeKernel &operator=(const ComputeKernel &) = delete;
+
+  ComputeKernel(ComputeKernel &&)                 = delete;
+  ComputeKernel &operator=(ComputeKernel &&)      = delete;
+
+  [[nodiscard]] ustd::result initialize();
+
+  /* a cached bind group of `entries` for group 0 */
+  const wgpu::BindGroup     &bind(std::span<const wgpu::BindGroupEntry> entries);
+
+  /* workgroups covering `invocations` threads, within the device's limits */
+  [[nodiscard]] ustd::expected<Size> workgroupsFor(Size invocations) const;
+
+  /* record a dispatch covering `invocations` threads into `pass` */
+  [[nodiscard]] ustd::result dispatch(const wgpu::ComputePassEncoder &pass,
+                                      const wgpu::BindGroup          &group,
+                                      Size invocations) const;
+
+  const wgpu::ComputePipeline &getPipeline() const;
+  const wgpu::BindGroupLayout &getBindGroupLayout() const;
+  const Size                  &getWorkgroupSize() const;
+
+private:
+  ResourceCache        &cache_;
+  const Config          config_;
+  /* copied on `initialize()`, so dispatches can be recorded through a const kernel */
+  wgpu::Limits          limits_   = {};
+
+  wgpu::BindGroupLayout layout_   = {};
+  wgpu::ComputePipeline pipeline_ = {};
+};
+
+} // namespace rndr
+
+#endif
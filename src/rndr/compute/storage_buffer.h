@@ -0,0 +1,123 @@
+/**
+ * @file storage_buffer.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_STORAGE_BUFFER_H_
+#define RNDR_STORAGE_BUFFER_H_
+
+#include "rndr/context.h"
+#include "rndr/memory/upload_ring.h"
+#include "ustd/expected.h"
+
+#include <algorithm>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+/**
+ * @brief A storage buffer holding an array of `T`, e.g. `math::vec4` or
+ * `math::matrix<4, 4>`, as a WGSL `array<vec4f>` or `array<mat4x4f>` sees it.
+ *
+ * Only element types whose size is also their WGSL array stride are allowed:
+ * `math::vec3` has a stride of 16 in WGSL and is rejected at compile time.
+ */
+template <typename T>
+class StorageBuffer : public GlobalAccess {
+public:
+  static_assert(std::is_trivially_copyable_v<T>);
+  static_assert(sizeof(T) == 4 || sizeof(T) == 8 || sizeof(T) % 16 == 0,
+                "element size does not match its WGSL array stride");
+
+  StorageBuffer(Context &context, size_t count)
+      : StorageBuffer(context, count, wgpu::BufferUsage::None)
+  {
+  }
+
+  /* `extra_usage` is added to Storage | CopyDst | CopySrc */
+  StorageBuffer(Context &context, size_t count, wgpu::BufferUsage extra_usage)
+      : GlobalAccess(context), count_(count)
+  {
+    wgpu::BufferDescriptor buffer_desc = {};
+    buffer_desc.label                  = "Storage Buffer";
+    buffer_desc.usage = wgpu::BufferUsage::Storage | wgpu::BufferUsage::CopyDst
+                        | wgpu::BufferUsage::CopySrc | extra_usage;
+    buffer_desc.size  = std::max<uint64_t>(count, 1) * sizeof(T);
+    buffer_
+        = getContext().createBuffer(buffer_desc, MemoryCategory::Storage);
+  }
+
+  StorageBuffer(const StorageBuffer &)            = delete;
+  StorageBuffer &operator=(const StorageBuffer &) = delete;
+
+  StorageBuffer(StorageBuffer &&)                 = delete;
+  StorageBuffer &operator=(StorageBuffer &&)      = delete;
+
+  /* queue `values` for elements `[first, first + values.size())` */
+  [[nodiscard]] ustd::result
+  upload(UploadRing &uploads, std::span<const T> values, size_t first = 0)
+  {
+    if (first + values.size() > count_) {
+      return ustd::unexpected("Upload past the end of a storage buffer");
+    }
+
+    auto staged
+        = uploads.reserve(buffer_, first * sizeof(T), values.size_bytes());
+    if (!staged) {
+      return ustd::unexpected(staged.message());
+    }
+    std::memcpy((*staged).data(), values.data(), values.size_bytes());
+    return {};
+  }
+
+  static wgpu::BindGroupLayoutEntry layoutEntry(uint32_t          binding,
+                                                bool              read_only,
+                                                wgpu::ShaderStage visibility
+                                                = wgpu::ShaderStage::Compute)
+  {
+    wgpu::BindGroupLayoutEntry entry = {};
+    entry.binding                    = binding;
+    entry.visibility                 = visibility;
+    entry.buffer.type                = read_only
+                                           ? wgpu::BufferBindingType::ReadOnlyStorage
+                                           : wgpu::BufferBindingType::Storage;
+    entry.buffer.minBindingSize      = sizeof(T);
+    return entry;
+  }
+
+  wgpu::BindGroupEntry entry(uint32_t binding) const
+  {
+    wgpu::BindGroupEntry entry = {};
+    entry.binding              = binding;
+    entry.buffer               = buffer_;
+    entry.size                 = buffer_.GetSize();
+    return entry;
+  }
+
+  const wgpu::Buffer &getBuffer() const
+  {
+    return buffer_;
+  }
+
+  size_t size() const
+  {
+    return count_;
+  }
+
+private:
+  const size_t count_;
+  TrackedBuffer buffer_ = {};
+};
+
+} // namespace rndr
+
+#endif
@@ -9,14 +9,18 @@
  *
  */
 
+#include "rndr/profiling/trace.h"
 #include "rndr/utils/helpers.h"
 
 #include "context.h"
 #include "glfw3webgpu.h"
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <future>
 #include <iostream>
+#include <string>
 
 namespace rndr {
 
@@ -26,6 +30,11 @@ Context::Context(bool uses_surface) : uses_surface_(uses_surface)
 
 Context::~Context()
 {
+  /* an abandoned device request still writes to our members */
+  if (device_init_.valid()) {
+    device_init_.wait();
+  }
+
   /* manually release wgpu surface-related assets */
   if (surface_) {
     wgpuSurfaceRelease(surface_->MoveToCHandle());
@@ -36,12 +45,19 @@ Context::~Context()
     glfwTerminate();
   }
 
+  /* the device finishes its work before it goes, so just let these go */
+  retiring_ = {};
+  retired_.clear();
+
   if (queue_) {
     wgpuQueueRelease(queue_.MoveToCHandle());
   }
   if (device_) {
     wgpuDeviceRelease(device_.MoveToCHandle());
   }
+  if (adapter_) {
+    wgpuAdapterRelease(adapter_.MoveToCHandle());
+  }
   if (instance_) {
     instance_.ProcessEvents();
     wgpuInstanceRelease(instance_.MoveToCHandle());
@@ -60,36 +76,55 @@ void Context::setRequiredLimits(wgpu::Limits required_limits)
   required_limits_.limits = std::move(required_limits);
 }
 
-ustd::result Context::initializeWebGPU()
+void Context::setForceFallbackAdapter(bool force_fallback_adapter)
 {
-  wgpu::InstanceDescriptor instance_desc      = {};
-  instance_desc.features.timedWaitAnyEnable   = true;
-  instance_desc.features.timedWaitAnyMaxCount = 8;
-  instance_                                   = CreateInstance(&instance_desc);
+  force_fallback_ = force_fallback_adapter;
+}
 
-  if (instance_.Get() == nullptr) {
-    return ustd::unexpected("Failed to retrieve instance");
-  }
+void Context::setPresentConfig(PresentConfig present_config)
+{
+  present_config_ = std::move(present_config);
+}
 
-  if (uses_surface_) {
-    surface_
-        = wgpu::Surface::Acquire(glfwGetWGPUSurface(instance_.Get(), window_));
+static double elapsed_ms(std::chrono::steady_clock::time_point since)
+{
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - since)
+      .count();
+}
 
-    if (surface_->Get() == nullptr) {
-      return ustd::unexpected("Failed to retrieve surface");
+ustd::result Context::initializeDevice(const wgpu::Surface *compatible_surface)
+{
+  RNDR_TRACE_ZONE("Context::initializeDevice");
+
+  auto phase_start = std::chrono::steady_clock::now();
+
+  if (!instance_) {
+    wgpu::InstanceDescriptor instance_desc      = {};
+    instance_desc.features.timedWaitAnyEnable   = true;
+    instance_desc.features.timedWaitAnyMaxCount = 8;
+    instance_ = CreateInstance(&instance_desc);
+
+    if (instance_.Get() == nullptr) {
+      return ustd::unexpected("Failed to retrieve instance");
     }
+
+    timings_.instance_ms = elapsed_ms(phase_start);
+    phase_start          = std::chrono::steady_clock::now();
   }
 
-  /* Request adapter */
+  /* Request adapter. The surface usually does not exist yet, so its
+   * compatibility is checked once it does, in `initializeSurface()`. */
   wgpu::RequestAdapterOptions adapter_opts = {};
-  adapter_opts.powerPreference   = wgpu::PowerPreference::HighPerformance;
-  adapter_opts.compatibleSurface = surface_ ? *surface_ : nullptr;
-
-  wgpu::Adapter adapter_;
+  adapter_opts.powerPreference = wgpu::PowerPreference::HighPerformance;
+  adapter_opts.forceFallbackAdapter = force_fallback_;
+  if (compatible_surface != nullptr) {
+    adapter_opts.compatibleSurface = *compatible_surface;
+  }
 
-  auto          adapter_req_callback
-      = [&adapter_](wgpu::RequestAdapterStatus status, wgpu::Adapter adapter,
-                    char const *message) {
+  auto adapter_req_callback
+      = [this](wgpu::RequestAdapterStatus status, wgpu::Adapter adapter,
+               char const *message) {
           if (status != wgpu::RequestAdapterStatus::Success) {
             std::cerr << "ADAPTER REQUEST FAILED WITH MESSAGE: " << message
                       << std::endl;
@@ -97,10 +132,13 @@ ustd::result Context::initializeWebGPU()
           adapter_ = std::move(adapter);
         };
 
-  wgpu::Future adapter_wait_future = instance_.RequestAdapter(
-      &adapter_opts, wgpu::CallbackMode::AllowProcessEvents,
-      adapter_req_callback);
-  blockOnFuture(adapter_wait_future);
+  {
+    RNDR_TRACE_ZONE("Context::requestAdapter");
+    wgpu::Future adapter_wait_future = instance_.RequestAdapter(
+        &adapter_opts, wgpu::CallbackMode::AllowProcessEvents,
+        adapter_req_callback);
+    blockOnFuture(adapter_wait_future);
+  }
 
   if (adapter_.Get() == nullptr) {
     return ustd::unexpected("Failed to retrieve adapter");
@@ -130,6 +168,9 @@ ustd::result Context::initializeWebGPU()
     return ustd::unexpected("Cannot support required limits");
   }
 
+  timings_.adapter_ms = elapsed_ms(phase_start);
+  phase_start         = std::chrono::steady_clock::now();
+
   /* Request device */
   wgpu::DeviceDescriptor device_desc = {};
   device_desc.requiredFeatures       = features_.data();
@@ -143,18 +184,21 @@ ustd::result Context::initializeWebGPU()
 
   device_desc.deviceLostCallbackInfo = lost_cb_info;
 
-  std::string  error_msg;
-  wgpu::Future device_future = adapter_.RequestDevice(
-      &device_desc, wgpu::CallbackMode::AllowProcessEvents,
-      [&](wgpu::RequestDeviceStatus status, wgpu::Device device,
-          char const *message) {
-        if (status != wgpu::RequestDeviceStatus::Success) {
-          error_msg = message;
-        }
-        device_ = std::move(device);
-      });
+  std::string error_msg;
+  {
+    RNDR_TRACE_ZONE("Context::requestDevice");
+    wgpu::Future device_future = adapter_.RequestDevice(
+        &device_desc, wgpu::CallbackMode::AllowProcessEvents,
+        [&](wgpu::RequestDeviceStatus status, wgpu::Device device,
+            char const *message) {
+          if (status != wgpu::RequestDeviceStatus::Success) {
+            error_msg = message;
+          }
+          device_ = std::move(device);
+        });
 
-  blockOnFuture(device_future);
+    blockOnFuture(device_future);
+  }
 
   if (device_.Get() == nullptr) {
     return ustd::unexpected("Failed to retrieve device");
@@ -169,23 +213,98 @@ ustd::result Context::initializeWebGPU()
 
   queue_ = getDevice().GetQueue();
 
-  /* configure surface */
+  /* the device may grant better than the defaults we asked for */
+  wgpu::SupportedLimits device_limits = {};
+  device_.GetLimits(&device_limits);
+  limits_            = device_limits.limits;
+
+  timings_.device_ms = elapsed_ms(phase_start);
+
+  return {};
+}
+
+ustd::result Context::initializeSurface()
+{
+  RNDR_TRACE_ZONE("Context::initializeSurface");
+
+  auto phase_start = std::chrono::steady_clock::now();
+
+  surface_
+      = wgpu::Surface::Acquire(glfwGetWGPUSurface(instance_.Get(), window_));
+
+  if (surface_->Get() == nullptr) {
+    return ustd::unexpected("Failed to retrieve surface");
+  }
+
+  /* the adapter was picked without the surface, so make sure it can present */
+  wgpu::SurfaceCapabilities capabilities = {};
+  auto                      can_present  = [&] {
+    return surface_->GetCapabilities(adapter_, &capabilities)
+               == wgpu::Status::Success
+           && capabilities.formatCount != 0;
+  };
+
+  if (!can_present()) {
+    /* on multi-adapter systems it may not, so pick one with the surface */
+    queue_   = {};
+    device_  = {};
+    adapter_ = {};
+    features_.clear();
+
+    if (auto result = initializeDevice(&*surface_); !result) {
+      return result;
+    }
+    if (!can_present()) {
+      return ustd::unexpected("Adapter cannot present to the window surface");
+    }
+  }
+
+  surface_format_ = helpers::choose_surface_format(
+      present_config_.formats,
+      {capabilities.formats, capabilities.formatCount});
+  present_mode_   = helpers::choose_present_mode(
+      present_config_.present_modes,
+      {capabilities.presentModes, capabilities.presentModeCount});
+
+  /* the framebuffer is larger than the window on high-DPI displays */
+  glfwGetFramebufferSize(window_, &width_, &height_);
+  resizeSurface(width_, height_);
+  configureSurface();
+
+  timings_.surface_ms = elapsed_ms(phase_start);
+
+  return {};
+}
+
+void Context::configureSurface()
+{
+  RNDR_TRACE_ZONE("Context::configureSurface");
+
+  surface_dirty_.store(false, std::memory_order_relaxed);
+  uint64_t size = surface_size_.load(std::memory_order_acquire);
+  width_        = static_cast<int>(size >> 32);
+  height_       = static_cast<int>(size & 0xffffffff);
+  if (width_ <= 0 || height_ <= 0) {
+    return;
+  }
+
   wgpu::SurfaceConfiguration surface_config;
   surface_config.device      = device_;
-  surface_config.format      = wgpu::TextureFormat::BGRA8Unorm;
+  surface_config.format      = surface_format_;
   surface_config.width       = width_;
   surface_config.height      = height_;
-  surface_config.presentMode = wgpu::PresentMode::Fifo;
+  surface_config.presentMode = present_mode_;
 
-  if (uses_surface_) {
-    surface_->Configure(&surface_config);
-  }
-
-  return {};
+  /* frames already submitted keep their textures, nothing waits on them */
+  surface_->Configure(&surface_config);
 }
 
 ustd::result Context::initializeGLFW()
 {
+  RNDR_TRACE_ZONE("Context::initializeGLFW");
+
+  auto phase_start = std::chrono::steady_clock::now();
+
   /* GLFW init */
   glfwInitHint(GLFW_CLIENT_API, GLFW_NO_API);
   glfwInit();
@@ -195,29 +314,95 @@ ustd::result Context::initializeGLFW()
     return ustd::unexpected("Failed to create GLFW window");
   }
 
+  glfwSetWindowUserPointer(window_, this);
+  glfwSetFramebufferSizeCallback(window_,
+                                 [](GLFWwindow *window, int width, int height) {
+                                   auto *context = static_cast<Context *>(
+                                       glfwGetWindowUserPointer(window));
+                                   context->resizeSurface(width, height);
+                                 });
+
+  timings_.window_ms = elapsed_ms(phase_start);
+
   return {};
 }
 
 ustd::result Context::initialize(int width, int height)
 {
-  width_  = width;
-  height_ = height;
+  RNDR_TRACE_ZONE("Context::initialize");
+
+  if (auto result = beginInitialize(width, height); !result) {
+    return result;
+  }
+
+  return finishInitialize();
+}
+
+ustd::result Context::beginInitialize(int width, int height)
+{
+  RNDR_TRACE_ZONE("Context::beginInitialize");
+
+  if (initialized_ || device_init_.valid()) {
+    return ustd::unexpected("Context initialization was already started");
+  }
+
+  init_start_ = std::chrono::steady_clock::now();
+  width_      = width;
+  height_     = height;
+
+  /* nothing in the device request touches the window, so let it overlap with
+   * GLFW, which must stay on this thread */
+  device_init_ = std::async(std::launch::async,
+                            [this] { return initializeDevice(); });
+
+  if (uses_surface_) {
+    return initializeGLFW();
+  }
+
+  return {};
+}
+
+ustd::result Context::finishInitialize()
+{
+  RNDR_TRACE_ZONE("Context::finishInitialize");
+
+  if (!device_init_.valid()) {
+    return ustd::unexpected("Context initialization was not started");
+  }
+
+  auto         wait_start    = std::chrono::steady_clock::now();
+  ustd::result device_result = device_init_.get();
+  timings_.device_wait_ms    = elapsed_ms(wait_start);
+
+  if (!device_result) {
+    return device_result;
+  }
 
   if (uses_surface_) {
-    if (auto result = initializeGLFW(); !result) {
+    if (window_ == nullptr) {
+      return ustd::unexpected("Cannot create a surface without a window");
+    }
+
+    if (auto result = initializeSurface(); !result) {
       return result;
     }
   }
 
-  if (auto result = initializeWebGPU(); !result) {
-    return result;
-  }
+  /* an adapter is spent once it made a device, and the surface's
+   * capabilities, the last thing to need it, were queried above */
+  adapter_          = {};
 
-  initialized_ = true;
+  timings_.total_ms = elapsed_ms(init_start_);
+  initialized_      = true;
 
   return {};
 }
 
+const Context::InitTimings &Context::getInitTimings() const
+{
+  return timings_;
+}
+
 bool Context::blockOnFuture(wgpu::Future future)
 {
   assert(instance_.Get() != nullptr);
@@ -250,7 +435,217 @@ void Context::blockOnSubmittedWork()
 
 void Context::processEvents()
 {
+  RNDR_TRACE_ZONE("Context::processEvents");
+
+  /* a callback that ends up back here must not run the others mid-update */
+  if (in_events_) {
+    return;
+  }
+  in_events_ = true;
+
   instance_.ProcessEvents();
+
+  /* indexed, as a callback may register another */
+  for (size_t i = 0; i < event_callbacks_.size(); ++i) {
+    event_callbacks_[i].second();
+  }
+
+  destroyRetired();
+  memory_.checkBudgets();
+
+  in_events_ = false;
+}
+
+wgpu::TextureFormat Context::getSurfaceFormat() const
+{
+  return surface_format_;
+}
+
+wgpu::PresentMode Context::getPresentMode() const
+{
+  return present_mode_;
+}
+
+void Context::resizeSurface(int width, int height)
+{
+  uint64_t size = uint64_t{static_cast<uint32_t>(width)} << 32
+                  | static_cast<uint32_t>(height);
+  surface_size_.store(size, std::memory_order_release);
+  surface_dirty_.store(true, std::memory_order_release);
+}
+
+ustd::expected<wgpu::Texture> Context::acquireFrame()
+{
+  RNDR_TRACE_ZONE("Context::acquireFrame");
+
+  if (!surface_) {
+    return ustd::unexpected("Context was not configured to use a surface.");
+  }
+
+  /* let the CPU run at most `max_frame_latency` frames ahead of the GPU */
+  auto wait_start = std::chrono::steady_clock::now();
+  while (present_config_.max_frame_latency > 0
+         && in_flight_.size() >= present_config_.max_frame_latency) {
+    auto &[future, done] = in_flight_.front();
+    /* a frame may take longer than any one wait, e.g. on a hitch, so keep
+     * waiting until it is done rather than letting it through */
+    while (!*done) {
+      constexpr uint64_t   timeout_ns = 100'000'000;
+      wgpu::FutureWaitInfo wait_info{future};
+      wgpu::WaitStatus     status = instance_.WaitAny(1, &wait_info, timeout_ns);
+      if (wait_info.completed || status != wgpu::WaitStatus::TimedOut) {
+        break;
+      }
+    }
+    in_flight_.pop_front();
+  }
+  present_stats_.wait_ms = elapsed_ms(wait_start);
+
+  /* an out of date surface gets one reconfiguration per frame */
+  for (int attempt = 0; attempt < 2; ++attempt) {
+    if (surface_dirty_.load(std::memory_order_acquire)) {
+      configureSurface();
+      ++present_stats_.reconfigures;
+    }
+
+    /* minimized */
+    if (width_ <= 0 || height_ <= 0) {
+      return wgpu::Texture{};
+    }
+
+    wgpu::SurfaceTexture surface_texture;
+    surface_->GetCurrentTexture(&surface_texture);
+
+    switch (surface_texture.status) {
+    case wgpu::SurfaceGetCurrentTextureStatus::Success:
+      /* still presentable, but no longer a perfect fit for the window */
+      if (surface_texture.suboptimal) {
+        surface_dirty_.store(true, std::memory_order_relaxed);
+      }
+      acquired_at_   = std::chrono::steady_clock::now();
+      acquired_      = true;
+      return surface_texture.texture;
+    case wgpu::SurfaceGetCurrentTextureStatus::Timeout:
+      return wgpu::Texture{};
+    case wgpu::SurfaceGetCurrentTextureStatus::Outdated:
+    case wgpu::SurfaceGetCurrentTextureStatus::Lost:
+      surface_dirty_.store(true, std::memory_order_relaxed);
+      break;
+    default:
+      return ustd::unexpected(
+          "Surface did not provide next texture. "
+          "SurfaceGetCurrentTextureStatus:"
+          + std::to_string(static_cast<uint32_t>(surface_texture.status)));
+    }
+  }
+
+  return ustd::unexpected("Surface is still out of date after reconfiguring");
+}
+
+void Context::present()
+{
+  if (!surface_ || !acquired_) {
+    return;
+  }
+
+  /* frame N - max_frame_latency is waited on before acquiring frame N */
+  if (present_config_.max_frame_latency > 0) {
+    auto         done   = std::make_shared<bool>(false);
+    wgpu::Future future = queue_.OnSubmittedWorkDone(
+        wgpu::CallbackMode::AllowProcessEvents,
+        [done](wgpu::QueueWorkDoneStatus) { *done = true; });
+    in_flight_.emplace_back(future, std::move(done));
+  }
+
+  surface_->Present();
+  acquired_               = false;
+
+  double ms               = elapsed_ms(acquired_at_);
+  present_stats_.last_ms  = ms;
+  present_stats_.max_ms   = std::max(present_stats_.max_ms, ms);
+  present_stats_.avg_ms  += (ms - present_stats_.avg_ms)
+                           / static_cast<double>(++present_stats_.frames);
+}
+
+const Context::PresentStats &Context::getPresentStats() const
+{
+  return present_stats_;
+}
+
+void Context::destroyLater(TrackedBuffer buffer)
+{
+  if (buffer) {
+    retiring_.buffers.push_back(std::move(buffer));
+  }
+}
+
+void Context::destroyLater(TrackedTexture texture)
+{
+  if (texture) {
+    retiring_.textures.push_back(std::move(texture));
+  }
+}
+
+void Context::destroyLater(TrackedQuerySet query_set)
+{
+  if (query_set) {
+    retiring_.query_sets.push_back(std::move(query_set));
+  }
+}
+
+size_t Context::getPendingDestroyCount() const
+{
+  size_t count = retiring_.size();
+  for (const Retired &retired : retired_) {
+    count += retired.size();
+  }
+  return count;
+}
+
+void Context::destroyRetired()
+{
+  RNDR_TRACE_ZONE("Context::destroyRetired");
+
+  /* batches complete in submission order */
+  auto done = std::find_if(retired_.begin(), retired_.end(),
+                           [](const Retired &r) { return !*r.done; });
+  for (auto it = retired_.begin(); it != done; ++it) {
+    for (TrackedBuffer &buffer : it->buffers) {
+      buffer.Destroy();
+    }
+    for (TrackedTexture &texture : it->textures) {
+      texture.Destroy();
+    }
+    for (TrackedQuerySet &query_set : it->query_sets) {
+      query_set.Destroy();
+    }
+  }
+  retired_.erase(retired_.begin(), done);
+
+  if (retiring_.size() == 0 || !queue_) {
+    return;
+  }
+
+  /* seal everything released so far behind the work submitted so far */
+  retiring_.done = std::make_shared<bool>(false);
+  queue_.OnSubmittedWorkDone(
+      wgpu::CallbackMode::AllowProcessEvents,
+      [done = retiring_.done](wgpu::QueueWorkDoneStatus) { *done = true; });
+  retired_.push_back(std::move(retiring_));
+  retiring_ = {};
+}
+
+uint32_t Context::addEventCallback(EventCallback callback)
+{
+  uint32_t id = next_callback_id_++;
+  event_callbacks_.emplace_back(id, std::move(callback));
+  return id;
+}
+
+void Context::removeEventCallback(uint32_t id)
+{
+  std::erase_if(event_callbacks_,
+                [id](const auto &callback) { return callback.first == id; });
 }
 
 bool Context::isInitialized()
@@ -263,6 +658,31 @@ const wgpu::Device &Context::getDevice()
   return device_;
 }
 
+MemoryTracker &Context::getMemoryTracker()
+{
+  return memory_;
+}
+
+TrackedBuffer Context::createBuffer(const wgpu::BufferDescriptor &desc,
+                                    MemoryCategory                category)
+{
+  return {device_.CreateBuffer(&desc), memory_.track(category, desc.size)};
+}
+
+TrackedTexture Context::createTexture(const wgpu::TextureDescriptor &desc,
+                                      MemoryCategory                 category)
+{
+  return {device_.CreateTexture(&desc),
+          memory_.track(category, MemoryTracker::textureBytes(desc))};
+}
+
+TrackedQuerySet Context::createQuerySet(const wgpu::QuerySetDescriptor &desc)
+{
+  /* every query resolves to a 64-bit value */
+  return {device_.CreateQuerySet(&desc),
+          memory_.track(MemoryCategory::Query, uint64_t{desc.count} * 8)};
+}
+
 const wgpu::Queue &Context::getQueue()
 {
   return queue_;
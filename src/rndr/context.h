@@ -12,9 +12,16 @@
 #ifndef RNDR_CONTEXT_H_
 #define RNDR_CONTEXT_H_
 
+#include "rndr/memory/memory_tracker.h"
 #include "ustd/expected.h"
 
 #include <GLFW/glfw3.h>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
 #include <optional>
 #include <vector>
 #include <webgpu/webgpu_cpp.h>
@@ -23,6 +30,43 @@ namespace rndr {
 
 class Context {
 public:
+  using EventCallback = std::function<void()>;
+
+  /* wall time of each startup phase, in milliseconds */
+  struct InitTimings {
+    double window_ms      = 0.0;
+    double instance_ms    = 0.0;
+    double adapter_ms     = 0.0;
+    double device_ms      = 0.0;
+    double surface_ms     = 0.0;
+    /* time `finishInitialize()` spent waiting on the device request */
+    double device_wait_ms = 0.0;
+    double total_ms       = 0.0;
+  };
+
+  /* how the surface presents, negotiated against its capabilities */
+  struct PresentConfig {
+    /* the first one the surface supports wins, else `Fifo`, which it must */
+    std::vector<wgpu::PresentMode>   present_modes = {wgpu::PresentMode::Fifo};
+    /* the first one the surface supports wins, else its preferred format */
+    std::vector<wgpu::TextureFormat> formats
+        = {wgpu::TextureFormat::BGRA8Unorm, wgpu::TextureFormat::RGBA8Unorm};
+    /* frames the CPU may run ahead, `acquireFrame()` waits on the work of
+     * frame N - this first: 0 leaves it to the driver, 1 is the lowest */
+    uint32_t                         max_frame_latency = 0;
+  };
+
+  /* acquire-to-present time of presented frames, in milliseconds */
+  struct PresentStats {
+    uint64_t frames       = 0;
+    double   last_ms      = 0.0;
+    double   avg_ms       = 0.0;
+    double   max_ms       = 0.0;
+    /* time the last `acquireFrame()` waited on the frame latency limit */
+    double   wait_ms      = 0.0;
+    uint32_t reconfigures = 0;
+  };
+
   /**
    * @brief Set the required features. Call this before a call to `initialize`.
    */
@@ -37,6 +81,19 @@ public:
    */
   void setRequiredLimits(wgpu::Limits required_limits);
 
+  /**
+   * @brief Request Dawn's CPU fallback adapter, e.g. to run GPU tests on
+   * machines without a GPU. Call this before a call to `initialize`.
+   */
+  void setForceFallbackAdapter(bool force_fallback_adapter);
+
+  /**
+   * @brief Set the preferred present modes and surface formats, e.g.
+   * `{Mailbox, Immediate, Fifo}` for low latency. Call this before a call to
+   * `initialize`.
+   */
+  void setPresentConfig(PresentConfig present_config);
+
   /**
    * @brief Initialize all global WebGPU and GLFW objects.
    *
@@ -47,7 +104,23 @@ public:
    * @param height Initial height of the screen, in pixels
    */
   [[nodiscard]] ustd::result initialize(int width = 640, int height = 480);
+
+  /**
+   * @brief Start initialization without waiting for the device. The instance,
+   * adapter and device are requested on a background thread while the window
+   * is created on the calling thread, which must be the main thread.
+   *
+   * The application is free to do other work, such as loading assets, until
+   * it calls `finishInitialize()`. `initialize()` is the two back to back.
+   */
+  [[nodiscard]] ustd::result beginInitialize(int width  = 640,
+                                             int height = 480);
+
+  /* wait for the device, then create and configure the surface */
+  [[nodiscard]] ustd::result finishInitialize();
+
   bool                       isInitialized();
+  const InitTimings         &getInitTimings() const;
 
   const wgpu::Device        &getDevice();
   const wgpu::Limits        &getLimits();
@@ -58,16 +131,82 @@ public:
 
   bool                                  hasFeature(wgpu::FeatureName feature);
 
+  /* the negotiated surface format, `BGRA8Unorm` without a surface */
+  wgpu::TextureFormat                   getSurfaceFormat() const;
+  wgpu::PresentMode                     getPresentMode() const;
+
+  /**
+   * @brief Have the surface follow a new framebuffer size. It is reconfigured
+   * on the next `acquireFrame()`, without waiting for the device to go idle.
+   * The GLFW window calls this itself when it is resized. Safe to call while
+   * another thread renders, see `RenderThread`.
+   */
+  void                                  resizeSurface(int width, int height);
+
+  /**
+   * @brief Wait on the frame latency limit, then get the surface texture to
+   * render this frame into, reconfiguring the surface first if it was resized
+   * or went out of date.
+   *
+   * @return the texture, or a null texture if there is nothing to present to,
+   * e.g. while the window is minimized, in which case skip the frame
+   */
+  [[nodiscard]] ustd::expected<wgpu::Texture> acquireFrame();
+
+  /* present the texture of the last `acquireFrame()`, after submitting to it */
+  void                                  present();
+
+  const PresentStats                   &getPresentStats() const;
+
+  /* live and peak device memory of everything created through the below */
+  MemoryTracker                        &getMemoryTracker();
+
+  /* create an object whose memory is accounted for under `category` */
+  TrackedBuffer   createBuffer(const wgpu::BufferDescriptor &desc,
+                               MemoryCategory                category);
+  TrackedTexture  createTexture(const wgpu::TextureDescriptor &desc,
+                                MemoryCategory                 category
+                                = MemoryCategory::Texture);
+  TrackedQuerySet createQuerySet(const wgpu::QuerySetDescriptor &desc);
+
+  /**
+   * @brief Destroy a resource once the GPU has finished all work submitted
+   * before the next `processEvents()`, from a later `processEvents()`. Its
+   * memory stays accounted for until then. Nothing ever blocks on this.
+   */
+  void            destroyLater(TrackedBuffer buffer);
+  void            destroyLater(TrackedTexture texture);
+  void            destroyLater(TrackedQuerySet query_set);
+
+  /* resources handed to `destroyLater()` and not yet destroyed */
+  size_t          getPendingDestroyCount() const;
+
   /* returns true if the blocked future is completed */
   bool         blockOnFuture(wgpu::Future future);
 
   wgpu::Future getSubmittedWorkFuture();
   void         blockOnSubmittedWork();
 
+  /**
+   * @brief Process WebGPU callbacks, run every event callback, destroy the
+   * resources whose work has completed, then call the callbacks of memory
+   * budgets that are exceeded. Does nothing when called from within itself.
+   */
   void         processEvents();
 
+  /**
+   * @brief Register `callback` to run at the end of every `processEvents()`,
+   * which lets subsystems finish asynchronous work on the calling thread.
+   *
+   * @return id to remove the callback with
+   */
+  uint32_t     addEventCallback(EventCallback callback);
+  void         removeEventCallback(uint32_t id);
+
 protected:
   wgpu::Instance               instance_ = {};
+  /* released once initialized, see `finishInitialize()` */
+  wgpu::Adapter                adapter_  = {};
   wgpu::Device                 device_   = {};
   wgpu::Queue                  queue_    = {};
 
@@ -85,11 +224,57 @@ protected:
   int                            height_            = 0;
 
 private:
-  ustd::result initializeWebGPU();
+  /* resources released between two `processEvents()` */
+  struct Retired {
+    std::vector<TrackedBuffer>   buffers    = {};
+    std::vector<TrackedTexture>  textures   = {};
+    std::vector<TrackedQuerySet> query_sets = {};
+    /* set once the work submitted before the batch was sealed completes */
+    std::shared_ptr<bool>        done       = {};
+
+    size_t                       size() const
+    {
+      return buffers.size() + textures.size() + query_sets.size();
+    }
+  };
+
+  void         destroyRetired();
+  void         configureSurface();
+
+  /* requests an adapter able to present to `compatible_surface`, if given */
+  ustd::result initializeDevice(const wgpu::Surface *compatible_surface
+                                = nullptr);
+  ustd::result initializeSurface();
   ustd::result initializeGLFW();
 
-  const bool   uses_surface_;
-  bool         initialized_ = false;
+  const bool                                      uses_surface_;
+  bool                                            initialized_      = false;
+  bool                                            force_fallback_   = false;
+
+  PresentConfig                                   present_config_   = {};
+  wgpu::TextureFormat surface_format_ = wgpu::TextureFormat::BGRA8Unorm;
+  wgpu::PresentMode   present_mode_   = wgpu::PresentMode::Fifo;
+  /* written by `resizeSurface()` from any thread, width in the high half */
+  std::atomic<uint64_t>                           surface_size_     = 0;
+  std::atomic<bool>                               surface_dirty_    = false;
+  std::chrono::steady_clock::time_point           acquired_at_      = {};
+  bool                                            acquired_         = false;
+  /* set once the work of each frame still in flight completes */
+  std::deque<std::pair<wgpu::Future, std::shared_ptr<bool>>> in_flight_ = {};
+  PresentStats                                    present_stats_    = {};
+
+  MemoryTracker                                   memory_           = {};
+  Retired                                         retiring_         = {};
+  std::vector<Retired>                            retired_          = {};
+
+  std::vector<std::pair<uint32_t, EventCallback>> event_callbacks_  = {};
+  uint32_t                                        next_callback_id_ = 0;
+  /* set while `processEvents()` runs, so that it never nests */
+  bool                                            in_events_        = false;
+
+  std::future<ustd::result>                       device_init_      = {};
+  std::chrono::steady_clock::time_point           init_start_       = {};
+  InitTimings                                     timings_          = {};
 };
 
 class GlobalAccess {
@@ -0,0 +1,320 @@
+/**
+ * @file job_system.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "job_system.h"
+#include "rndr/profiling/trace.h"
+
+#include <cassert>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace rndr {
+
+namespace {
+
+/* identifies the worker, if any, that the calling thread is */
+thread_local const JobSystem *tls_system       = nullptr;
+thread_local int              tls_worker_index = -1;
+
+void                          cpu_relax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield");
+#endif
+}
+
+void pin_thread(std::thread &thread, uint32_t cpu)
+{
+#ifdef __linux__
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(cpu, &cpus);
+  pthread_setaffinity_np(thread.native_handle(), sizeof(cpus), &cpus);
+#else
+  (void)thread;
+  (void)cpu;
+#endif
+}
+
+} // namespace
+
+JobSystem::JobSystem() : JobSystem(Config{})
+{
+}
+
+JobSystem::JobSystem(Config config)
+    : config_(std::move(config)), main_thread_(std::this_thread::get_id())
+{
+  uint32_t worker_count = config_.worker_count;
+  if (worker_count == 0) {
+    worker_count = std::max(1u, std::thread::hardware_concurrency()) - 1;
+  }
+
+  for (uint32_t i = 0; i < worker_count; ++i) {
+    workers_.push_back(std::make_unique<Worker>(config_.deque_capacity));
+  }
+
+  /* start threads only once every deque exists, as they steal from each
+   * other right away */
+  for (uint32_t i = 0; i < worker_count; ++i) {
+    workers_[i]->thread = std::thread(&JobSystem::workerLoop, this, i);
+    if (!config_.cpu_affinity.empty()) {
+      pin_thread(workers_[i]->thread,
+                 config_.cpu_affinity[i % config_.cpu_affinity.size()]);
+    }
+  }
+}
+
+JobSystem::~JobSystem()
+{
+  {
+    std::lock_guard lock(sleep_mutex_);
+    stop_.store(true);
+  }
+  wake_.notify_all();
+
+  for (auto &worker : workers_) {
+    worker->thread.join();
+  }
+
+  /* jobs nobody got to are dropped */
+  for (auto &worker : workers_) {
+    while (auto job = worker->deque.pop()) {
+      delete *job;
+    }
+  }
+  for (Job *job : inject_) {
+    delete job;
+  }
+  for (Job *job : main_queue_) {
+    delete job;
+  }
+}
+
+void JobSystem::run(Function function, Counter *counter)
+{
+  if (counter != nullptr) {
+    counter->pending_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  Job *job = new Job{std::move(function), counter};
+
+  if (workers_.empty()) {
+    other_jobs_.fetch_add(1, std::memory_order_relaxed);
+    execute(job);
+    return;
+  }
+
+  int index = currentWorkerIndex();
+  if (index < 0 || !workers_[index]->deque.push(job)) {
+    std::lock_guard lock(inject_mutex_);
+    inject_.push_back(job);
+  }
+
+  queued_.fetch_add(1, std::memory_order_seq_cst);
+  if (sleepers_.load(std::memory_order_seq_cst) > 0) {
+    /* taking the lock orders this with a worker about to sleep */
+    { std::lock_guard lock(sleep_mutex_); }
+    wake_.notify_one();
+  }
+}
+
+void JobSystem::runOnMainThread(Function function, Counter *counter)
+{
+  if (counter != nullptr) {
+    counter->pending_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  std::lock_guard lock(main_mutex_);
+  main_queue_.push_back(new Job{std::move(function), counter});
+}
+
+void JobSystem::wait(Counter &counter)
+{
+  RNDR_TRACE_ZONE("JobSystem::wait");
+
+  int  index     = currentWorkerIndex();
+  bool main_wait = isMainThread();
+
+  while (!counter.done()) {
+    /* the main thread may be waiting on its own queue */
+    if (main_wait && drainMainThread() > 0) {
+      continue;
+    }
+
+    if (!tryExecuteOne(index)) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+size_t JobSystem::drainMainThread()
+{
+  assert(isMainThread());
+
+  std::vector<Job *> jobs;
+  {
+    std::lock_guard lock(main_mutex_);
+    jobs.swap(main_queue_);
+  }
+
+  for (Job *job : jobs) {
+    execute(job);
+  }
+
+  main_jobs_.fetch_add(jobs.size(), std::memory_order_relaxed);
+  return jobs.size();
+}
+
+uint32_t JobSystem::getWorkerCount() const
+{
+  return static_cast<uint32_t>(workers_.size());
+}
+
+bool JobSystem::isMainThread() const
+{
+  return std::this_thread::get_id() == main_thread_;
+}
+
+JobSystem::Stats JobSystem::getStats() const
+{
+  Stats stats;
+  stats.main_thread_jobs = main_jobs_.load(std::memory_order_relaxed);
+  stats.jobs_executed    = other_jobs_.load(std::memory_order_relaxed);
+
+  for (const auto &worker : workers_) {
+    stats.jobs_executed += worker->executed.load(std::memory_order_relaxed);
+    stats.jobs_stolen += worker->stolen.load(std::memory_order_relaxed);
+    stats.idle_spins += worker->spins.load(std::memory_order_relaxed);
+    stats.sleeps += worker->sleeps.load(std::memory_order_relaxed);
+  }
+
+  return stats;
+}
+
+void JobSystem::workerLoop(uint32_t index)
+{
+  tls_system       = this;
+  tls_worker_index = static_cast<int>(index);
+  Worker &worker   = *workers_[index];
+
+  while (!stop_.load(std::memory_order_relaxed)) {
+    if (tryExecuteOne(index)) {
+      continue;
+    }
+
+    bool found = false;
+    for (uint32_t spin = 0; spin < config_.spin_count && !found; ++spin) {
+      cpu_relax();
+      found = tryExecuteOne(index);
+      if (!found) {
+        worker.spins.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+
+    if (found) {
+      continue;
+    }
+
+    std::unique_lock lock(sleep_mutex_);
+    sleepers_.fetch_add(1, std::memory_order_seq_cst);
+    worker.sleeps.fetch_add(1, std::memory_order_relaxed);
+    wake_.wait(lock, [this] {
+      return stop_.load(std::memory_order_relaxed)
+             || queued_.load(std::memory_order_seq_cst) > 0;
+    });
+    sleepers_.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
+bool JobSystem::tryExecuteOne(int worker_index)
+{
+  bool stolen = false;
+  Job *job    = findJob(worker_index, stolen);
+  if (job == nullptr) {
+    return false;
+  }
+
+  queued_.fetch_sub(1, std::memory_order_relaxed);
+
+  if (worker_index >= 0) {
+    Worker &worker = *workers_[worker_index];
+    worker.executed.fetch_add(1, std::memory_order_relaxed);
+    if (stolen) {
+      worker.stolen.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  else {
+    other_jobs_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  execute(job);
+  return true;
+}
+
+JobSystem::Job *JobSystem::findJob(int worker_index, bool &stolen)
+{
+  if (worker_index >= 0) {
+    if (auto job = workers_[worker_index]->deque.pop()) {
+      return *job;
+    }
+  }
+
+  if (queued_.load(std::memory_order_relaxed) <= 0) {
+    return nullptr;
+  }
+
+  {
+    std::unique_lock lock(inject_mutex_, std::try_to_lock);
+    if (lock.owns_lock() && !inject_.empty()) {
+      Job *job = inject_.back();
+      inject_.pop_back();
+      return job;
+    }
+  }
+
+  /* start somewhere different per thief to spread contention */
+  size_t count = workers_.size();
+  size_t start = worker_index >= 0 ? worker_index + 1 : 0;
+  for (size_t i = 0; i < count; ++i) {
+    size_t victim = (start + i) % count;
+    if (static_cast<int>(victim) == worker_index) {
+      continue;
+    }
+    if (auto job = workers_[victim]->deque.steal()) {
+      stolen = true;
+      return *job;
+    }
+  }
+
+  return nullptr;
+}
+
+void JobSystem::execute(Job *job)
+{
+  job->function();
+  if (job->counter != nullptr) {
+    job->counter->pending_.fetch_sub(1, std::memory_order_acq_rel);
+  }
+  delete job;
+}
+
+int JobSystem::currentWorkerIndex() const
+{
+  return tls_system == this ? tls_worker_index : -1;
+}
+
+} // namespace rndr
@@ -0,0 +1,172 @@
+/**
+ * @file job_system.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_JOB_SYSTEM_H_
+#define RNDR_JOB_SYSTEM_H_
+
+#include "rndr/jobs/work_stealing_deque.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rndr {
+
+/**
+ * @brief Work-stealing scheduler shared by everything in `rndr` that runs in
+ * parallel.
+ *
+ * Each worker owns a `WorkStealingDeque`: jobs spawned from a worker go to the
+ * bottom of its own deque, and idle workers steal from the top of the others.
+ * Jobs spawned from any other thread go through a shared queue. Threads that
+ * `wait()` execute jobs themselves rather than block.
+ *
+ * Jobs that must run on the main thread, such as GLFW or surface calls, are
+ * queued with `runOnMainThread()` and run by `drainMainThread()`.
+ */
+class JobSystem {
+public:
+  using Function = std::function<void()>;
+
+  struct Config {
+    /* 0 uses one worker per hardware thread, minus the main thread */
+    uint32_t              worker_count   = 0;
+    /* on Linux, pins worker `i` to CPU `cpu_affinity[i % size]` */
+    std::vector<uint32_t> cpu_affinity   = {};
+    /* per-worker deque size, must be a power of two */
+    size_t                deque_capacity = 4096;
+    /* attempts to find work before an idle worker goes to sleep */
+    uint32_t              spin_count     = 256;
+  };
+
+  struct Stats {
+    uint64_t jobs_executed     = 0;
+    uint64_t jobs_stolen       = 0;
+    uint64_t main_thread_jobs  = 0;
+    /* failed attempts to find work while spinning */
+    uint64_t idle_spins        = 0;
+    uint64_t sleeps            = 0;
+  };
+
+  /**
+   * @brief Outstanding jobs of a group. A job spawned with the counter of the
+   * job spawning it keeps the counter above zero until it finishes too, so
+   * waiting on a parent's counter also waits on its children.
+   */
+  class Counter {
+  public:
+    bool done() const
+    {
+      return pending_.load(std::memory_order_acquire) == 0;
+    }
+
+  private:
+    friend class JobSystem;
+    std::atomic<uint32_t> pending_ = 0;
+  };
+
+  JobSystem();
+  JobSystem(Config config);
+  ~JobSystem();
+
+  JobSystem(const JobSystem &)            = delete;
+  JobSystem &operator=(const JobSystem &) = delete;
+
+  JobSystem(JobSystem &&)                 = delete;
+  JobSystem &operator=(JobSystem &&)      = delete;
+
+  void       run(Function function, Counter *counter = nullptr);
+  void       runOnMainThread(Function function, Counter *counter = nullptr);
+
+  /* execute jobs on this thread until `counter` reaches zero */
+  void       wait(Counter &counter);
+
+  /**
+   * @brief Call `function(begin, end)` over `[first, last)` in chunks of at
+   * most `grain` elements, spread over all workers. Returns once every chunk
+   * is done.
+   */
+  template <typename F>
+  void parallelFor(size_t first, size_t last, size_t grain, F &&function)
+  {
+    grain = std::max<size_t>(1, grain);
+
+    Counter counter;
+    for (size_t begin = first; begin < last; begin += grain) {
+      size_t end = std::min(last, begin + grain);
+      run([&function, begin, end] { function(begin, end); }, &counter);
+    }
+    wait(counter);
+  }
+
+  /* run the jobs queued for the main thread, from the main thread */
+  size_t   drainMainThread();
+
+  uint32_t getWorkerCount() const;
+  bool     isMainThread() const;
+  Stats    getStats() const;
+
+private:
+  struct Job {
+    Function function;
+    Counter *counter;
+  };
+
+  struct alignas(64) Worker {
+    explicit Worker(size_t capacity) : deque(capacity)
+    {
+    }
+
+    WorkStealingDeque<Job *> deque;
+    std::thread              thread;
+    std::atomic<uint64_t>    executed = 0;
+    std::atomic<uint64_t>    stolen   = 0;
+    std::atomic<uint64_t>    spins    = 0;
+    std::atomic<uint64_t>    sleeps   = 0;
+  };
+
+  void                                 workerLoop(uint32_t index);
+  bool                                 tryExecuteOne(int worker_index);
+  Job                                 *findJob(int worker_index, bool &stolen);
+  void                                 execute(Job *job);
+  int                                  currentWorkerIndex() const;
+
+  const Config                         config_;
+  const std::thread::id                main_thread_;
+  std::vector<std::unique_ptr<Worker>> workers_ = {};
+
+  std::mutex                           inject_mutex_ = {};
+  std::vector<Job *>                   inject_       = {};
+
+  std::mutex                           main_mutex_   = {};
+  std::vector<Job *>                   main_queue_   = {};
+  std::atomic<uint64_t>                main_jobs_    = 0;
+  /* jobs executed by threads that are not workers */
+  std::atomic<uint64_t>                other_jobs_   = 0;
+
+  /* jobs pushed but not yet taken, lets idle workers sleep */
+  std::atomic<int64_t>                 queued_       = 0;
+  std::atomic<uint32_t>                sleepers_     = 0;
+  std::mutex                           sleep_mutex_  = {};
+  std::condition_variable              wake_         = {};
+  std::atomic<bool>                    stop_         = false;
+};
+
+} // namespace rndr
+
+#endif
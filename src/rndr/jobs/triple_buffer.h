@@ -0,0 +1,92 @@
+/**
+ * @file triple_buffer.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_TRIPLE_BUFFER_H_
+#define RNDR_TRIPLE_BUFFER_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace rndr {
+
+/**
+ * @brief Lock-free single-producer single-consumer handoff of the latest
+ * value. Neither side ever waits: the producer fills its slot and publishes
+ * it, the consumer takes whatever was published last, and a value published
+ * over before it was taken is dropped.
+ *
+ * The three slots rotate between the producer, the consumer and the middle,
+ * which is swapped in one atomic exchange. Slots are reused, so a value
+ * holding containers keeps their capacity from three publishes ago.
+ */
+template <typename T> class TripleBuffer {
+public:
+  TripleBuffer()                                = default;
+
+  TripleBuffer(const TripleBuffer &)            = delete;
+  TripleBuffer &operator=(const TripleBuffer &) = delete;
+
+  TripleBuffer(TripleBuffer &&)                 = delete;
+  TripleBuffer &operator=(TripleBuffer &&)      = delete;
+
+  /* producer only, the slot to fill before `publish()` */
+  T   &write()
+  {
+    return slots_[back_];
+  }
+
+  /**
+   * @brief Producer only, hand the written slot to the consumer.
+   *
+   * @return true if the previously published value was never taken
+   */
+  bool publish()
+  {
+    uint8_t previous = middle_.exchange(back_ | fresh_bit,
+                                        std::memory_order_acq_rel);
+    back_            = previous & index_mask;
+    return previous & fresh_bit;
+  }
+
+  /* consumer only, take the latest value if one was published since */
+  bool acquire()
+  {
+    /* only the producer sets the bit, so it cannot clear before the swap */
+    if (!(middle_.load(std::memory_order_relaxed) & fresh_bit)) {
+      return false;
+    }
+
+    uint8_t previous = middle_.exchange(front_, std::memory_order_acq_rel);
+    front_           = previous & index_mask;
+    return true;
+  }
+
+  /* consumer only, the value of the last successful `acquire()` */
+  const T &read() const
+  {
+    return slots_[front_];
+  }
+
+private:
+  static constexpr uint8_t index_mask = 0x3;
+  /* set in the middle index while it holds a value not yet taken */
+  static constexpr uint8_t fresh_bit  = 0x4;
+
+  std::array<T, 3>                 slots_  = {};
+  alignas(64) std::atomic<uint8_t> middle_ = 1;
+  alignas(64) uint8_t              back_   = 0;
+  alignas(64) uint8_t              front_  = 2;
+};
+
+} // namespace rndr
+
+#endif
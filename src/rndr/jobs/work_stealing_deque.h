@@ -0,0 +1,135 @@
+/**
+ * @file work_stealing_deque.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_WORK_STEALING_DEQUE_H_
+#define RNDR_WORK_STEALING_DEQUE_H_
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace rndr {
+
+/**
+ * @brief Fixed-capacity Chase-Lev deque. The owning thread pushes and pops at
+ * the bottom, any other thread may steal from the top.
+ *
+ * Follows Lê et al., "Correct and Efficient Work-Stealing for Weak Memory
+ * Models" (PPoPP 2013), without growing the buffer: a full deque refuses the
+ * push and the caller decides where the item goes instead.
+ */
+template <typename T> class WorkStealingDeque {
+  static_assert(std::is_trivially_copyable_v<T>);
+
+public:
+  /* `capacity` must be a power of two */
+  explicit WorkStealingDeque(size_t capacity)
+      : mask_(static_cast<int64_t>(capacity) - 1), buffer_(capacity)
+  {
+    assert(capacity > 0 && (capacity & (capacity - 1)) == 0);
+  }
+
+  WorkStealingDeque(const WorkStealingDeque &)            = delete;
+  WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+
+  WorkStealingDeque(WorkStealingDeque &&)                 = delete;
+  WorkStealingDeque &operator=(WorkStealingDeque &&)      = delete;
+
+  /* owner only, returns false when full */
+  bool               push(T item)
+  {
+    int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    int64_t top    = top_.load(std::memory_order_acquire);
+    if (bottom - top > mask_) {
+      return false;
+    }
+
+    buffer_[bottom & mask_].store(item, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /* owner only, newest first */
+  std::optional<T> pop()
+  {
+    int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = top_.load(std::memory_order_relaxed);
+
+    if (top > bottom) {
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return std::nullopt;
+    }
+
+    T item = buffer_[bottom & mask_].load(std::memory_order_relaxed);
+    if (top == bottom) {
+      /* last item, race the thieves for it */
+      bool won = top_.compare_exchange_strong(top, top + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed);
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      if (!won) {
+        return std::nullopt;
+      }
+    }
+
+    return item;
+  }
+
+  /* any thread, oldest first */
+  std::optional<T> steal()
+  {
+    int64_t top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t bottom = bottom_.load(std::memory_order_acquire);
+
+    if (top >= bottom) {
+      return std::nullopt;
+    }
+
+    T item = buffer_[top & mask_].load(std::memory_order_relaxed);
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return std::nullopt;
+    }
+
+    return item;
+  }
+
+  /* racy snapshot, only exact while no other thread touches the deque */
+  size_t size() const
+  {
+    int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    int64_t top    = top_.load(std::memory_order_relaxed);
+    return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+  }
+
+  size_t capacity() const
+  {
+    return buffer_.size();
+  }
+
+private:
+  alignas(64) std::atomic<int64_t> top_    = 0;
+  alignas(64) std::atomic<int64_t> bottom_ = 0;
+  const int64_t                    mask_;
+  std::vector<std::atomic<T>>      buffer_;
+};
+
+} // namespace rndr
+
+#endif
@@ -45,6 +45,17 @@ public:
     return data_;
   }
 
+  /* the elements in storage order, without a copy, e.g. for `multiply_mat4` */
+  T *data()
+  {
+    return data_.data();
+  }
+
+  const T *data() const
+  {
+    return data_.data();
+  }
+
   template <size_t Dim>
   static constexpr size_t dim()
   {
@@ -11,6 +11,54 @@
 
 #include "ops.h"
 
+#if defined(__SSE__) || defined(_M_X64)
+#define RNDR_OPS_SSE
+#include <xmmintrin.h>
+#endif
+
 namespace rndr {
+namespace math {
+
+void multiply_mat4(const float *a, const float *b, float *out)
+{
+#ifdef RNDR_OPS_SSE
+  /* each column of `out` is the columns of `a` weighted by a column of `b` */
+  const __m128 a0 = _mm_loadu_ps(a);
+  const __m128 a1 = _mm_loadu_ps(a + 4);
+  const __m128 a2 = _mm_loadu_ps(a + 8);
+  const __m128 a3 = _mm_loadu_ps(a + 12);
+
+  for (int c = 0; c < 4; ++c) {
+    const float *col = b + c * 4;
+    __m128       sum = _mm_mul_ps(a0, _mm_set1_ps(col[0]));
+    sum              = _mm_add_ps(sum, _mm_mul_ps(a1, _mm_set1_ps(col[1])));
+    sum              = _mm_add_ps(sum, _mm_mul_ps(a2, _mm_set1_ps(col[2])));
+    sum              = _mm_add_ps(sum, _mm_mul_ps(a3, _mm_set1_ps(col[3])));
+    /* column `c` of `b` has been read in full, so `out` may alias it */
+    _mm_storeu_ps(out + c * 4, sum);
+  }
+#else
+  multiply_mat4_scalar(a, b, out);
+#endif
+}
+
+void multiply_mat4_scalar(const float *a, const float *b, float *out)
+{
+  float result[16];
+  for (int c = 0; c < 4; ++c) {
+    for (int r = 0; r < 4; ++r) {
+      float sum = 0.f;
+      for (int k = 0; k < 4; ++k) {
+        sum += a[k * 4 + r] * b[c * 4 + k];
+      }
+      result[c * 4 + r] = sum;
+    }
+  }
+
+  for (int i = 0; i < 16; ++i) {
+    out[i] = result[i];
+  }
+}
 
-} // namespace rndr
\ No newline at end of file
+} // namespace math
+} // namespace rndr
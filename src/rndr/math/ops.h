@@ -14,8 +14,37 @@
 #ifndef RNDR_OPS_H_
 #define RNDR_OPS_H_
 
+#include "matrix.h"
+
 namespace rndr {
+namespace math {
+
+/**
+ * @brief `out = a * b` for 4 x 4 matrices stored column-major, as WGSL lays
+ * out a `mat4x4f` and as uploaded `matrix<4, 4>` transforms are read, so
+ * `b` is applied first. `out` may alias `a` or `b`.
+ *
+ * Uses SSE where the target has it, else `multiply_mat4_scalar()`.
+ */
+void multiply_mat4(const float *a, const float *b, float *out);
 
+/* the portable fallback of `multiply_mat4()` */
+void multiply_mat4_scalar(const float *a, const float *b, float *out);
+
+/**
+ * @brief `a` after `b`, reading both as column-major transforms like the
+ * shaders do. In terms of `basic_tensor::operator*`, whose view of the same
+ * storage is row-major, this is `b * a`.
+ */
+inline matrix<4, 4> compose_column_major(const matrix<4, 4> &a,
+                                         const matrix<4, 4> &b)
+{
+  matrix<4, 4> out;
+  multiply_mat4(a.data(), b.data(), out.data());
+  return out;
 }
 
-#endif
\ No newline at end of file
+} // namespace math
+} // namespace rndr
+
+#endif
@@ -0,0 +1,356 @@
+/**
+ * @file buffer_allocator.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "buffer_allocator.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace rndr {
+
+static wgpu::BufferUsage class_usage(BufferClass buffer_class)
+{
+  /* CopySrc lets `defragment()` move ranges between blocks */
+  const wgpu::BufferUsage copy
+      = wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::CopySrc;
+
+  switch (buffer_class) {
+  case BufferClass::Vertex:
+    return wgpu::BufferUsage::Vertex | copy;
+  case BufferClass::Index:
+    return wgpu::BufferUsage::Index | copy;
+  case BufferClass::Uniform:
+    return wgpu::BufferUsage::Uniform | copy;
+  case BufferClass::Storage:
+    return wgpu::BufferUsage::Storage | copy;
+  case BufferClass::Count:
+    break;
+  }
+
+  assert(false);
+  return copy;
+}
+
+static const char *class_label(BufferClass buffer_class)
+{
+  switch (buffer_class) {
+  case BufferClass::Vertex:
+    return "Suballocated Vertex Block";
+  case BufferClass::Index:
+    return "Suballocated Index Block";
+  case BufferClass::Uniform:
+    return "Suballocated Uniform Block";
+  case BufferClass::Storage:
+    return "Suballocated Storage Block";
+  case BufferClass::Count:
+    break;
+  }
+  return "Suballocated Block";
+}
+
+static MemoryCategory class_category(BufferClass buffer_class)
+{
+  switch (buffer_class) {
+  case BufferClass::Vertex:
+  case BufferClass::Index:
+    return MemoryCategory::Mesh;
+  case BufferClass::Uniform:
+    return MemoryCategory::Uniform;
+  case BufferClass::Storage:
+    return MemoryCategory::Storage;
+  case BufferClass::Count:
+    break;
+  }
+  return MemoryCategory::Other;
+}
+
+BufferAllocator::BufferAllocator(Context &context)
+    : BufferAllocator(context, Config{})
+{
+}
+
+BufferAllocator::BufferAllocator(Context &context, Config config)
+    : GlobalAccess(context), config_(config)
+{
+  assert(context.isInitialized());
+  const wgpu::Limits &limits = context.getLimits();
+
+  alignments_[static_cast<size_t>(BufferClass::Vertex)] = 4;
+  alignments_[static_cast<size_t>(BufferClass::Index)]  = 4;
+  alignments_[static_cast<size_t>(BufferClass::Uniform)]
+      = std::max<uint64_t>(4, limits.minUniformBufferOffsetAlignment);
+  alignments_[static_cast<size_t>(BufferClass::Storage)]
+      = std::max<uint64_t>(4, limits.minStorageBufferOffsetAlignment);
+}
+
+ustd::expected<BufferAllocation>
+BufferAllocator::allocate(BufferClass buffer_class,
+                          uint64_t    size,
+                          uint64_t    alignment)
+{
+  assert(buffer_class != BufferClass::Count);
+
+  /* keep every range copyable by `CopyBufferToBuffer` */
+  size      = (size + 3) & ~uint64_t{3};
+  alignment = std::max(alignment, getAlignment(buffer_class));
+
+  if (size == 0) {
+    return ustd::unexpected("Cannot allocate an empty buffer range");
+  }
+
+  /* a block must fit the range at any offset, see `createBlock()` */
+  if (size + alignment - 1 > getContext().getLimits().maxBufferSize) {
+    return ustd::unexpected("Allocation of " + std::to_string(size)
+                            + " bytes exceeds the device's maxBufferSize");
+  }
+
+  Pool                                    &pool  = getPool(buffer_class);
+  size_t                                   block = 0;
+  std::optional<TlsfAllocator::Allocation> range;
+
+  for (; block < pool.blocks.size() && !range; ++block) {
+    if (pool.blocks[block]) {
+      range = pool.blocks[block]->ranges.allocate(size, alignment);
+    }
+  }
+
+  if (range) {
+    --block;
+  }
+  else {
+    block = createBlock(pool, buffer_class, size, alignment);
+    range = pool.blocks[block]->ranges.allocate(size, alignment);
+    if (!range) {
+      getContext().destroyLater(std::move(pool.blocks[block]->buffer));
+      pool.blocks[block].reset();
+      return ustd::unexpected("Allocation of " + std::to_string(size)
+                              + " bytes does not fit a new block");
+    }
+  }
+
+  uint32_t id;
+  if (!free_slots_.empty()) {
+    id = free_slots_.back();
+    free_slots_.pop_back();
+  }
+  else {
+    id = static_cast<uint32_t>(slots_.size());
+    slots_.emplace_back();
+  }
+
+  /* the slot keeps its generation, which freeing it bumped */
+  Slot &slot        = slots_[id];
+  slot.buffer_class = buffer_class;
+  slot.block        = block;
+  slot.range        = *range;
+  slot.alignment    = alignment;
+  slot.live         = true;
+
+  return BufferAllocation{id, slot.generation};
+}
+
+void BufferAllocator::free(BufferAllocation allocation)
+{
+  /* a stale handle must not free whatever now lives in its slot */
+  if (!isLive(allocation)) {
+    return;
+  }
+
+  Slot &slot = slots_[allocation.id];
+
+  Pool                 &pool  = getPool(slot.buffer_class);
+  std::optional<Block> &block = pool.blocks[slot.block];
+  block->ranges.free(slot.range);
+
+  /* return empty blocks to the device, but keep one around per class */
+  size_t live_blocks = std::count_if(pool.blocks.begin(), pool.blocks.end(),
+                                     [](auto &b) { return b.has_value(); });
+  if (block->ranges.getAllocationCount() == 0 && live_blocks > 1) {
+    getContext().destroyLater(std::move(block->buffer));
+    block.reset();
+  }
+
+  slot.live = false;
+  ++slot.generation;
+  free_slots_.push_back(allocation.id);
+}
+
+bool BufferAllocator::isLive(BufferAllocation allocation) const
+{
+  return allocation.valid() && allocation.id < slots_.size()
+         && slots_[allocation.id].live
+         && slots_[allocation.id].generation == allocation.generation;
+}
+
+BufferRange BufferAllocator::resolve(BufferAllocation allocation) const
+{
+  if (!isLive(allocation)) {
+    return {};
+  }
+
+  const Slot  &slot  = slots_[allocation.id];
+  const Block &block = *getPool(slot.buffer_class).blocks[slot.block];
+
+  return {block.buffer, slot.range.offset, slot.range.size};
+}
+
+uint64_t BufferAllocator::defragment(const wgpu::CommandEncoder &encoder,
+                                     float                       threshold)
+{
+  uint64_t moved = 0;
+
+  for (size_t c = 0; c < class_count; ++c) {
+    BufferClass buffer_class = static_cast<BufferClass>(c);
+    if (getStats(buffer_class).fragmentation <= threshold) {
+      continue;
+    }
+
+    std::vector<uint32_t> live;
+    for (uint32_t id = 0; id < slots_.size(); ++id) {
+      if (slots_[id].live && slots_[id].buffer_class == buffer_class) {
+        live.push_back(id);
+      }
+    }
+
+    /* placing large ranges first packs the new blocks tightest */
+    std::sort(live.begin(), live.end(), [this](uint32_t a, uint32_t b) {
+      return slots_[a].range.size > slots_[b].range.size;
+    });
+
+    Pool old_pool = std::move(getPool(buffer_class));
+    Pool new_pool;
+
+    for (uint32_t id : live) {
+      Slot        &slot = slots_[id];
+      const Block &src  = *old_pool.blocks[slot.block];
+
+      std::optional<TlsfAllocator::Allocation> range;
+      size_t                                   block = 0;
+      for (; block < new_pool.blocks.size() && !range; ++block) {
+        range = new_pool.blocks[block]->ranges.allocate(slot.range.size,
+                                                        slot.alignment);
+      }
+
+      if (range) {
+        --block;
+      }
+      else {
+        block = createBlock(new_pool, buffer_class, slot.range.size,
+                            slot.alignment);
+        range = new_pool.blocks[block]->ranges.allocate(slot.range.size,
+                                                        slot.alignment);
+        /* `allocate()` only accepts ranges a new block can always hold */
+        assert(range);
+      }
+
+      encoder.CopyBufferToBuffer(src.buffer, slot.range.offset,
+                                 new_pool.blocks[block]->buffer, range->offset,
+                                 slot.range.size);
+
+      moved += slot.range.size;
+      slot.block = block;
+      slot.range = *range;
+    }
+
+    /* retired like any other block, destroyed once the copies have run */
+    for (std::optional<Block> &block : old_pool.blocks) {
+      if (block) {
+        getContext().destroyLater(std::move(block->buffer));
+      }
+    }
+
+    getPool(buffer_class) = std::move(new_pool);
+    ++generation_;
+  }
+
+  return moved;
+}
+
+uint64_t BufferAllocator::getAlignment(BufferClass buffer_class) const
+{
+  return alignments_[static_cast<size_t>(buffer_class)];
+}
+
+uint64_t BufferAllocator::getGeneration() const
+{
+  return generation_;
+}
+
+BufferAllocator::Stats BufferAllocator::getStats(BufferClass buffer_class) const
+{
+  Stats stats;
+  for (const std::optional<Block> &block : getPool(buffer_class).blocks) {
+    if (!block) {
+      continue;
+    }
+
+    ++stats.block_count;
+    stats.reserved_bytes += block->ranges.getCapacity();
+    stats.used_bytes += block->ranges.getUsed();
+    stats.allocation_count += block->ranges.getAllocationCount();
+    stats.largest_free_range
+        = std::max(stats.largest_free_range, block->ranges.getLargestFree());
+  }
+
+  uint64_t free_bytes = stats.reserved_bytes - stats.used_bytes;
+  if (free_bytes > 0) {
+    stats.fragmentation
+        = 1.f
+          - static_cast<float>(stats.largest_free_range)
+                / static_cast<float>(free_bytes);
+  }
+
+  return stats;
+}
+
+BufferAllocator::Pool &BufferAllocator::getPool(BufferClass buffer_class)
+{
+  return pools_[static_cast<size_t>(buffer_class)];
+}
+
+const BufferAllocator::Pool &
+BufferAllocator::getPool(BufferClass buffer_class) const
+{
+  return pools_[static_cast<size_t>(buffer_class)];
+}
+
+size_t BufferAllocator::createBlock(Pool       &pool,
+                                    BufferClass buffer_class,
+                                    uint64_t    size,
+                                    uint64_t    alignment)
+{
+  /* oversized requests get a block of their own, with room for the padding
+   * the allocator reserves to align them */
+  uint64_t block_size
+      = std::min(std::max(config_.block_size, size + alignment - 1),
+                 getContext().getLimits().maxBufferSize);
+
+  wgpu::BufferDescriptor buffer_desc = {};
+  buffer_desc.label                  = class_label(buffer_class);
+  buffer_desc.usage                  = class_usage(buffer_class);
+  buffer_desc.size                   = block_size;
+
+  Block block{
+      getContext().createBuffer(buffer_desc, class_category(buffer_class)),
+      TlsfAllocator(block_size)};
+
+  auto  empty = std::find_if(pool.blocks.begin(), pool.blocks.end(),
+                             [](auto &b) { return !b.has_value(); });
+  if (empty != pool.blocks.end()) {
+    *empty = std::move(block);
+    return std::distance(pool.blocks.begin(), empty);
+  }
+
+  pool.blocks.push_back(std::move(block));
+  return pool.blocks.size() - 1;
+}
+
+} // namespace rndr
@@ -0,0 +1,155 @@
+/**
+ * @file buffer_allocator.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_BUFFER_ALLOCATOR_H_
+#define RNDR_BUFFER_ALLOCATOR_H_
+
+#include "rndr/context.h"
+#include "rndr/memory/tlsf.h"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+enum class BufferClass : uint32_t { Vertex, Index, Uniform, Storage, Count };
+
+/**
+ * @brief Opaque handle to a range suballocated from a `BufferAllocator`.
+ * Resolve it with `BufferAllocator::resolve` each time it is bound, as
+ * `defragment()` may move it. The generation tells a freed handle apart from
+ * a later allocation that reuses its slot.
+ */
+struct BufferAllocation {
+  static constexpr uint32_t invalid_id = UINT32_MAX;
+  uint32_t                  id         = invalid_id;
+  uint32_t                  generation = 0;
+
+  bool                      valid() const
+  {
+    return id != invalid_id;
+  }
+};
+
+struct BufferRange {
+  wgpu::Buffer buffer = {};
+  uint64_t     offset = 0;
+  uint64_t     size   = 0;
+};
+
+/**
+ * @brief Hands out aligned ranges of a few large device buffers per usage
+ * class, so that thousands of meshes or uniform blocks can share a handful of
+ * `wgpu::Buffer`s.
+ *
+ * Ranges in a block are managed by a `TlsfAllocator`. Uniform and storage
+ * ranges are aligned to the device's `minUniformBufferOffsetAlignment` and
+ * `minStorageBufferOffsetAlignment` so that they can be bound at their offset.
+ */
+class BufferAllocator : public GlobalAccess {
+public:
+  struct Config {
+    uint64_t block_size = 1 << 26;
+  };
+
+  struct Stats {
+    uint64_t reserved_bytes     = 0;
+    uint64_t used_bytes         = 0;
+    uint64_t largest_free_range = 0;
+    size_t   allocation_count   = 0;
+    size_t   block_count        = 0;
+    /* 0 when free space is contiguous, approaching 1 as it scatters */
+    float    fragmentation      = 0.f;
+  };
+
+  BufferAllocator(Context &context);
+  BufferAllocator(Context &context, Config config);
+
+  BufferAllocator(const BufferAllocator &)            = delete;
+  BufferAllocator &operator=(const BufferAllocator &) = delete;
+
+  BufferAllocator(BufferAllocator &&)                 = delete;
+  BufferAllocator &operator=(BufferAllocator &&)      = delete;
+
+  /**
+   * @brief Allocate `size` bytes in a buffer of the given class. The offset
+   * honours both the class alignment and `alignment`, whichever is larger.
+   */
+  [[nodiscard]] ustd::expected<BufferAllocation>
+              allocate(BufferClass buffer_class, uint64_t size, uint64_t alignment = 4);
+  /* does nothing for invalid or already freed allocations */
+  void        free(BufferAllocation allocation);
+
+  /* whether `allocation` has been allocated and not freed since */
+  bool        isLive(BufferAllocation allocation) const;
+  /* the current range of a live allocation, or an empty range */
+  BufferRange resolve(BufferAllocation allocation) const;
+
+  /**
+   * @brief Compact every class whose fragmentation exceeds `threshold` into
+   * fresh blocks, recording the data moves into `encoder`.
+   *
+   * Moved ranges resolve to their new location immediately; the encoder must
+   * be submitted before the moved data is used, and before the next
+   * `Context::processEvents()`, which may destroy the old blocks. Bumps `getGeneration()` when
+   * anything moves, so cached bind groups know to rebuild.
+   *
+   * @return number of bytes moved
+   */
+  uint64_t    defragment(const wgpu::CommandEncoder &encoder,
+                         float                       threshold = 0.25f);
+
+  uint64_t    getAlignment(BufferClass buffer_class) const;
+  uint64_t    getGeneration() const;
+  Stats       getStats(BufferClass buffer_class) const;
+
+private:
+  struct Block {
+    TrackedBuffer buffer;
+    TlsfAllocator ranges;
+  };
+
+  struct Slot {
+    BufferClass               buffer_class = BufferClass::Count;
+    size_t                    block        = 0;
+    TlsfAllocator::Allocation range        = {};
+    uint64_t                  alignment    = 4;
+    uint32_t                  generation   = 0;
+    bool                      live         = false;
+  };
+
+  struct Pool {
+    std::vector<std::optional<Block>> blocks = {};
+  };
+
+  static constexpr size_t class_count = static_cast<size_t>(BufferClass::Count);
+
+  Pool         &getPool(BufferClass buffer_class);
+  const Pool   &getPool(BufferClass buffer_class) const;
+  size_t        createBlock(Pool       &pool,
+                            BufferClass buffer_class,
+                            uint64_t    size,
+                            uint64_t    alignment);
+
+  const Config                     config_;
+  std::array<uint64_t, class_count> alignments_  = {};
+  std::array<Pool, class_count>     pools_       = {};
+  std::vector<Slot>                 slots_       = {};
+  std::vector<uint32_t>             free_slots_  = {};
+  uint64_t                          generation_  = 0;
+};
+
+} // namespace rndr
+
+#endif
@@ -0,0 +1,261 @@
+/**
+ * @file memory_tracker.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "memory_tracker.h"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace rndr {
+
+const char *toString(MemoryCategory category)
+{
+  switch (category) {
+  case MemoryCategory::Mesh:
+    return "mesh";
+  case MemoryCategory::Texture:
+    return "texture";
+  case MemoryCategory::Staging:
+    return "staging";
+  case MemoryCategory::Uniform:
+    return "uniform";
+  case MemoryCategory::Readback:
+    return "readback";
+  case MemoryCategory::Storage:
+    return "storage";
+  case MemoryCategory::Query:
+    return "query";
+  default:
+    return "other";
+  }
+}
+
+MemoryTracker::Allocation::Allocation(std::shared_ptr<Counters> counters,
+                                      MemoryCategory            category,
+                                      uint64_t                  bytes)
+    : counters_(std::move(counters)), category_(category), bytes_(bytes)
+{
+}
+
+MemoryTracker::Allocation::~Allocation()
+{
+  reset();
+}
+
+MemoryTracker::Allocation::Allocation(Allocation &&other) noexcept
+    : counters_(std::move(other.counters_)), category_(other.category_),
+      bytes_(std::exchange(other.bytes_, 0))
+{
+}
+
+MemoryTracker::Allocation &
+MemoryTracker::Allocation::operator=(Allocation &&other) noexcept
+{
+  if (this != &other) {
+    reset();
+    counters_ = std::move(other.counters_);
+    category_ = other.category_;
+    bytes_    = std::exchange(other.bytes_, 0);
+  }
+  return *this;
+}
+
+void MemoryTracker::Allocation::reset()
+{
+  if (counters_) {
+    counters_->release(category_, bytes_);
+    counters_.reset();
+    bytes_ = 0;
+  }
+}
+
+uint64_t MemoryTracker::Allocation::getBytes() const
+{
+  return bytes_;
+}
+
+MemoryCategory MemoryTracker::Allocation::getCategory() const
+{
+  return category_;
+}
+
+MemoryTracker::Allocation MemoryTracker::track(MemoryCategory category,
+                                               uint64_t       bytes)
+{
+  size_t          index   = static_cast<size_t>(category);
+  Snapshot       &current = counters_->current;
+
+  std::lock_guard lock(counters_->mutex);
+  current.live[index]        += bytes;
+  current.allocations[index] += 1;
+  current.total_live         += bytes;
+
+  current.peak[index]  = std::max(current.peak[index], current.live[index]);
+  current.frame_peak[index]
+      = std::max(current.frame_peak[index], current.live[index]);
+  current.total_peak = std::max(current.total_peak, current.total_live);
+
+  return Allocation(counters_, category, bytes);
+}
+
+void MemoryTracker::Counters::release(MemoryCategory category, uint64_t bytes)
+{
+  size_t          index = static_cast<size_t>(category);
+
+  std::lock_guard lock(mutex);
+  assert(current.live[index] >= bytes && current.allocations[index] > 0);
+  current.live[index]        -= bytes;
+  current.allocations[index] -= 1;
+  current.total_live         -= bytes;
+}
+
+void MemoryTracker::setBudget(MemoryCategory category,
+                              uint64_t       bytes,
+                              BudgetCallback callback)
+{
+  std::lock_guard lock(counters_->mutex);
+  counters_->budgets[static_cast<size_t>(category)]
+      = {bytes, std::move(callback)};
+}
+
+uint64_t MemoryTracker::getBudget(MemoryCategory category) const
+{
+  std::lock_guard lock(counters_->mutex);
+  return counters_->budgets[static_cast<size_t>(category)].bytes;
+}
+
+void MemoryTracker::checkBudgets()
+{
+  std::vector<std::pair<size_t, uint64_t>> over;
+  {
+    std::lock_guard lock(counters_->mutex);
+    const Snapshot &current = counters_->current;
+    for (size_t i = 0; i < category_count; ++i) {
+      const Budget &budget = counters_->budgets[i];
+      if (budget.bytes > 0 && budget.callback
+          && current.live[i] > budget.bytes) {
+        over.emplace_back(i, current.live[i] - budget.bytes);
+      }
+    }
+  }
+
+  /* outside the lock, as evicting releases allocations */
+  for (auto [index, excess] : over) {
+    BudgetCallback callback;
+    {
+      std::lock_guard lock(counters_->mutex);
+      callback = counters_->budgets[index].callback;
+    }
+    if (callback) {
+      callback(static_cast<MemoryCategory>(index), excess);
+    }
+  }
+}
+
+MemoryTracker::Snapshot MemoryTracker::snapshot() const
+{
+  std::lock_guard lock(counters_->mutex);
+  return counters_->current;
+}
+
+MemoryTracker::Snapshot MemoryTracker::endFrame()
+{
+  std::lock_guard lock(counters_->mutex);
+  Snapshot       &current = counters_->current;
+  Snapshot        ended   = current;
+
+  ++current.frame;
+  current.frame_peak = current.live;
+  return ended;
+}
+
+/* bytes per block, and the block's width and height in texels */
+struct BlockInfo {
+  uint32_t bytes  = 4;
+  uint32_t width  = 1;
+  uint32_t height = 1;
+};
+
+static BlockInfo block_info(wgpu::TextureFormat format)
+{
+  using F = wgpu::TextureFormat;
+  switch (format) {
+  case F::R8Unorm:
+  case F::R8Snorm:
+  case F::R8Uint:
+  case F::R8Sint:
+  case F::Stencil8:
+    return {1};
+  case F::R16Uint:
+  case F::R16Sint:
+  case F::R16Float:
+  case F::RG8Unorm:
+  case F::RG8Snorm:
+  case F::RG8Uint:
+  case F::RG8Sint:
+  case F::Depth16Unorm:
+    return {2};
+  case F::RG32Float:
+  case F::RG32Uint:
+  case F::RG32Sint:
+  case F::RGBA16Uint:
+  case F::RGBA16Sint:
+  case F::RGBA16Float:
+  case F::Depth32FloatStencil8:
+    return {8};
+  case F::RGBA32Float:
+  case F::RGBA32Uint:
+  case F::RGBA32Sint:
+    return {16};
+  case F::BC1RGBAUnorm:
+  case F::BC1RGBAUnormSrgb:
+  case F::BC4RUnorm:
+  case F::BC4RSnorm:
+    return {8, 4, 4};
+  case F::BC2RGBAUnorm:
+  case F::BC2RGBAUnormSrgb:
+  case F::BC3RGBAUnorm:
+  case F::BC3RGBAUnormSrgb:
+  case F::BC5RGUnorm:
+  case F::BC5RGSnorm:
+  case F::BC6HRGBUfloat:
+  case F::BC6HRGBFloat:
+  case F::BC7RGBAUnorm:
+  case F::BC7RGBAUnormSrgb:
+    return {16, 4, 4};
+  /* RGBA8, BGRA8, RGB10A2, R32, RG16, Depth24Plus, Depth32Float, ... */
+  default:
+    return {4};
+  }
+}
+
+uint64_t MemoryTracker::textureBytes(const wgpu::TextureDescriptor &desc)
+{
+  BlockInfo block  = block_info(desc.format);
+  bool      is_3d  = desc.dimension == wgpu::TextureDimension::e3D;
+
+  uint64_t  bytes  = 0;
+  for (uint32_t level = 0; level < std::max(desc.mipLevelCount, 1u); ++level) {
+    uint32_t width  = std::max(desc.size.width >> level, 1u);
+    uint32_t height = std::max(desc.size.height >> level, 1u);
+    uint32_t layers = is_3d ? std::max(desc.size.depthOrArrayLayers >> level, 1u)
+                            : desc.size.depthOrArrayLayers;
+
+    uint64_t blocks_x = (width + block.width - 1) / block.width;
+    uint64_t blocks_y = (height + block.height - 1) / block.height;
+    bytes            += blocks_x * blocks_y * block.bytes * layers;
+  }
+
+  return bytes * std::max(desc.sampleCount, 1u);
+}
+
+} // namespace rndr
@@ -0,0 +1,182 @@
+/**
+ * @file memory_tracker.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_MEMORY_TRACKER_H_
+#define RNDR_MEMORY_TRACKER_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+enum class MemoryCategory : uint8_t {
+  Mesh,
+  Texture,
+  Staging,
+  Uniform,
+  Readback,
+  Storage,
+  Query,
+  Other,
+  Count
+};
+
+const char *toString(MemoryCategory category);
+
+/**
+ * @brief Accounts for the device memory `rndr` holds, by category.
+ *
+ * Every tracked buffer, texture and query set shares an `Allocation` between
+ * its copies, which adds its size to the live bytes of its category and takes
+ * it away again with the last copy. Plain `wgpu` handles sliced off a tracked
+ * object are not counted, so memory they keep alive outlives its accounting.
+ * The counters are shared with every `Allocation`, so a tracked object may
+ * safely outlive its tracker.
+ *
+ * A soft budget per category calls its callback from `checkBudgets()`, which
+ * `Context::processEvents()` runs, with the bytes over budget; the callback is
+ * expected to evict something. Nothing ever fails for being over budget.
+ */
+class MemoryTracker {
+  struct Counters;
+
+public:
+  static constexpr size_t category_count
+      = static_cast<size_t>(MemoryCategory::Count);
+
+  using BudgetCallback
+      = std::function<void(MemoryCategory category, uint64_t excess)>;
+
+  struct Snapshot {
+    uint64_t                              frame       = 0;
+    std::array<uint64_t, category_count>  live        = {};
+    std::array<uint64_t, category_count>  peak        = {};
+    /* peak since the previous `endFrame()` */
+    std::array<uint64_t, category_count>  frame_peak  = {};
+    std::array<uint64_t, category_count>  allocations = {};
+    uint64_t                              total_live  = 0;
+    uint64_t                              total_peak  = 0;
+
+    uint64_t getLive(MemoryCategory category) const
+    {
+      return live[static_cast<size_t>(category)];
+    }
+  };
+
+  /* move-only share of a category's live bytes */
+  class Allocation {
+  public:
+    Allocation() = default;
+    ~Allocation();
+
+    Allocation(const Allocation &)            = delete;
+    Allocation &operator=(const Allocation &) = delete;
+
+    Allocation(Allocation &&other) noexcept;
+    Allocation    &operator=(Allocation &&other) noexcept;
+
+    void           reset();
+
+    uint64_t       getBytes() const;
+    MemoryCategory getCategory() const;
+
+  private:
+    friend class MemoryTracker;
+
+    Allocation(std::shared_ptr<Counters> counters,
+               MemoryCategory            category,
+               uint64_t                  bytes);
+
+    std::shared_ptr<Counters> counters_ = {};
+    MemoryCategory            category_ = MemoryCategory::Other;
+    uint64_t                  bytes_    = 0;
+  };
+
+  MemoryTracker() = default;
+
+  MemoryTracker(const MemoryTracker &)            = delete;
+  MemoryTracker &operator=(const MemoryTracker &) = delete;
+
+  MemoryTracker(MemoryTracker &&)                 = delete;
+  MemoryTracker &operator=(MemoryTracker &&)      = delete;
+
+  [[nodiscard]] Allocation track(MemoryCategory category, uint64_t bytes);
+
+  /* a `bytes` of 0 removes the budget */
+  void     setBudget(MemoryCategory category,
+                     uint64_t       bytes,
+                     BudgetCallback callback = {});
+  uint64_t getBudget(MemoryCategory category) const;
+
+  /* call the callback of every category over its budget */
+  void     checkBudgets();
+
+  Snapshot snapshot() const;
+  /* the snapshot of the frame that ends, after which frame peaks restart */
+  Snapshot endFrame();
+
+  /* size of every mip level, layer and sample of a texture */
+  static uint64_t textureBytes(const wgpu::TextureDescriptor &desc);
+
+private:
+  struct Budget {
+    uint64_t       bytes    = 0;
+    BudgetCallback callback = {};
+  };
+
+  /* guarded by one mutex, and kept alive by every `Allocation` */
+  struct Counters {
+    std::mutex                         mutex   = {};
+    Snapshot                           current = {};
+    std::array<Budget, category_count> budgets = {};
+
+    void                               release(MemoryCategory category,
+                                               uint64_t       bytes);
+  };
+
+  std::shared_ptr<Counters> counters_ = std::make_shared<Counters>();
+};
+
+/* a `wgpu` object together with its `Allocation`, usable anywhere the object is */
+template <typename T>
+class Tracked : public T {
+public:
+  Tracked() = default;
+  Tracked(T object, MemoryTracker::Allocation allocation)
+      : T(std::move(object)),
+        allocation_(std::make_shared<MemoryTracker::Allocation>(
+            std::move(allocation)))
+  {
+  }
+
+  /* bytes accounted for, 0 for an untracked or empty object */
+  uint64_t getTrackedBytes() const
+  {
+    return allocation_ ? allocation_->getBytes() : 0;
+  }
+
+private:
+  std::shared_ptr<const MemoryTracker::Allocation> allocation_ = {};
+};
+
+using TrackedBuffer   = Tracked<wgpu::Buffer>;
+using TrackedTexture  = Tracked<wgpu::Texture>;
+using TrackedQuerySet = Tracked<wgpu::QuerySet>;
+
+} // namespace rndr
+
+#endif
@@ -0,0 +1,335 @@
+/**
+ * @file readback_queue.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "readback_queue.h"
+#include "rndr/profiling/trace.h"
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+
+namespace rndr {
+
+static uint64_t align_up(uint64_t value, uint64_t alignment)
+{
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+ReadbackQueue::ReadbackQueue(Context &context)
+    : ReadbackQueue(context, Config{})
+{
+}
+
+ReadbackQueue::ReadbackQueue(Context &context, Config config)
+    : GlobalAccess(context), config_(config)
+{
+  assert(config_.chunk_size % request_alignment == 0);
+}
+
+ReadbackQueue::~ReadbackQueue()
+{
+  /* map callbacks capture `this`, so they must all resolve before we go */
+  wait();
+
+  for (const auto &chunk : chunks_) {
+    assert(chunk->leases == 0 && "a Mapping outlived its ReadbackQueue");
+  }
+}
+
+ustd::result ReadbackQueue::read(const wgpu::Buffer &src,
+                                 uint64_t            offset,
+                                 uint64_t            size,
+                                 Callback            callback)
+{
+  if (offset % copy_alignment != 0 || size % copy_alignment != 0) {
+    return ustd::unexpected(
+        "Readback offset and size must be multiples of 4 bytes");
+  }
+
+  if (size == 0 || offset + size > src.GetSize()) {
+    return ustd::unexpected("Readback range is empty or out of bounds");
+  }
+
+  Chunk *chunk = size <= config_.chunk_size ? acquireChunk(size) : nullptr;
+
+  /* too large for the pool, or the pool is held, never block on it */
+  if (chunk == nullptr) {
+    chunk = createChunk(size, true);
+    used_chunks_.push_back(chunk);
+    ++stats_.dedicated_readbacks;
+  }
+
+  uint64_t chunk_offset = chunk->head;
+  chunk->head           = align_up(chunk_offset + size, request_alignment);
+  chunk->requests.push_back(
+      {src, offset, chunk_offset, size, std::move(callback)});
+
+  stats_.bytes_read += size;
+  ++stats_.requests;
+
+  return {};
+}
+
+ustd::result ReadbackQueue::submit()
+{
+  RNDR_TRACE_ZONE("ReadbackQueue::submit");
+
+  if (used_chunks_.empty()) {
+    return {};
+  }
+
+  wgpu::CommandEncoderDescriptor encoder_desc = {};
+  encoder_desc.label = "Readback Queue Command Encoder";
+  wgpu::CommandEncoder encoder
+      = getDevice().CreateCommandEncoder(&encoder_desc);
+
+  for (Chunk *chunk : used_chunks_) {
+    for (const Request &request : chunk->requests) {
+      encoder.CopyBufferToBuffer(request.src, request.src_offset, chunk->buffer,
+                                 request.offset, request.size);
+    }
+  }
+
+  wgpu::CommandBufferDescriptor command_buffer_desc = {};
+  command_buffer_desc.label = "Readback Queue Command Buffer";
+  wgpu::CommandBuffer command_buffer = encoder.Finish(&command_buffer_desc);
+  getContext().getQueue().Submit(1, &command_buffer);
+
+  /* map requests resolve once the copies above have executed */
+  for (Chunk *chunk : used_chunks_) {
+    mapChunk(chunk);
+  }
+
+  ++stats_.submissions;
+  used_chunks_.clear();
+  current_ = nullptr;
+
+  return {};
+}
+
+void ReadbackQueue::wait()
+{
+  /* callbacks may erase dedicated chunks, so search again after each */
+  while (in_flight_ > 0) {
+    auto it = std::find_if(chunks_.begin(), chunks_.end(),
+                           [](const auto &chunk) { return chunk->map_pending; });
+    if (it == chunks_.end()) {
+      break;
+    }
+
+    wgpu::Future future = (*it)->map_future;
+    getContext().blockOnFuture(future);
+  }
+}
+
+size_t ReadbackQueue::getInFlight() const
+{
+  return in_flight_;
+}
+
+const ReadbackQueue::Stats &ReadbackQueue::getStats() const
+{
+  return stats_;
+}
+
+ReadbackQueue::Chunk *ReadbackQueue::acquireChunk(uint64_t size)
+{
+  if (current_ && current_->head + size <= current_->capacity) {
+    return current_;
+  }
+
+  if (free_chunks_.empty() && stats_.chunks_allocated < config_.max_chunks) {
+    current_ = createChunk(config_.chunk_size, false);
+  }
+  else {
+    /* pending chunks come back from the caller's next `processEvents()`,
+     * never pump it from here, it runs every completion callback */
+    if (free_chunks_.empty()) {
+      return nullptr;
+    }
+
+    current_ = free_chunks_.back();
+    free_chunks_.pop_back();
+  }
+
+  used_chunks_.push_back(current_);
+  return current_;
+}
+
+ReadbackQueue::Chunk *ReadbackQueue::createChunk(uint64_t capacity,
+                                                 bool     dedicated)
+{
+  capacity                           = align_up(capacity, copy_alignment);
+
+  wgpu::BufferDescriptor buffer_desc = {};
+  buffer_desc.label                  = dedicated
+                                           ? "Readback Queue Dedicated Buffer"
+                                           : "Readback Queue Chunk";
+  buffer_desc.usage = wgpu::BufferUsage::MapRead | wgpu::BufferUsage::CopyDst;
+  buffer_desc.size  = capacity;
+
+  auto chunk        = std::make_unique<Chunk>();
+  chunk->buffer
+      = getContext().createBuffer(buffer_desc, MemoryCategory::Readback);
+  chunk->capacity   = capacity;
+  chunk->dedicated  = dedicated;
+
+  chunks_.push_back(std::move(chunk));
+  if (!dedicated) {
+    ++stats_.chunks_allocated;
+  }
+
+  return chunks_.back().get();
+}
+
+void ReadbackQueue::mapChunk(Chunk *chunk)
+{
+  chunk->mapped_size
+      = std::min(align_up(chunk->head, copy_alignment), chunk->capacity);
+
+  in_flight_        += chunk->requests.size();
+  chunk->map_pending = true;
+  chunk->map_future  = chunk->buffer.MapAsync(
+      wgpu::MapMode::Read, 0, chunk->mapped_size,
+      wgpu::CallbackMode::AllowProcessEvents,
+      [this, chunk](wgpu::MapAsyncStatus status, const char *message) {
+        chunk->map_pending = false;
+        completeChunk(chunk, status == wgpu::MapAsyncStatus::Success,
+                      message);
+      });
+}
+
+void ReadbackQueue::completeChunk(Chunk      *chunk,
+                                  bool        mapped,
+                                  const char *message)
+{
+  std::vector<Request> requests = std::move(chunk->requests);
+  chunk->requests.clear();
+  in_flight_ -= requests.size();
+
+  if (!mapped) {
+    ++stats_.failed_maps;
+    std::string error = "Failed to map a readback chunk";
+    if (message != nullptr) {
+      error += std::string(": ") + message;
+    }
+    for (Request &request : requests) {
+      if (request.callback) {
+        request.callback(ustd::unexpected(error), {});
+      }
+    }
+
+    /* a failed map (e.g. device loss) retires the chunk for good, and frees
+     * its place in the pool for a new one */
+    if (!chunk->dedicated) {
+      --stats_.chunks_allocated;
+    }
+    destroyChunk(chunk);
+    return;
+  }
+
+  /* mapped with a single `MapAsync`, viewed per request from here on */
+  const auto *base = static_cast<const std::byte *>(
+      chunk->buffer.GetConstMappedRange(0, chunk->mapped_size));
+
+  /* held for the duration of the callbacks, so none can recycle the chunk */
+  ++chunk->leases;
+  for (Request &request : requests) {
+    Mapping mapping(this, chunk, {base + request.offset, request.size});
+    if (request.callback) {
+      request.callback({}, std::move(mapping));
+    }
+  }
+  release(chunk);
+}
+
+void ReadbackQueue::release(Chunk *chunk)
+{
+  assert(chunk->leases > 0);
+  if (--chunk->leases > 0) {
+    return;
+  }
+
+  if (chunk->buffer.GetMapState() == wgpu::BufferMapState::Mapped) {
+    chunk->buffer.Unmap();
+  }
+
+  if (chunk->dedicated) {
+    destroyChunk(chunk);
+    return;
+  }
+
+  chunk->head = 0;
+  free_chunks_.push_back(chunk);
+}
+
+void ReadbackQueue::destroyChunk(Chunk *chunk)
+{
+  auto it = std::find_if(chunks_.begin(), chunks_.end(),
+                         [chunk](const auto &c) { return c.get() == chunk; });
+  getContext().destroyLater(std::move(chunk->buffer));
+  chunks_.erase(it);
+}
+
+ReadbackQueue::Mapping::Mapping(ReadbackQueue             *queue,
+                                Chunk                     *chunk,
+                                std::span<const std::byte> bytes)
+    : queue_(queue), chunk_(chunk), bytes_(bytes)
+{
+  ++chunk_->leases;
+}
+
+ReadbackQueue::Mapping::~Mapping()
+{
+  reset();
+}
+
+ReadbackQueue::Mapping::Mapping(Mapping &&other) noexcept
+    : queue_(other.queue_), chunk_(other.chunk_), bytes_(other.bytes_)
+{
+  other.queue_ = nullptr;
+  other.chunk_ = nullptr;
+  other.bytes_ = {};
+}
+
+ReadbackQueue::Mapping &
+ReadbackQueue::Mapping::operator=(Mapping &&other) noexcept
+{
+  if (this != &other) {
+    reset();
+    std::swap(queue_, other.queue_);
+    std::swap(chunk_, other.chunk_);
+    std::swap(bytes_, other.bytes_);
+  }
+  return *this;
+}
+
+std::span<const std::byte> ReadbackQueue::Mapping::bytes() const
+{
+  return bytes_;
+}
+
+bool ReadbackQueue::Mapping::empty() const
+{
+  return chunk_ == nullptr;
+}
+
+void ReadbackQueue::Mapping::reset()
+{
+  if (chunk_ != nullptr) {
+    queue_->release(chunk_);
+  }
+  queue_ = nullptr;
+  chunk_ = nullptr;
+  bytes_ = {};
+}
+
+} // namespace rndr
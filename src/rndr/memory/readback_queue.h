@@ -0,0 +1,185 @@
+/**
+ * @file readback_queue.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_READBACK_QUEUE_H_
+#define RNDR_READBACK_QUEUE_H_
+
+#include "rndr/context.h"
+#include "ustd/expected.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+/**
+ * @brief Batches GPU-to-CPU buffer readbacks through a pool of
+ * `MapRead | CopyDst` chunks, the mirror image of `UploadRing`.
+ *
+ * `read()` reserves a range of the current chunk and queues a copy into it.
+ * `submit()` records every queued copy into one command buffer and maps each
+ * chunk used since the last submission with a single `MapAsync`. Once a map
+ * completes, each request's callback receives a `Mapping`: a view straight
+ * into the mapped chunk, which stays mapped until every `Mapping` of it is
+ * gone and then returns to the pool. Nothing is copied on the CPU.
+ *
+ * Callbacks run inside `Context::processEvents()` or `wait()`, never inside
+ * `read()`. Reads larger than `Config::chunk_size`, or made while every chunk
+ * is still held or in flight, get a dedicated buffer rather than blocking.
+ */
+class ReadbackQueue : public GlobalAccess {
+public:
+  /* WebGPU requires buffer copy offsets and sizes to be multiples of 4. */
+  static constexpr uint64_t copy_alignment    = 4;
+  /* requests start on this boundary, so mappings can be viewed as any tensor */
+  static constexpr uint64_t request_alignment = 16;
+
+  struct Config {
+    uint64_t chunk_size = 1 << 20;
+    size_t   max_chunks = 8;
+  };
+
+  struct Stats {
+    uint64_t bytes_read          = 0;
+    uint64_t requests            = 0;
+    uint64_t dedicated_readbacks = 0;
+    uint64_t failed_maps         = 0;
+    uint64_t submissions         = 0;
+    size_t   chunks_allocated    = 0;
+  };
+
+  class Mapping;
+
+  /* `status` is an error, and the mapping empty, if the map failed */
+  using Callback = std::function<void(ustd::result status, Mapping mapping)>;
+
+  ReadbackQueue(Context &context);
+  ReadbackQueue(Context &context, Config config);
+  ~ReadbackQueue();
+
+  ReadbackQueue(const ReadbackQueue &)            = delete;
+  ReadbackQueue &operator=(const ReadbackQueue &) = delete;
+
+  ReadbackQueue(ReadbackQueue &&)                 = delete;
+  ReadbackQueue &operator=(ReadbackQueue &&)      = delete;
+
+  /**
+   * @brief Queue a copy of `[offset, offset + size)` of `src`, which needs
+   * `wgpu::BufferUsage::CopySrc`, to be read back after the next `submit()`.
+   */
+  [[nodiscard]] ustd::result read(const wgpu::Buffer &src,
+                                  uint64_t            offset,
+                                  uint64_t            size,
+                                  Callback            callback);
+
+  /**
+   * @brief Record every queued copy into one command buffer, submit it and
+   * map the chunks it copies into. Does nothing if no reads are queued.
+   */
+  [[nodiscard]] ustd::result submit();
+
+  /* block until every submitted read has called back */
+  void                       wait();
+
+  /* submitted reads that have not called back yet */
+  size_t                     getInFlight() const;
+  const Stats               &getStats() const;
+
+private:
+  struct Request {
+    wgpu::Buffer src;
+    uint64_t     src_offset;
+    uint64_t     offset;
+    uint64_t     size;
+    Callback     callback;
+  };
+
+  struct Chunk {
+    TrackedBuffer        buffer;
+    uint64_t             capacity    = 0;
+    uint64_t             head        = 0;
+    uint64_t             mapped_size = 0;
+    bool                 dedicated   = false;
+    bool                 map_pending = false;
+    wgpu::Future         map_future  = {};
+    /* live `Mapping`s of this chunk */
+    size_t               leases      = 0;
+    std::vector<Request> requests    = {};
+  };
+
+  Chunk *acquireChunk(uint64_t size);
+  Chunk *createChunk(uint64_t capacity, bool dedicated);
+  void   mapChunk(Chunk *chunk);
+  void   completeChunk(Chunk *chunk, bool mapped, const char *message);
+  /* drop one lease, and unmap and recycle the chunk after the last */
+  void   release(Chunk *chunk);
+  void   destroyChunk(Chunk *chunk);
+
+  const Config                        config_;
+  Stats                               stats_       = {};
+  size_t                              in_flight_   = 0;
+
+  std::vector<std::unique_ptr<Chunk>> chunks_      = {};
+  std::vector<Chunk *>                free_chunks_ = {};
+  std::vector<Chunk *>                used_chunks_ = {};
+  Chunk                              *current_     = nullptr;
+};
+
+/**
+ * @brief A read-only view of one completed readback, straight into mapped
+ * memory. Move-only; the chunk behind it is unmapped once every mapping of
+ * it is destroyed. Must not outlive its `ReadbackQueue`.
+ */
+class ReadbackQueue::Mapping {
+public:
+  Mapping() = default;
+  ~Mapping();
+
+  Mapping(const Mapping &)            = delete;
+  Mapping &operator=(const Mapping &) = delete;
+
+  Mapping(Mapping &&other) noexcept;
+  Mapping &operator=(Mapping &&other) noexcept;
+
+  std::span<const std::byte> bytes() const;
+
+  template <typename T>
+  std::span<const T> as() const
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+    return {reinterpret_cast<const T *>(bytes_.data()),
+            bytes_.size() / sizeof(T)};
+  }
+
+  bool empty() const;
+
+  /* release the mapping early */
+  void reset();
+
+private:
+  friend class ReadbackQueue;
+
+  Mapping(ReadbackQueue *queue, Chunk *chunk, std::span<const std::byte> bytes);
+
+  ReadbackQueue             *queue_ = nullptr;
+  Chunk                     *chunk_ = nullptr;
+  std::span<const std::byte> bytes_ = {};
+};
+
+} // namespace rndr
+
+#endif
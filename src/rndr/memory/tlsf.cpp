@@ -0,0 +1,287 @@
+/**
+ * @file tlsf.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "tlsf.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+
+namespace rndr {
+
+TlsfAllocator::TlsfAllocator(uint64_t capacity) : capacity_(capacity)
+{
+  for (auto &row : heads_) {
+    row.fill(invalid_node);
+  }
+
+  if (capacity_ > 0) {
+    uint32_t node     = createNode(0, capacity_);
+    nodes_[node].free = true;
+    insertFree(node);
+  }
+}
+
+std::optional<TlsfAllocator::Allocation>
+TlsfAllocator::allocate(uint64_t size, uint64_t alignment)
+{
+  assert(alignment > 0);
+
+  if (size == 0 || size > capacity_) {
+    return std::nullopt;
+  }
+
+  /* worst case padding needed to reach an aligned offset */
+  uint64_t search = size + alignment - 1;
+  if (search < size) {
+    return std::nullopt;
+  }
+
+  uint32_t node = findFree(search);
+  if (node == invalid_node) {
+    return std::nullopt;
+  }
+
+  removeFree(node);
+
+  uint64_t offset  = nodes_[node].offset;
+  uint64_t aligned = (offset + alignment - 1) / alignment * alignment;
+
+  if (uint64_t padding = aligned - offset; padding > 0) {
+    uint32_t rest     = split(node, padding);
+    nodes_[node].free = true;
+    insertFree(node);
+    node = rest;
+  }
+
+  if (nodes_[node].size > size) {
+    uint32_t tail     = split(node, size);
+    nodes_[tail].free = true;
+    insertFree(tail);
+  }
+
+  nodes_[node].free = false;
+  used_ += size;
+  ++allocations_;
+
+  return Allocation{aligned, size, node};
+}
+
+void TlsfAllocator::free(const Allocation &allocation)
+{
+  uint32_t node = allocation.node;
+  assert(node < nodes_.size() && !nodes_[node].free);
+
+  used_ -= nodes_[node].size;
+  --allocations_;
+  nodes_[node].free = true;
+
+  if (uint32_t prev = nodes_[node].prev_phys;
+      prev != invalid_node && nodes_[prev].free) {
+    removeFree(prev);
+    merge(prev, node);
+    node = prev;
+  }
+
+  if (uint32_t next = nodes_[node].next_phys;
+      next != invalid_node && nodes_[next].free) {
+    removeFree(next);
+    merge(node, next);
+  }
+
+  insertFree(node);
+}
+
+uint64_t TlsfAllocator::getCapacity() const
+{
+  return capacity_;
+}
+
+uint64_t TlsfAllocator::getUsed() const
+{
+  return used_;
+}
+
+size_t TlsfAllocator::getAllocationCount() const
+{
+  return allocations_;
+}
+
+uint64_t TlsfAllocator::getLargestFree() const
+{
+  if (fl_bitmap_ == 0) {
+    return 0;
+  }
+
+  /* every range in the highest populated bin beats all the other bins */
+  uint32_t fl      = 63 - std::countl_zero(fl_bitmap_);
+  uint32_t sl      = 31 - std::countl_zero(sl_bitmaps_[fl]);
+
+  uint64_t largest = 0;
+  for (uint32_t node = heads_[fl][sl]; node != invalid_node;
+       node          = nodes_[node].next_free) {
+    largest = std::max(largest, nodes_[node].size);
+  }
+  return largest;
+}
+
+void TlsfAllocator::mapping(uint64_t size, uint32_t &fl, uint32_t &sl)
+{
+  if (size < sl_count) {
+    fl = 0;
+    sl = static_cast<uint32_t>(size);
+    return;
+  }
+
+  uint32_t top = 63 - std::countl_zero(size);
+  sl           = static_cast<uint32_t>(size >> (top - sl_bits)) ^ sl_count;
+  fl           = top - sl_bits + 1;
+}
+
+uint32_t TlsfAllocator::createNode(uint64_t offset, uint64_t size)
+{
+  Node node   = {};
+  node.offset = offset;
+  node.size   = size;
+
+  if (!spare_nodes_.empty()) {
+    uint32_t index = spare_nodes_.back();
+    spare_nodes_.pop_back();
+    nodes_[index] = node;
+    return index;
+  }
+
+  nodes_.push_back(node);
+  return static_cast<uint32_t>(nodes_.size() - 1);
+}
+
+void TlsfAllocator::destroyNode(uint32_t node)
+{
+  spare_nodes_.push_back(node);
+}
+
+void TlsfAllocator::insertFree(uint32_t node)
+{
+  uint32_t fl, sl;
+  mapping(nodes_[node].size, fl, sl);
+
+  uint32_t head          = heads_[fl][sl];
+  nodes_[node].prev_free = invalid_node;
+  nodes_[node].next_free = head;
+  if (head != invalid_node) {
+    nodes_[head].prev_free = node;
+  }
+
+  heads_[fl][sl] = node;
+  fl_bitmap_ |= uint64_t{1} << fl;
+  sl_bitmaps_[fl] |= 1u << sl;
+}
+
+void TlsfAllocator::removeFree(uint32_t node)
+{
+  uint32_t fl, sl;
+  mapping(nodes_[node].size, fl, sl);
+
+  uint32_t prev = nodes_[node].prev_free;
+  uint32_t next = nodes_[node].next_free;
+
+  if (prev != invalid_node) {
+    nodes_[prev].next_free = next;
+  }
+  else {
+    heads_[fl][sl] = next;
+  }
+
+  if (next != invalid_node) {
+    nodes_[next].prev_free = prev;
+  }
+
+  if (heads_[fl][sl] == invalid_node) {
+    sl_bitmaps_[fl] &= ~(1u << sl);
+    if (sl_bitmaps_[fl] == 0) {
+      fl_bitmap_ &= ~(uint64_t{1} << fl);
+    }
+  }
+}
+
+uint32_t TlsfAllocator::findFree(uint64_t size) const
+{
+  uint32_t fl, sl;
+
+  /* round up to the next bin so that any range found is large enough */
+  uint64_t rounded = size;
+  if (size >= sl_count) {
+    uint32_t top = 63 - std::countl_zero(size);
+    rounded += (uint64_t{1} << (top - sl_bits)) - 1;
+  }
+
+  if (rounded >= size) {
+    mapping(rounded, fl, sl);
+
+    uint32_t sl_map = sl_bitmaps_[fl] & (~0u << sl);
+    if (sl_map == 0) {
+      uint64_t fl_map
+          = fl + 1 < 64 ? fl_bitmap_ & (~uint64_t{0} << (fl + 1)) : 0;
+      fl     = fl_map ? std::countr_zero(fl_map) : 0;
+      sl_map = fl_map ? sl_bitmaps_[fl] : 0;
+    }
+
+    if (sl_map != 0) {
+      return heads_[fl][std::countr_zero(sl_map)];
+    }
+  }
+
+  /* last resort, the request's own bin may still hold a large enough range */
+  mapping(size, fl, sl);
+  for (uint32_t node = heads_[fl][sl]; node != invalid_node;
+       node          = nodes_[node].next_free) {
+    if (nodes_[node].size >= size) {
+      return node;
+    }
+  }
+
+  return invalid_node;
+}
+
+uint32_t TlsfAllocator::split(uint32_t node, uint64_t size)
+{
+  assert(nodes_[node].size > size);
+
+  uint32_t rest = createNode(nodes_[node].offset + size,
+                             nodes_[node].size - size);
+
+  /* `createNode` may reallocate, so re-index rather than holding refs */
+  nodes_[rest].prev_phys = node;
+  nodes_[rest].next_phys = nodes_[node].next_phys;
+  if (nodes_[rest].next_phys != invalid_node) {
+    nodes_[nodes_[rest].next_phys].prev_phys = rest;
+  }
+
+  nodes_[node].next_phys = rest;
+  nodes_[node].size      = size;
+
+  return rest;
+}
+
+void TlsfAllocator::merge(uint32_t node, uint32_t next)
+{
+  assert(nodes_[node].next_phys == next);
+
+  nodes_[node].size += nodes_[next].size;
+  nodes_[node].next_phys = nodes_[next].next_phys;
+  if (nodes_[node].next_phys != invalid_node) {
+    nodes_[nodes_[node].next_phys].prev_phys = node;
+  }
+
+  destroyNode(next);
+}
+
+} // namespace rndr
@@ -0,0 +1,95 @@
+/**
+ * @file tlsf.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_TLSF_H_
+#define RNDR_TLSF_H_
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace rndr {
+
+/**
+ * @brief Two-Level Segregated Fit allocator over an abstract address range.
+ *
+ * Never touches the memory it manages, so it can carve up GPU buffers. Both
+ * allocation and free are O(1): free ranges are binned by the position of
+ * their highest set bit (first level) and then linearly within that power of
+ * two (second level), with a bitmap per level to find a fitting bin.
+ */
+class TlsfAllocator {
+public:
+  static constexpr uint32_t invalid_node = UINT32_MAX;
+
+  struct Allocation {
+    uint64_t offset = 0;
+    uint64_t size   = 0;
+    uint32_t node   = invalid_node;
+
+    bool     valid() const
+    {
+      return node != invalid_node;
+    }
+  };
+
+  explicit TlsfAllocator(uint64_t capacity);
+
+  std::optional<Allocation> allocate(uint64_t size, uint64_t alignment = 1);
+  void                      free(const Allocation &allocation);
+
+  uint64_t                  getCapacity() const;
+  uint64_t                  getUsed() const;
+  uint64_t                  getLargestFree() const;
+  size_t                    getAllocationCount() const;
+
+private:
+  static constexpr uint32_t sl_bits  = 4;
+  static constexpr uint32_t sl_count = 1 << sl_bits;
+  static constexpr uint32_t fl_count = 64 - sl_bits + 1;
+
+  struct Node {
+    uint64_t offset    = 0;
+    uint64_t size      = 0;
+    uint32_t prev_phys = invalid_node;
+    uint32_t next_phys = invalid_node;
+    uint32_t prev_free = invalid_node;
+    uint32_t next_free = invalid_node;
+    bool     free      = false;
+  };
+
+  static void mapping(uint64_t size, uint32_t &fl, uint32_t &sl);
+
+  uint32_t    createNode(uint64_t offset, uint64_t size);
+  void        destroyNode(uint32_t node);
+
+  void        insertFree(uint32_t node);
+  void        removeFree(uint32_t node);
+  uint32_t    findFree(uint64_t size) const;
+  uint32_t    split(uint32_t node, uint64_t size);
+  void        merge(uint32_t node, uint32_t next);
+
+  uint64_t                                            capacity_    = 0;
+  uint64_t                                            used_        = 0;
+  size_t                                              allocations_ = 0;
+
+  uint64_t                                            fl_bitmap_   = 0;
+  std::array<uint32_t, fl_count>                      sl_bitmaps_  = {};
+  std::array<std::array<uint32_t, sl_count>, fl_count> heads_       = {};
+
+  std::vector<Node>                                   nodes_       = {};
+  std::vector<uint32_t>                               spare_nodes_ = {};
+};
+
+} // namespace rndr
+
+#endif
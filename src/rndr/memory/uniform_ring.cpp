@@ -0,0 +1,151 @@
+/**
+ * @file uniform_ring.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "uniform_ring.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace rndr {
+
+static uint64_t align_up(uint64_t value, uint64_t alignment)
+{
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+UniformRing::UniformRing(Context &context, UploadRing &uploads)
+    : UniformRing(context, uploads, Config{})
+{
+}
+
+UniformRing::UniformRing(Context &context, UploadRing &uploads, Config config)
+    : GlobalAccess(context), uploads_(uploads), config_(config)
+{
+}
+
+ustd::result UniformRing::initialize()
+{
+  const wgpu::Limits &limits = getContext().getLimits();
+
+  if (limits.maxDynamicUniformBuffersPerPipelineLayout
+      < dynamic_binding_count) {
+    return ustd::unexpected(
+        "Device does not support dynamic uniform buffer offsets");
+  }
+
+  if (config_.binding_size > limits.maxUniformBufferBindingSize) {
+    return ustd::unexpected("Uniform ring binding size of "
+                            + std::to_string(config_.binding_size)
+                            + " exceeds maxUniformBufferBindingSize");
+  }
+
+  if (config_.frames_in_flight == 0
+      || config_.frame_capacity < config_.binding_size) {
+    return ustd::unexpected("Uniform ring is too small to hold a binding");
+  }
+
+  alignment_    = std::max<uint64_t>(4, limits.minUniformBufferOffsetAlignment);
+  segment_size_ = align_up(config_.frame_capacity, alignment_);
+
+  wgpu::BufferDescriptor buffer_desc = {};
+  buffer_desc.label = "Uniform Ring Buffer";
+  buffer_desc.usage = wgpu::BufferUsage::Uniform | wgpu::BufferUsage::CopyDst;
+  buffer_desc.size  = segment_size_ * config_.frames_in_flight;
+  buffer_ = getContext().createBuffer(buffer_desc, MemoryCategory::Uniform);
+
+  if (!buffer_) {
+    return ustd::unexpected("Failed to create uniform ring buffer");
+  }
+
+  wgpu::BindGroupLayoutEntry layout_entry = {};
+  layout_entry.binding                    = 0;
+  layout_entry.visibility                 = config_.visibility;
+  layout_entry.buffer.type                = wgpu::BufferBindingType::Uniform;
+  layout_entry.buffer.hasDynamicOffset    = true;
+  layout_entry.buffer.minBindingSize      = config_.binding_size;
+
+  wgpu::BindGroupLayoutDescriptor layout_desc = {};
+  layout_desc.label                           = "Uniform Ring Layout";
+  layout_desc.entryCount                      = 1;
+  layout_desc.entries                         = &layout_entry;
+  layout_ = getDevice().CreateBindGroupLayout(&layout_desc);
+
+  wgpu::BindGroupEntry group_entry = {};
+  group_entry.binding              = 0;
+  group_entry.buffer               = buffer_;
+  group_entry.offset               = 0;
+  group_entry.size                 = config_.binding_size;
+
+  wgpu::BindGroupDescriptor group_desc = {};
+  group_desc.label                     = "Uniform Ring Bind Group";
+  group_desc.layout                    = layout_;
+  group_desc.entryCount                = 1;
+  group_desc.entries                   = &group_entry;
+  bind_group_ = getDevice().CreateBindGroup(&group_desc);
+
+  return {};
+}
+
+void UniformRing::beginFrame()
+{
+  frame_                  = (frame_ + 1) % config_.frames_in_flight;
+  head_                   = 0;
+  stats_.bytes_this_frame = 0;
+}
+
+const wgpu::BindGroupLayout &UniformRing::getBindGroupLayout() const
+{
+  return layout_;
+}
+
+const wgpu::BindGroup &UniformRing::getBindGroup() const
+{
+  return bind_group_;
+}
+
+const UniformRing::Stats &UniformRing::getStats() const
+{
+  return stats_;
+}
+
+ustd::expected<UniformRing::Slot> UniformRing::reserve(uint64_t size)
+{
+  assert(buffer_ && "UniformRing::initialize() was not called");
+
+  if (size > config_.binding_size) {
+    return ustd::unexpected("Pushed constants are larger than the binding");
+  }
+
+  /*
+   * reserve whole aligned slots so consecutive pushes stay contiguous in
+   * staging memory and coalesce into one copy
+   */
+  uint64_t stride = align_up(size, alignment_);
+  if (head_ + std::max(stride, config_.binding_size) > segment_size_) {
+    return ustd::unexpected("Uniform ring is full for this frame");
+  }
+
+  uint64_t offset  = segment_size_ * frame_ + head_;
+  auto     staging = uploads_.reserve(buffer_, offset, stride);
+  if (!staging) {
+    return ustd::unexpected(staging.message());
+  }
+
+  head_ += stride;
+  ++stats_.pushes;
+  stats_.bytes_this_frame += stride;
+  stats_.peak_frame_bytes
+      = std::max(stats_.peak_frame_bytes, stats_.bytes_this_frame);
+
+  return Slot{static_cast<uint32_t>(offset), (*staging).data()};
+}
+
+} // namespace rndr
@@ -0,0 +1,128 @@
+/**
+ * @file uniform_ring.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_UNIFORM_RING_H_
+#define RNDR_UNIFORM_RING_H_
+
+#include "rndr/context.h"
+#include "rndr/memory/upload_ring.h"
+#include "ustd/expected.h"
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+/**
+ * @brief Per-frame ring of uniform data addressed through a single bind group
+ * with a dynamic offset.
+ *
+ * Each draw `push()`es its constants (typically a `basic_tensor`), which are
+ * written linearly into mapped staging memory of the `UploadRing`, and binds
+ * the ring's bind group with the returned offset. The buffer is split into
+ * one segment per frame in flight so that a frame's uploads never overwrite
+ * constants that a previous frame may still be reading.
+ */
+class UniformRing : public GlobalAccess {
+public:
+  struct Config {
+    /* bytes available to a single frame */
+    uint64_t frame_capacity   = 1 << 20;
+    uint32_t frames_in_flight = 3;
+    /* largest block of constants a single draw may push */
+    uint64_t binding_size     = 256;
+    /* stages that can see the binding */
+    wgpu::ShaderStage visibility
+        = wgpu::ShaderStage::Vertex | wgpu::ShaderStage::Fragment;
+  };
+
+  struct Stats {
+    uint64_t pushes           = 0;
+    uint64_t bytes_this_frame = 0;
+    uint64_t peak_frame_bytes = 0;
+  };
+
+  UniformRing(Context &context, UploadRing &uploads);
+  UniformRing(Context &context, UploadRing &uploads, Config config);
+
+  UniformRing(const UniformRing &)            = delete;
+  UniformRing &operator=(const UniformRing &) = delete;
+
+  UniformRing(UniformRing &&)                 = delete;
+  UniformRing &operator=(UniformRing &&)      = delete;
+
+  /**
+   * @brief Create the ring buffer and its bind group. Fails if the device
+   * cannot support the requested binding size or any dynamic uniform buffers.
+   */
+  [[nodiscard]] ustd::result initialize();
+
+  /* rotate to the next frame's segment */
+  void                       beginFrame();
+
+  /**
+   * @brief Copy `value` into this frame's segment.
+   *
+   * @return the dynamic offset to bind with
+   */
+  template <typename T>
+  [[nodiscard]] ustd::expected<uint32_t> push(const T &value)
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+    auto slot = reserve(sizeof(T));
+    if (!slot) {
+      return ustd::unexpected(slot.message());
+    }
+    std::memcpy((*slot).data, &value, sizeof(T));
+    return (*slot).offset;
+  }
+
+  template <typename Encoder>
+  void bind(const Encoder &encoder, uint32_t group_index, uint32_t offset) const
+  {
+    encoder.SetBindGroup(group_index, bind_group_, 1, &offset);
+  }
+
+  const wgpu::BindGroupLayout &getBindGroupLayout() const;
+  const wgpu::BindGroup       &getBindGroup() const;
+  const Stats                 &getStats() const;
+
+  /* number of dynamic uniform buffers the ring's layout consumes */
+  static constexpr uint32_t    dynamic_binding_count = 1;
+
+private:
+  struct Slot {
+    uint32_t   offset;
+    std::byte *data;
+  };
+
+  ustd::expected<Slot> reserve(uint64_t size);
+
+  UploadRing              &uploads_;
+  const Config             config_;
+
+  TrackedBuffer            buffer_       = {};
+  wgpu::BindGroupLayout    layout_       = {};
+  wgpu::BindGroup          bind_group_   = {};
+
+  uint64_t                 alignment_    = 256;
+  uint64_t                 segment_size_ = 0;
+  uint32_t                 frame_        = 0;
+  uint64_t                 head_         = 0;
+
+  Stats                    stats_        = {};
+};
+
+} // namespace rndr
+
+#endif
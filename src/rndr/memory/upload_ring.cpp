@@ -0,0 +1,326 @@
+/**
+ * @file upload_ring.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "upload_ring.h"
+#include "rndr/profiling/trace.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace rndr {
+
+static uint64_t align_up(uint64_t value, uint64_t alignment)
+{
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+UploadRing::UploadRing(Context &context) : UploadRing(context, Config{})
+{
+}
+
+UploadRing::UploadRing(Context &context, Config config)
+    : GlobalAccess(context), config_(config)
+{
+  assert(config_.chunk_size % copy_alignment == 0);
+  assert(config_.dedicated_threshold <= config_.chunk_size);
+}
+
+UploadRing::~UploadRing()
+{
+  /* map callbacks capture `this`, so they must all resolve before we go */
+  for (auto &chunk : chunks_) {
+    if (chunk->map_pending) {
+      getContext().blockOnFuture(chunk->map_future);
+    }
+  }
+}
+
+ustd::expected<std::span<std::byte>>
+UploadRing::reserve(const wgpu::Buffer &dst, uint64_t dst_offset, uint64_t size)
+{
+  if (dst_offset % copy_alignment != 0 || size % copy_alignment != 0) {
+    return ustd::unexpected(
+        "Upload offset and size must be multiples of 4 bytes");
+  }
+
+  if (size == 0) {
+    return std::span<std::byte>{};
+  }
+
+  stats_.bytes_uploaded += size;
+
+  if (size > config_.dedicated_threshold) {
+    return reserveDedicated(dst, dst_offset, size);
+  }
+
+  Chunk *chunk = acquireChunk(size);
+
+  /* ring is exhausted and nothing has come back yet, never block on it */
+  if (chunk == nullptr) {
+    return reserveDedicated(dst, dst_offset, size);
+  }
+
+  uint64_t offset = chunk->head;
+  chunk->head     = align_up(offset + size, copy_alignment);
+
+  recordCopy(chunk->buffer, offset, dst, dst_offset, size);
+
+  return std::span<std::byte>(chunk->mapped + offset, size);
+}
+
+ustd::result UploadRing::write(const wgpu::Buffer &dst,
+                               uint64_t            dst_offset,
+                               const void         *data,
+                               uint64_t            size)
+{
+  auto staging = reserve(dst, dst_offset, size);
+  if (!staging) {
+    return ustd::unexpected(staging.message());
+  }
+
+  std::memcpy((*staging).data(), data, size);
+  return {};
+}
+
+ustd::expected<std::span<std::byte>>
+UploadRing::reserveTexture(const wgpu::ImageCopyTexture &dst,
+                           const wgpu::Extent3D         &size,
+                           uint32_t                      bytes_per_row,
+                           uint32_t                      rows)
+{
+  if (bytes_per_row % row_alignment != 0) {
+    return ustd::unexpected("Texture rows must be multiples of 256 bytes apart");
+  }
+
+  uint64_t bytes = uint64_t{bytes_per_row} * rows * size.depthOrArrayLayers;
+  if (bytes == 0) {
+    return std::span<std::byte>{};
+  }
+
+  stats_.bytes_uploaded += bytes;
+
+  /* room for the padding that puts the copy on a texel block */
+  Chunk *chunk = bytes + texture_alignment <= config_.dedicated_threshold
+                     ? acquireChunk(bytes + texture_alignment)
+                     : nullptr;
+
+  wgpu::Buffer src;
+  uint64_t     src_offset = 0;
+  std::byte   *mapped     = nullptr;
+
+  if (chunk != nullptr) {
+    src_offset  = align_up(chunk->head, texture_alignment);
+    chunk->head = align_up(src_offset + bytes, copy_alignment);
+    src         = chunk->buffer;
+    mapped      = chunk->mapped + src_offset;
+  }
+  else {
+    dedicated_.push_back(createDedicated(bytes, &mapped));
+    src = dedicated_.back();
+    ++stats_.dedicated_uploads;
+  }
+
+  texture_copies_.push_back(
+      {src, src_offset, bytes_per_row, rows, dst, size});
+
+  return std::span<std::byte>(mapped, bytes);
+}
+
+ustd::result UploadRing::submit()
+{
+  RNDR_TRACE_ZONE("UploadRing::submit");
+
+  if (copies_.empty() && texture_copies_.empty()) {
+    return {};
+  }
+
+  /* staging memory must be unmapped before the copies may execute */
+  for (Chunk *chunk : used_chunks_) {
+    chunk->buffer.Unmap();
+    chunk->mapped = nullptr;
+  }
+
+  for (TrackedBuffer &buffer : dedicated_) {
+    buffer.Unmap();
+  }
+
+  wgpu::CommandEncoderDescriptor encoder_desc = {};
+  encoder_desc.label                          = "Upload Ring Command Encoder";
+  wgpu::CommandEncoder encoder
+      = getDevice().CreateCommandEncoder(&encoder_desc);
+
+  for (const PendingCopy &copy : copies_) {
+    encoder.CopyBufferToBuffer(copy.src, copy.src_offset, copy.dst,
+                               copy.dst_offset, copy.size);
+  }
+
+  for (const PendingTextureCopy &copy : texture_copies_) {
+    wgpu::ImageCopyBuffer src = {};
+    src.buffer                = copy.src;
+    src.layout.offset         = copy.src_offset;
+    src.layout.bytesPerRow    = copy.bytes_per_row;
+    src.layout.rowsPerImage   = copy.rows;
+    encoder.CopyBufferToTexture(&src, &copy.dst, &copy.size);
+  }
+
+  wgpu::CommandBufferDescriptor command_buffer_desc = {};
+  command_buffer_desc.label = "Upload Ring Command Buffer";
+  wgpu::CommandBuffer command_buffer = encoder.Finish(&command_buffer_desc);
+  getContext().getQueue().Submit(1, &command_buffer);
+
+  /* map requests resolve once the copies above have executed */
+  for (Chunk *chunk : used_chunks_) {
+    recycleChunk(chunk);
+  }
+
+  stats_.copies_recorded += copies_.size() + texture_copies_.size();
+  ++stats_.submissions;
+  ++submission_index_;
+
+  used_chunks_.clear();
+  for (TrackedBuffer &buffer : dedicated_) {
+    getContext().destroyLater(std::move(buffer));
+  }
+  dedicated_.clear();
+  copies_.clear();
+  texture_copies_.clear();
+  current_ = nullptr;
+
+  return {};
+}
+
+uint64_t UploadRing::getSubmissionIndex() const
+{
+  return submission_index_;
+}
+
+const UploadRing::Stats &UploadRing::getStats() const
+{
+  return stats_;
+}
+
+UploadRing::Chunk *UploadRing::acquireChunk(uint64_t size)
+{
+  if (current_ && current_->head + size <= config_.chunk_size) {
+    return current_;
+  }
+
+  if (free_chunks_.empty() && chunks_.size() < config_.max_chunks) {
+    current_ = createChunk();
+  }
+  else {
+    /* chunks come back from the caller's next `processEvents()`, never pump
+     * it from here, it runs every subsystem's callbacks */
+    if (free_chunks_.empty()) {
+      return nullptr;
+    }
+
+    current_ = free_chunks_.back();
+    free_chunks_.pop_back();
+  }
+
+  used_chunks_.push_back(current_);
+  return current_;
+}
+
+UploadRing::Chunk *UploadRing::createChunk()
+{
+  wgpu::BufferDescriptor buffer_desc = {};
+  buffer_desc.label            = "Upload Ring Staging Chunk";
+  buffer_desc.usage            = wgpu::BufferUsage::MapWrite
+                      | wgpu::BufferUsage::CopySrc;
+  buffer_desc.size             = config_.chunk_size;
+  buffer_desc.mappedAtCreation = true;
+
+  auto chunk                   = std::make_unique<Chunk>();
+  chunk->buffer
+      = getContext().createBuffer(buffer_desc, MemoryCategory::Staging);
+  chunk->mapped                = static_cast<std::byte *>(
+      chunk->buffer.GetMappedRange(0, config_.chunk_size));
+
+  chunks_.push_back(std::move(chunk));
+  stats_.chunks_allocated = chunks_.size();
+
+  return chunks_.back().get();
+}
+
+void UploadRing::recycleChunk(Chunk *chunk)
+{
+  chunk->map_pending = true;
+  chunk->map_future  = chunk->buffer.MapAsync(
+      wgpu::MapMode::Write, 0, config_.chunk_size,
+      wgpu::CallbackMode::AllowProcessEvents,
+      [this, chunk](wgpu::MapAsyncStatus status, const char *message) {
+        chunk->map_pending = false;
+
+        /* a failed map (e.g. device loss) retires the chunk for good */
+        if (status != wgpu::MapAsyncStatus::Success) {
+          return;
+        }
+
+        chunk->mapped = static_cast<std::byte *>(
+            chunk->buffer.GetMappedRange(0, config_.chunk_size));
+        chunk->head = 0;
+        free_chunks_.push_back(chunk);
+      });
+}
+
+void UploadRing::recordCopy(const wgpu::Buffer &src,
+                            uint64_t            src_offset,
+                            const wgpu::Buffer &dst,
+                            uint64_t            dst_offset,
+                            uint64_t            size)
+{
+  /* sequential writes to contiguous destination ranges become one copy */
+  if (!copies_.empty()) {
+    PendingCopy &last = copies_.back();
+    if (last.src.Get() == src.Get() && last.dst.Get() == dst.Get()
+        && last.src_offset + last.size == src_offset
+        && last.dst_offset + last.size == dst_offset) {
+      last.size += size;
+      ++stats_.copies_coalesced;
+      return;
+    }
+  }
+
+  copies_.push_back({src, src_offset, dst, dst_offset, size});
+}
+
+std::span<std::byte> UploadRing::reserveDedicated(const wgpu::Buffer &dst,
+                                                  uint64_t dst_offset,
+                                                  uint64_t size)
+{
+  std::byte    *mapped = nullptr;
+  TrackedBuffer buffer = createDedicated(size, &mapped);
+
+  recordCopy(buffer, 0, dst, dst_offset, size);
+  dedicated_.push_back(std::move(buffer));
+  ++stats_.dedicated_uploads;
+
+  return std::span<std::byte>(mapped, size);
+}
+
+TrackedBuffer UploadRing::createDedicated(uint64_t size, std::byte **mapped)
+{
+  wgpu::BufferDescriptor buffer_desc = {};
+  buffer_desc.label                  = "Upload Ring Dedicated Buffer";
+  buffer_desc.usage                  = wgpu::BufferUsage::CopySrc;
+  buffer_desc.size                   = align_up(size, copy_alignment);
+  buffer_desc.mappedAtCreation       = true;
+
+  TrackedBuffer buffer
+      = getContext().createBuffer(buffer_desc, MemoryCategory::Staging);
+  *mapped                            = static_cast<std::byte *>(
+      buffer.GetMappedRange(0, buffer_desc.size));
+  return buffer;
+}
+
+} // namespace rndr
@@ -0,0 +1,185 @@
+/**
+ * @file upload_ring.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_UPLOAD_RING_H_
+#define RNDR_UPLOAD_RING_H_
+
+#include "rndr/context.h"
+#include "ustd/expected.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+/**
+ * @brief Batches CPU-to-GPU buffer uploads through a ring of persistently
+ * mapped `MapWrite | CopySrc` staging chunks.
+ *
+ * Writes are placed directly into mapped staging memory. `submit()` unmaps
+ * every chunk used since the last submission, records all pending copies into
+ * a single command buffer, and re-maps the chunks with `MapAsync` so they
+ * return to the ring once the GPU is done with them. Uploads larger than
+ * `Config::dedicated_threshold` bypass the ring and use a one-off buffer.
+ *
+ * Chunks return to the ring from `Context::processEvents()`, which the ring
+ * never calls itself. While every chunk is still in flight, reservations fall
+ * back to a one-off buffer instead of waiting.
+ *
+ * Queue ordering guarantees that uploads are visible to any work submitted
+ * after `submit()` returns.
+ */
+class UploadRing : public GlobalAccess {
+public:
+  /* WebGPU requires buffer copy offsets and sizes to be multiples of 4. */
+  static constexpr uint64_t copy_alignment    = 4;
+  /* ...rows copied into textures to be multiples of 256 bytes apart... */
+  static constexpr uint32_t row_alignment     = 256;
+  /* ...and to start on a texel block, at most 16 bytes for any format. */
+  static constexpr uint64_t texture_alignment = 16;
+
+  struct Config {
+    uint64_t chunk_size          = 1 << 22;
+    size_t   max_chunks          = 16;
+    uint64_t dedicated_threshold = 1 << 21;
+  };
+
+  struct Stats {
+    uint64_t bytes_uploaded    = 0;
+    uint64_t copies_recorded   = 0;
+    uint64_t copies_coalesced  = 0;
+    uint64_t dedicated_uploads = 0;
+    uint64_t submissions       = 0;
+    size_t   chunks_allocated  = 0;
+  };
+
+  UploadRing(Context &context);
+  UploadRing(Context &context, Config config);
+  ~UploadRing();
+
+  UploadRing(const UploadRing &)            = delete;
+  UploadRing &operator=(const UploadRing &) = delete;
+
+  UploadRing(UploadRing &&)                 = delete;
+  UploadRing &operator=(UploadRing &&)      = delete;
+
+  /**
+   * @brief Reserve mapped staging memory that will be copied to
+   * `[dst_offset, dst_offset + size)` of `dst` on the next `submit()`.
+   *
+   * The returned span is only valid until the next call to `submit()`.
+   */
+  [[nodiscard]] ustd::expected<std::span<std::byte>>
+  reserve(const wgpu::Buffer &dst, uint64_t dst_offset, uint64_t size);
+
+  /**
+   * @brief Copy `size` bytes of `data` into staging memory, to be uploaded to
+   * `dst` on the next `submit()`.
+   */
+  [[nodiscard]] ustd::result write(const wgpu::Buffer &dst,
+                                   uint64_t            dst_offset,
+                                   const void         *data,
+                                   uint64_t            size);
+
+  template <typename T>
+  [[nodiscard]] ustd::result
+  write(const wgpu::Buffer &dst, uint64_t dst_offset, std::span<const T> data)
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+    return write(dst, dst_offset, data.data(), data.size_bytes());
+  }
+
+  /**
+   * @brief Reserve mapped staging memory for `rows` rows (of texel blocks,
+   * for compressed formats) spaced `bytes_per_row` apart, per layer of
+   * `size`, to be copied into `dst` on the next `submit()`.
+   *
+   * `bytes_per_row` must be a multiple of `row_alignment`. The returned span
+   * is only valid until the next call to `submit()`.
+   */
+  [[nodiscard]] ustd::expected<std::span<std::byte>>
+  reserveTexture(const wgpu::ImageCopyTexture &dst,
+                 const wgpu::Extent3D         &size,
+                 uint32_t                      bytes_per_row,
+                 uint32_t                      rows);
+
+  /**
+   * @brief Record every pending copy into one command buffer and submit it.
+   * Does nothing if no uploads are pending.
+   */
+  [[nodiscard]] ustd::result submit();
+
+  /* number of non-empty submissions made so far */
+  uint64_t     getSubmissionIndex() const;
+  const Stats &getStats() const;
+
+private:
+  struct Chunk {
+    TrackedBuffer buffer;
+    std::byte    *mapped      = nullptr;
+    uint64_t      head        = 0;
+    bool          map_pending = false;
+    wgpu::Future  map_future  = {};
+  };
+
+  struct PendingCopy {
+    wgpu::Buffer src;
+    uint64_t     src_offset;
+    wgpu::Buffer dst;
+    uint64_t     dst_offset;
+    uint64_t     size;
+  };
+
+  struct PendingTextureCopy {
+    wgpu::Buffer           src;
+    uint64_t               src_offset;
+    uint32_t               bytes_per_row;
+    uint32_t               rows;
+    wgpu::ImageCopyTexture dst;
+    wgpu::Extent3D         size;
+  };
+
+  Chunk       *acquireChunk(uint64_t size);
+  Chunk       *createChunk();
+  void         recycleChunk(Chunk *chunk);
+  void         recordCopy(const wgpu::Buffer &src,
+                          uint64_t            src_offset,
+                          const wgpu::Buffer &dst,
+                          uint64_t            dst_offset,
+                          uint64_t            size);
+
+  std::span<std::byte> reserveDedicated(const wgpu::Buffer &dst,
+                                        uint64_t            dst_offset,
+                                        uint64_t            size);
+  TrackedBuffer        createDedicated(uint64_t size, std::byte **mapped);
+
+  const Config                        config_;
+  Stats                               stats_            = {};
+  uint64_t                            submission_index_ = 0;
+
+  std::vector<std::unique_ptr<Chunk>> chunks_           = {};
+  std::vector<Chunk *>                free_chunks_      = {};
+  std::vector<Chunk *>                used_chunks_      = {};
+  Chunk                              *current_          = nullptr;
+
+  std::vector<TrackedBuffer>          dedicated_        = {};
+  std::vector<PendingCopy>            copies_           = {};
+  std::vector<PendingTextureCopy>     texture_copies_   = {};
+};
+
+} // namespace rndr
+
+#endif
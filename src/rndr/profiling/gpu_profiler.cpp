@@ -0,0 +1,277 @@
+/**
+ * @file gpu_profiler.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "gpu_profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+
+namespace rndr {
+
+GpuProfiler::GpuProfiler(Context &context) : GpuProfiler(context, Config{})
+{
+}
+
+GpuProfiler::GpuProfiler(Context &context, Config config)
+    : GlobalAccess(context), config_(config)
+{
+}
+
+GpuProfiler::~GpuProfiler()
+{
+  /* map callbacks capture `this`, so they must all resolve before we go */
+  for (auto &slot : slots_) {
+    if (slot->map_pending) {
+      getContext().blockOnFuture(slot->map_future);
+    }
+  }
+}
+
+ustd::result GpuProfiler::initialize()
+{
+  if (config_.frames_in_flight == 0 || config_.max_passes == 0) {
+    return ustd::unexpected("GPU profiler needs at least one pass and frame");
+  }
+
+  if (config_.history == 0) {
+    return ustd::unexpected("GPU profiler needs room for at least one sample");
+  }
+
+  timestamps_ = getContext().hasFeature(wgpu::FeatureName::TimestampQuery);
+
+  for (uint32_t i = 0; i < config_.frames_in_flight; ++i) {
+    slots_.push_back(std::make_unique<FrameSlot>());
+  }
+
+  if (!timestamps_) {
+    return {};
+  }
+
+  const uint32_t           query_count = config_.max_passes * 2;
+  const uint64_t           query_bytes = query_count * sizeof(uint64_t);
+
+  wgpu::QuerySetDescriptor query_desc  = {};
+  query_desc.label                     = "GPU Profiler Query Set";
+  query_desc.type                      = wgpu::QueryType::Timestamp;
+  query_desc.count                     = query_count;
+  query_set_ = getContext().createQuerySet(query_desc);
+
+  wgpu::BufferDescriptor buffer_desc = {};
+  buffer_desc.label                  = "GPU Profiler Resolve Buffer";
+  buffer_desc.usage
+      = wgpu::BufferUsage::QueryResolve | wgpu::BufferUsage::CopySrc;
+  buffer_desc.size = query_bytes;
+  resolve_ = getContext().createBuffer(buffer_desc, MemoryCategory::Query);
+
+  buffer_desc.label = "GPU Profiler Readback Buffer";
+  buffer_desc.usage = wgpu::BufferUsage::MapRead | wgpu::BufferUsage::CopyDst;
+  for (auto &slot : slots_) {
+    slot->readback
+        = getContext().createBuffer(buffer_desc, MemoryCategory::Readback);
+  }
+
+  render_writes_.resize(config_.max_passes);
+  compute_writes_.resize(config_.max_passes);
+
+  return {};
+}
+
+bool GpuProfiler::usesTimestamps() const
+{
+  return timestamps_;
+}
+
+void GpuProfiler::beginFrame()
+{
+  frame_   = (frame_ + 1) % config_.frames_in_flight;
+  current_ = slots_[frame_].get();
+
+  /* results this old not back yet means skipping a frame, never stalling */
+  if (current_->map_pending) {
+    current_ = nullptr;
+    return;
+  }
+
+  current_->names.clear();
+  current_->resolved = false;
+}
+
+const wgpu::RenderPassTimestampWrites *GpuProfiler::renderPass(const char *name)
+{
+  uint32_t begin_index;
+  if (!reservePass(name, begin_index)) {
+    return nullptr;
+  }
+
+  wgpu::RenderPassTimestampWrites &writes = render_writes_[begin_index / 2];
+  writes.querySet                         = query_set_;
+  writes.beginningOfPassWriteIndex        = begin_index;
+  writes.endOfPassWriteIndex              = begin_index + 1;
+  return &writes;
+}
+
+const wgpu::ComputePassTimestampWrites *
+GpuProfiler::computePass(const char *name)
+{
+  uint32_t begin_index;
+  if (!reservePass(name, begin_index)) {
+    return nullptr;
+  }
+
+  wgpu::ComputePassTimestampWrites &writes = compute_writes_[begin_index / 2];
+  writes.querySet                          = query_set_;
+  writes.beginningOfPassWriteIndex         = begin_index;
+  writes.endOfPassWriteIndex               = begin_index + 1;
+  return &writes;
+}
+
+void GpuProfiler::resolve(const wgpu::CommandEncoder &encoder)
+{
+  if (!timestamps_ || current_ == nullptr || current_->names.empty()) {
+    return;
+  }
+
+  const uint32_t query_count = current_->names.size() * 2;
+  encoder.ResolveQuerySet(query_set_, 0, query_count, resolve_, 0);
+  encoder.CopyBufferToBuffer(resolve_, 0, current_->readback, 0,
+                             query_count * sizeof(uint64_t));
+  current_->resolved = true;
+}
+
+void GpuProfiler::endFrame()
+{
+  if (!timestamps_) {
+    auto                 submitted = std::chrono::steady_clock::now();
+    std::weak_ptr<bool>  alive     = alive_;
+
+    getContext().getQueue().OnSubmittedWorkDone(
+        wgpu::CallbackMode::AllowProcessEvents,
+        [this, submitted, alive](wgpu::QueueWorkDoneStatus status) {
+          if (alive.expired() || status != wgpu::QueueWorkDoneStatus::Success) {
+            return;
+          }
+
+          std::chrono::duration<double, std::milli> elapsed
+              = std::chrono::steady_clock::now() - submitted;
+          addSample(cpu_fallback_name, elapsed.count());
+        });
+    return;
+  }
+
+  if (current_ == nullptr || !current_->resolved) {
+    return;
+  }
+
+  FrameSlot *slot   = current_;
+  size_t     size   = slot->names.size() * 2 * sizeof(uint64_t);
+  current_          = nullptr;
+
+  slot->map_pending = true;
+  slot->map_future  = slot->readback.MapAsync(
+      wgpu::MapMode::Read, 0, size, wgpu::CallbackMode::AllowProcessEvents,
+      [this, slot](wgpu::MapAsyncStatus status, const char *message) {
+        slot->map_pending = false;
+        if (status != wgpu::MapAsyncStatus::Success) {
+          std::cerr << "PROFILER READBACK FAILED WITH MESSAGE: " << message
+                    << std::endl;
+          return;
+        }
+
+        readSlot(*slot);
+        slot->readback.Unmap();
+      });
+}
+
+std::vector<GpuProfiler::PassStats> GpuProfiler::getStats() const
+{
+  std::vector<PassStats> stats;
+
+  for (const auto &[name, history] : history_) {
+    if (history.samples.empty()) {
+      continue;
+    }
+
+    std::vector<double> sorted = history.samples;
+    std::sort(sorted.begin(), sorted.end());
+
+    size_t    n = sorted.size();
+    PassStats pass;
+    pass.name    = name;
+    pass.samples = n;
+    pass.min_ms  = sorted.front();
+    pass.avg_ms  = std::accumulate(sorted.begin(), sorted.end(), 0.0) / n;
+    pass.p99_ms  = sorted[std::min(
+        n - 1, static_cast<size_t>(std::ceil(0.99 * n)) - 1)];
+    stats.push_back(std::move(pass));
+  }
+
+  return stats;
+}
+
+double GpuProfiler::getLatest(const std::string &name) const
+{
+  auto it = history_.find(name);
+  if (it == history_.end() || it->second.samples.empty()) {
+    return 0.0;
+  }
+
+  const History &history = it->second;
+  size_t         n       = history.samples.size();
+  return history.samples[(history.next + n - 1) % n];
+}
+
+bool GpuProfiler::reservePass(const char *name, uint32_t &begin_index)
+{
+  if (!timestamps_ || current_ == nullptr
+      || current_->names.size() >= config_.max_passes) {
+    return false;
+  }
+
+  begin_index = current_->names.size() * 2;
+  current_->names.emplace_back(name);
+  return true;
+}
+
+void GpuProfiler::readSlot(FrameSlot &slot)
+{
+  size_t          count = slot.names.size();
+  const uint64_t *ticks = static_cast<const uint64_t *>(
+      slot.readback.GetConstMappedRange(0, count * 2 * sizeof(uint64_t)));
+
+  for (size_t i = 0; i < count; ++i) {
+    uint64_t begin = ticks[2 * i];
+    uint64_t end   = ticks[2 * i + 1];
+
+    /* timestamps are in nanoseconds, but may be reset or reordered */
+    if (end >= begin) {
+      addSample(slot.names[i], static_cast<double>(end - begin) / 1e6);
+    }
+  }
+}
+
+void GpuProfiler::addSample(const std::string &name, double ms)
+{
+  History &history = history_[name];
+
+  if (history.samples.size() < config_.history) {
+    history.samples.push_back(ms);
+  }
+  else {
+    history.samples[history.next] = ms;
+  }
+
+  history.next = (history.next + 1) % config_.history;
+}
+
+} // namespace rndr
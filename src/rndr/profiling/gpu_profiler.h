@@ -0,0 +1,133 @@
+/**
+ * @file gpu_profiler.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_GPU_PROFILER_H_
+#define RNDR_GPU_PROFILER_H_
+
+#include "rndr/context.h"
+#include "ustd/expected.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+/**
+ * @brief Per-pass GPU timings from timestamp queries, read back a few frames
+ * late so that the CPU never waits on the GPU.
+ *
+ * Each frame, hand the result of `renderPass()`/`computePass()` to the pass
+ * descriptor's `timestampWrites`, call `resolve()` on the frame's encoder
+ * before finishing it, and `endFrame()` after submitting it.
+ *
+ * Without `wgpu::FeatureName::TimestampQuery` the pass accessors return
+ * `nullptr` and the profiler instead records, under `cpu_fallback_name`, the
+ * time from `endFrame()` to the queue reporting the frame's work as done.
+ */
+class GpuProfiler : public GlobalAccess {
+public:
+  static constexpr const char *cpu_fallback_name = "submit (cpu)";
+
+  struct Config {
+    uint32_t max_passes       = 32;
+    /* depth of the readback ring, i.e. how many frames results may lag */
+    uint32_t frames_in_flight = 3;
+    /* samples kept per pass for the statistics */
+    size_t   history          = 256;
+  };
+
+  struct PassStats {
+    std::string name;
+    double      min_ms  = 0.0;
+    double      avg_ms  = 0.0;
+    double      p99_ms  = 0.0;
+    size_t      samples = 0;
+  };
+
+  GpuProfiler(Context &context);
+  GpuProfiler(Context &context, Config config);
+  ~GpuProfiler();
+
+  GpuProfiler(const GpuProfiler &)            = delete;
+  GpuProfiler &operator=(const GpuProfiler &) = delete;
+
+  GpuProfiler(GpuProfiler &&)                 = delete;
+  GpuProfiler &operator=(GpuProfiler &&)      = delete;
+
+  [[nodiscard]] ustd::result initialize();
+  bool                       usesTimestamps() const;
+
+  void                       beginFrame();
+
+  /**
+   * @brief Timestamp writes for the next named pass of this frame, or
+   * `nullptr` if timestamps are unavailable, the pass budget is used up, or
+   * this frame's readback slot is still in flight.
+   */
+  const wgpu::RenderPassTimestampWrites  *renderPass(const char *name);
+  const wgpu::ComputePassTimestampWrites *computePass(const char *name);
+
+  /* record the query resolve and readback copy for this frame's passes */
+  void                   resolve(const wgpu::CommandEncoder &encoder);
+
+  /* call after the command buffer containing `resolve()` was submitted */
+  void                   endFrame();
+
+  std::vector<PassStats> getStats() const;
+
+  /* the most recent sample of the named pass, or 0 if there is none yet */
+  double                 getLatest(const std::string &name) const;
+
+private:
+  struct FrameSlot {
+    TrackedBuffer            readback    = {};
+    std::vector<std::string> names       = {};
+    bool                     resolved    = false;
+    bool                     map_pending = false;
+    wgpu::Future             map_future  = {};
+  };
+
+  struct History {
+    std::vector<double> samples = {};
+    size_t              next    = 0;
+  };
+
+  bool     reservePass(const char *name, uint32_t &begin_index);
+  void     readSlot(FrameSlot &slot);
+  void     addSample(const std::string &name, double ms);
+
+  const Config                                   config_;
+  bool                                           timestamps_ = false;
+
+  TrackedQuerySet                                query_set_  = {};
+  TrackedBuffer                                  resolve_    = {};
+
+  std::vector<std::unique_ptr<FrameSlot>>        slots_      = {};
+  FrameSlot                                     *current_    = nullptr;
+  uint32_t                                       frame_      = 0;
+
+  std::vector<wgpu::RenderPassTimestampWrites>   render_writes_  = {};
+  std::vector<wgpu::ComputePassTimestampWrites>  compute_writes_ = {};
+
+  std::map<std::string, History>                 history_        = {};
+
+  /* lets fallback callbacks outliving the profiler know to bail */
+  std::shared_ptr<bool>                          alive_
+      = std::make_shared<bool>(true);
+};
+
+} // namespace rndr
+
+#endif
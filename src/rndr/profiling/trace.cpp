@@ -0,0 +1,189 @@
+/**
+ * @file trace.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "trace.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace rndr::trace {
+
+namespace {
+
+struct Event {
+  const char *name  = nullptr;
+  uint64_t    begin = 0;
+  uint64_t    end   = 0;
+};
+
+struct ThreadRing {
+  std::array<Event, ring_capacity> events = {};
+  /* total zones ever written; only the owning thread stores to it */
+  std::atomic<uint64_t>            head   = 0;
+  /* zones before this index were cleared */
+  std::atomic<uint64_t>            tail   = 0;
+  uint32_t                         tid    = 0;
+};
+
+struct Registry {
+  std::mutex                               mutex;
+  std::vector<std::shared_ptr<ThreadRing>> rings;
+  /* rings of finished threads, taken by new threads before allocating */
+  std::vector<std::shared_ptr<ThreadRing>> free_rings;
+};
+
+Registry &registry()
+{
+  static Registry instance;
+  return instance;
+}
+
+/* a thread's claim on a ring, handed back when the thread exits */
+struct RingOwner {
+  std::shared_ptr<ThreadRing> ring;
+
+  RingOwner()
+  {
+    Registry       &reg = registry();
+    std::lock_guard lock(reg.mutex);
+
+    /* a recycled ring keeps its zones and tid, the lane of its old thread
+     * simply continues with the new one */
+    if (!reg.free_rings.empty()) {
+      ring = std::move(reg.free_rings.back());
+      reg.free_rings.pop_back();
+      return;
+    }
+
+    ring      = std::make_shared<ThreadRing>();
+    ring->tid = static_cast<uint32_t>(reg.rings.size());
+    reg.rings.push_back(ring);
+  }
+
+  ~RingOwner()
+  {
+    Registry       &reg = registry();
+    std::lock_guard lock(reg.mutex);
+    reg.free_rings.push_back(std::move(ring));
+  }
+};
+
+ThreadRing &thread_ring()
+{
+  /* registering takes the lock once per thread, recording never does */
+  thread_local RingOwner owner;
+  return *owner.ring;
+}
+
+void write_escaped(std::ostream &os, const char *str)
+{
+  static const char hex[] = "0123456789abcdef";
+
+  for (; *str != '\0'; ++str) {
+    unsigned char c = static_cast<unsigned char>(*str);
+    if (c < 0x20) {
+      /* control characters are not allowed raw in JSON strings */
+      os << "\\u00" << hex[c >> 4] << hex[c & 0xf];
+      continue;
+    }
+    if (c == '"' || c == '\\') {
+      os << '\\';
+    }
+    os << *str;
+  }
+}
+
+} // namespace
+
+uint64_t now()
+{
+  static const auto epoch = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - epoch)
+      .count();
+}
+
+void record(const char *name, uint64_t begin, uint64_t end)
+{
+  ThreadRing &ring                  = thread_ring();
+  uint64_t    head                  = ring.head.load(std::memory_order_relaxed);
+  ring.events[head % ring_capacity] = {name, begin, end};
+  ring.head.store(head + 1, std::memory_order_release);
+}
+
+std::string exportChromeTrace()
+{
+  std::ostringstream oss;
+  /* fixed, so that long traces keep nanosecond precision in microseconds */
+  oss << std::fixed << std::setprecision(3);
+  oss << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+  Registry       &reg = registry();
+  std::lock_guard lock(reg.mutex);
+
+  bool            first = true;
+  for (const auto &ring : reg.rings) {
+    uint64_t head  = ring->head.load(std::memory_order_acquire);
+    uint64_t tail  = ring->tail.load(std::memory_order_relaxed);
+    uint64_t begin = std::max(tail, head > ring_capacity ? head - ring_capacity
+                                                         : uint64_t{0});
+
+    for (uint64_t i = begin; i < head; ++i) {
+      const Event &event = ring->events[i % ring_capacity];
+
+      oss << (first ? "" : ",") << "{\"name\":\"";
+      write_escaped(oss, event.name);
+      /* chrome expects microseconds */
+      oss << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << ring->tid
+          << ",\"ts\":" << event.begin / 1000.0
+          << ",\"dur\":" << (event.end - event.begin) / 1000.0 << "}";
+      first = false;
+    }
+  }
+
+  oss << "]}";
+  return oss.str();
+}
+
+ustd::result writeChromeTrace(const std::filesystem::path &path)
+{
+  std::ofstream ofs(path);
+  if (!ofs) {
+    return ustd::unexpected("Failed to open trace file " + path.string());
+  }
+
+  ofs << exportChromeTrace();
+  if (!ofs) {
+    return ustd::unexpected("Failed to write trace file " + path.string());
+  }
+
+  return {};
+}
+
+void clear()
+{
+  Registry       &reg = registry();
+  std::lock_guard lock(reg.mutex);
+  for (const auto &ring : reg.rings) {
+    ring->tail.store(ring->head.load(std::memory_order_acquire),
+                     std::memory_order_relaxed);
+  }
+}
+
+} // namespace rndr::trace
@@ -0,0 +1,91 @@
+/**
+ * @file trace.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_TRACE_H_
+#define RNDR_TRACE_H_
+
+#include "ustd/expected.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+/**
+ * @brief Scoped CPU zones exported as Chrome trace JSON, viewable in
+ * `chrome://tracing` or Perfetto.
+ *
+ * Each thread records into its own fixed-size ring, so recording takes no
+ * locks; once a ring is full its oldest zones are overwritten. Rings are
+ * registered with the exporter on a thread's first zone. A finished thread's
+ * ring is recycled by the next new thread, so its zones still show up, on the
+ * same lane, while memory stays bounded by the most threads alive at once.
+ *
+ * `RNDR_TRACE_ZONE` compiles to nothing unless the library is configured with
+ * `-DRNDR_ENABLE_TRACING=ON`. The functions below remain available either way.
+ */
+namespace rndr::trace {
+
+/* zones each thread keeps before overwriting its oldest */
+constexpr size_t ring_capacity = 1 << 14;
+
+/* nanoseconds since the first call in this process */
+uint64_t         now();
+
+void             record(const char *name, uint64_t begin, uint64_t end);
+
+/**
+ * @brief Serialize every thread's recorded zones. Meant for after the fact, as
+ * zones recorded concurrently with the export may be torn.
+ */
+std::string      exportChromeTrace();
+[[nodiscard]] ustd::result
+     writeChromeTrace(const std::filesystem::path &path);
+
+/* forget all zones recorded so far */
+void clear();
+
+class Zone {
+public:
+  /* `name` must outlive the export, e.g. a string literal */
+  explicit Zone(const char *name) : name_(name), begin_(now())
+  {
+  }
+
+  ~Zone()
+  {
+    record(name_, begin_, now());
+  }
+
+  Zone(const Zone &)            = delete;
+  Zone &operator=(const Zone &) = delete;
+
+  Zone(Zone &&)                 = delete;
+  Zone &operator=(Zone &&)      = delete;
+
+private:
+  const char *name_;
+  uint64_t    begin_;
+};
+
+} // namespace rndr::trace
+
+#define RNDR_TRACE_CONCAT_IMPL(a, b) a##b
+#define RNDR_TRACE_CONCAT(a, b)      RNDR_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef RNDR_ENABLE_TRACING
+#define RNDR_TRACE_ZONE(name)                                                 \
+  ::rndr::trace::Zone RNDR_TRACE_CONCAT(rndr_trace_zone_, __LINE__)(name)
+#else
+#define RNDR_TRACE_ZONE(name) ((void)0)
+#endif
+
+#endif
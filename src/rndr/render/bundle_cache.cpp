@@ -0,0 +1,77 @@
+/**
+ * @file bundle_cache.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "bundle_cache.h"
+
+namespace rndr {
+
+const std::vector<wgpu::RenderBundle> *BundleCache::find(uint64_t key,
+                                                         uint64_t version)
+{
+  auto entry = entries_.find(key);
+  if (entry == entries_.end() || entry->second.version != version) {
+    ++stats_.misses;
+    return nullptr;
+  }
+
+  ++stats_.hits;
+  return &entry->second.bundles;
+}
+
+const std::vector<wgpu::RenderBundle> &
+BundleCache::insert(uint64_t                        key,
+                    uint64_t                        version,
+                    std::vector<wgpu::RenderBundle> bundles)
+{
+  Entry &entry  = entries_[key];
+  entry.version = version;
+  entry.bundles = std::move(bundles);
+  return entry.bundles;
+}
+
+ustd::expected<std::span<const wgpu::RenderBundle>>
+BundleCache::getOrRecord(ParallelRecorder         &recorder,
+                         uint64_t                  key,
+                         uint64_t                  version,
+                         std::span<const DrawCall> draws,
+                         const RenderTargetLayout &layout)
+{
+  if (const auto *bundles = find(key, version)) {
+    return std::span<const wgpu::RenderBundle>(*bundles);
+  }
+
+  auto bundles = recorder.record(draws, layout);
+  if (!bundles) {
+    return ustd::unexpected(bundles.message());
+  }
+
+  return std::span<const wgpu::RenderBundle>(
+      insert(key, version, std::move(*bundles)));
+}
+
+void BundleCache::erase(uint64_t key)
+{
+  entries_.erase(key);
+}
+
+void BundleCache::clear()
+{
+  entries_.clear();
+}
+
+BundleCache::Stats BundleCache::getStats() const
+{
+  Stats stats   = stats_;
+  stats.entries = entries_.size();
+  return stats;
+}
+
+} // namespace rndr
@@ -0,0 +1,74 @@
+/**
+ * @file bundle_cache.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_BUNDLE_CACHE_H_
+#define RNDR_BUNDLE_CACHE_H_
+
+#include "rndr/render/parallel_recorder.h"
+#include "ustd/expected.h"
+
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+/**
+ * @brief Keeps the bundles of static draw lists across frames.
+ *
+ * Entries are looked up by a caller-chosen key and re-recorded whenever the
+ * caller's version for that key changes, e.g. when the draw list is edited or
+ * `BufferAllocator::getGeneration()` moves.
+ */
+class BundleCache {
+public:
+  struct Stats {
+    size_t hits    = 0;
+    size_t misses  = 0;
+    size_t entries = 0;
+  };
+
+  /* cached bundles for `key`, or `nullptr` if absent or of another version */
+  const std::vector<wgpu::RenderBundle> *find(uint64_t key, uint64_t version);
+
+  const std::vector<wgpu::RenderBundle> &
+       insert(uint64_t                        key,
+              uint64_t                        version,
+              std::vector<wgpu::RenderBundle> bundles);
+
+  /* the cached bundles, recording `draws` first if they are missing or stale */
+  [[nodiscard]] ustd::expected<std::span<const wgpu::RenderBundle>>
+       getOrRecord(ParallelRecorder         &recorder,
+                   uint64_t                  key,
+                   uint64_t                  version,
+                   std::span<const DrawCall> draws,
+                   const RenderTargetLayout &layout);
+
+  void erase(uint64_t key);
+  void clear();
+
+  Stats getStats() const;
+
+private:
+  struct Entry {
+    uint64_t                        version = 0;
+    std::vector<wgpu::RenderBundle> bundles = {};
+  };
+
+  std::unordered_map<uint64_t, Entry> entries_ = {};
+  Stats                               stats_   = {};
+};
+
+} // namespace rndr
+
+#endif
@@ -0,0 +1,114 @@
+/**
+ * @file depth_target.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "depth_target.h"
+
+#include <algorithm>
+
+namespace rndr {
+
+DepthTarget::DepthTarget(Context &context) : DepthTarget(context, Config{})
+{
+}
+
+DepthTarget::DepthTarget(Context &context, Config config)
+    : GlobalAccess(context), config_(config)
+{
+}
+
+void DepthTarget::resize(uint32_t width, uint32_t height)
+{
+  width  = std::max(width, 1u);
+  height = std::max(height, 1u);
+  if (texture_ && width == width_ && height == height_) {
+    return;
+  }
+
+  wgpu::TextureDescriptor texture_desc = {};
+  texture_desc.label                   = "Depth Target";
+  texture_desc.size                    = {width, height, 1};
+  texture_desc.format                  = config_.format;
+  texture_desc.sampleCount             = config_.sample_count;
+  texture_desc.usage = wgpu::TextureUsage::RenderAttachment | config_.usage;
+
+  getContext().destroyLater(std::move(texture_));
+  texture_ = getContext().createTexture(texture_desc);
+  view_    = texture_.CreateView();
+  width_   = width;
+  height_  = height;
+}
+
+void DepthTarget::fit(const wgpu::Texture &color)
+{
+  resize(color.GetWidth(), color.GetHeight());
+}
+
+wgpu::RenderPassDepthStencilAttachment DepthTarget::attachment(bool clear) const
+{
+  wgpu::RenderPassDepthStencilAttachment attachment = {};
+  attachment.view            = view_;
+  attachment.depthLoadOp     = clear ? wgpu::LoadOp::Clear : wgpu::LoadOp::Load;
+  attachment.depthStoreOp    = wgpu::StoreOp::Store;
+  attachment.depthClearValue = 1.f;
+
+  /* stencil ops must be left undefined for formats without stencil */
+  if (hasStencil(config_.format)) {
+    attachment.stencilLoadOp  = clear ? wgpu::LoadOp::Clear : wgpu::LoadOp::Load;
+    attachment.stencilStoreOp = wgpu::StoreOp::Store;
+  }
+
+  return attachment;
+}
+
+wgpu::DepthStencilState DepthTarget::state(wgpu::TextureFormat   format,
+                                           bool                  write,
+                                           wgpu::CompareFunction compare)
+{
+  wgpu::DepthStencilState state = {};
+  state.format                  = format;
+  state.depthWriteEnabled       = write;
+  state.depthCompare            = compare;
+  return state;
+}
+
+bool DepthTarget::hasStencil(wgpu::TextureFormat format)
+{
+  return format == wgpu::TextureFormat::Depth24PlusStencil8
+         || format == wgpu::TextureFormat::Depth32FloatStencil8
+         || format == wgpu::TextureFormat::Stencil8;
+}
+
+const wgpu::Texture &DepthTarget::getTexture() const
+{
+  return texture_;
+}
+
+const wgpu::TextureView &DepthTarget::getView() const
+{
+  return view_;
+}
+
+wgpu::TextureFormat DepthTarget::getFormat() const
+{
+  return config_.format;
+}
+
+uint32_t DepthTarget::getWidth() const
+{
+  return width_;
+}
+
+uint32_t DepthTarget::getHeight() const
+{
+  return height_;
+}
+
+} // namespace rndr
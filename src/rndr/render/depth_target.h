@@ -0,0 +1,88 @@
+/**
+ * @file depth_target.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_DEPTH_TARGET_H_
+#define RNDR_DEPTH_TARGET_H_
+
+#include "rndr/context.h"
+
+#include <cstdint>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+/**
+ * @brief A depth attachment that follows the size of the color target it is
+ * rendered alongside, e.g. the surface texture of each frame.
+ *
+ * With a depth prepass the first pass clears and writes depth through
+ * `Material::getDepthPipeline()`, with no color attachment at all, and the
+ * color pass then loads that depth and only shades the visible fragments:
+ *
+ *   pass 0: attachment(true),  depth-only pipelines, no color attachments
+ *   pass 1: attachment(false), color pipelines testing with `LessEqual`
+ */
+class DepthTarget : public GlobalAccess {
+public:
+  struct Config {
+    wgpu::TextureFormat format       = wgpu::TextureFormat::Depth24Plus;
+    uint32_t            sample_count = 1;
+    /* added to RenderAttachment, e.g. TextureBinding to sample depth later */
+    wgpu::TextureUsage  usage        = wgpu::TextureUsage::None;
+  };
+
+  DepthTarget(Context &context);
+  DepthTarget(Context &context, Config config);
+
+  DepthTarget(const DepthTarget &)            = delete;
+  DepthTarget &operator=(const DepthTarget &) = delete;
+
+  DepthTarget(DepthTarget &&)                 = delete;
+  DepthTarget &operator=(DepthTarget &&)      = delete;
+
+  /**
+   * @brief Recreate the texture if the size changed. The old texture is
+   * destroyed once the work already submitted with it has completed.
+   */
+  void resize(uint32_t width, uint32_t height);
+  /* resize to match `color`, which this target is rendered alongside */
+  void fit(const wgpu::Texture &color);
+
+  /**
+   * @brief The attachment of a pass, clearing depth to 1 for the first pass
+   * of a frame and keeping it for the passes after, e.g. after a prepass.
+   */
+  wgpu::RenderPassDepthStencilAttachment attachment(bool clear = true) const;
+
+  /* depth testing and writing for pipelines that draw into `format` */
+  static wgpu::DepthStencilState state(wgpu::TextureFormat   format,
+                                       bool                  write = true,
+                                       wgpu::CompareFunction compare
+                                       = wgpu::CompareFunction::Less);
+  static bool                    hasStencil(wgpu::TextureFormat format);
+
+  const wgpu::Texture           &getTexture() const;
+  const wgpu::TextureView       &getView() const;
+  wgpu::TextureFormat            getFormat() const;
+  uint32_t                       getWidth() const;
+  uint32_t                       getHeight() const;
+
+private:
+  const Config      config_;
+  TrackedTexture    texture_ = {};
+  wgpu::TextureView view_    = {};
+  uint32_t          width_   = 0;
+  uint32_t          height_  = 0;
+};
+
+} // namespace rndr
+
+#endif
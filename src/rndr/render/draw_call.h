@@ -0,0 +1,221 @@
+/**
+ * @file draw_call.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_DRAW_CALL_H_
+#define RNDR_DRAW_CALL_H_
+
+#include <array>
+#include <cstdint>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+/**
+ * @brief Everything needed to record one draw. The GPU objects are borrowed,
+ * so building large draw lists does not touch their reference counts; they
+ * must outlive the recording.
+ */
+struct DrawCall {
+  static constexpr uint32_t max_bind_groups = 4;
+
+  const wgpu::RenderPipeline                           *pipeline = nullptr;
+
+  std::array<const wgpu::BindGroup *, max_bind_groups> bind_groups = {};
+  /* groups whose bit is set are bound with their `dynamic_offsets` entry */
+  std::array<uint32_t, max_bind_groups>                dynamic_offsets     = {};
+  uint32_t                                             dynamic_offset_mask = 0;
+
+  const wgpu::Buffer *vertex_buffer  = nullptr;
+  uint64_t            vertex_offset  = 0;
+  uint64_t            vertex_size    = wgpu::kWholeSize;
+
+  const wgpu::Buffer *index_buffer   = nullptr;
+  uint64_t            index_offset   = 0;
+  uint64_t            index_size     = wgpu::kWholeSize;
+  wgpu::IndexFormat   index_format   = wgpu::IndexFormat::Uint32;
+
+  /* vertices, or indices if there is an index buffer */
+  uint32_t            element_count  = 0;
+  uint32_t            instance_count = 1;
+  uint32_t            first_element  = 0;
+  int32_t             base_vertex    = 0;
+  uint32_t            first_instance = 0;
+};
+
+/* record `draw` into a render pass or render bundle encoder */
+template <typename Encoder>
+void encode_draw(const Encoder &encoder, const DrawCall &draw)
+{
+  encoder.SetPipeline(*draw.pipeline);
+
+  for (uint32_t group = 0; group < DrawCall::max_bind_groups; ++group) {
+    if (draw.bind_groups[group] == nullptr) {
+      continue;
+    }
+
+    bool dynamic = (draw.dynamic_offset_mask >> group) & 1;
+    encoder.SetBindGroup(group, *draw.bind_groups[group], dynamic ? 1 : 0,
+                         dynamic ? &draw.dynamic_offsets[group] : nullptr);
+  }
+
+  if (draw.vertex_buffer != nullptr) {
+    encoder.SetVertexBuffer(0, *draw.vertex_buffer, draw.vertex_offset,
+                            draw.vertex_size);
+  }
+
+  if (draw.index_buffer != nullptr) {
+    encoder.SetIndexBuffer(*draw.index_buffer, draw.index_format,
+                           draw.index_offset, draw.index_size);
+    encoder.DrawIndexed(draw.element_count, draw.instance_count,
+                        draw.first_element, draw.base_vertex,
+                        draw.first_instance);
+  }
+  else {
+    encoder.Draw(draw.element_count, draw.instance_count, draw.first_element,
+                 draw.first_instance);
+  }
+}
+
+/**
+ * @brief Records draws into one encoder, skipping pipeline, bind group and
+ * buffer binds that would leave its state unchanged. WebGPU keeps bind groups
+ * and buffers bound across pipeline changes, so a sorted draw list only pays
+ * for the state that actually differs between neighbours.
+ */
+class StateTracker {
+public:
+  struct Counts {
+    uint32_t draws          = 0;
+    uint32_t pipelines      = 0;
+    uint32_t bind_groups    = 0;
+    uint32_t vertex_buffers = 0;
+    uint32_t index_buffers  = 0;
+    /* binds skipped because the state was already current */
+    uint32_t skipped        = 0;
+  };
+
+  template <typename Encoder>
+  void encode(const Encoder &encoder, const DrawCall &draw)
+  {
+    if (pipeline_ != draw.pipeline->Get()) {
+      pipeline_ = draw.pipeline->Get();
+      encoder.SetPipeline(*draw.pipeline);
+      ++counts_.pipelines;
+    }
+    else {
+      ++counts_.skipped;
+    }
+
+    for (uint32_t group = 0; group < DrawCall::max_bind_groups; ++group) {
+      if (draw.bind_groups[group] == nullptr) {
+        continue;
+      }
+
+      bool       dynamic = (draw.dynamic_offset_mask >> group) & 1;
+      BoundGroup bound   = {draw.bind_groups[group]->Get(),
+                            dynamic ? draw.dynamic_offsets[group] : 0, dynamic};
+      if (bound == groups_[group]) {
+        ++counts_.skipped;
+        continue;
+      }
+
+      groups_[group] = bound;
+      encoder.SetBindGroup(group, *draw.bind_groups[group], dynamic ? 1 : 0,
+                           dynamic ? &draw.dynamic_offsets[group] : nullptr);
+      ++counts_.bind_groups;
+    }
+
+    if (draw.vertex_buffer != nullptr) {
+      BoundBuffer bound = {draw.vertex_buffer->Get(), draw.vertex_offset,
+                           draw.vertex_size, wgpu::IndexFormat::Undefined};
+      if (bound == vertex_buffer_) {
+        ++counts_.skipped;
+      }
+      else {
+        vertex_buffer_ = bound;
+        encoder.SetVertexBuffer(0, *draw.vertex_buffer, draw.vertex_offset,
+                                draw.vertex_size);
+        ++counts_.vertex_buffers;
+      }
+    }
+
+    ++counts_.draws;
+    if (draw.index_buffer != nullptr) {
+      BoundBuffer bound = {draw.index_buffer->Get(), draw.index_offset,
+                           draw.index_size, draw.index_format};
+      if (bound == index_buffer_) {
+        ++counts_.skipped;
+      }
+      else {
+        index_buffer_ = bound;
+        encoder.SetIndexBuffer(*draw.index_buffer, draw.index_format,
+                               draw.index_offset, draw.index_size);
+        ++counts_.index_buffers;
+      }
+
+      encoder.DrawIndexed(draw.element_count, draw.instance_count,
+                          draw.first_element, draw.base_vertex,
+                          draw.first_instance);
+    }
+    else {
+      encoder.Draw(draw.element_count, draw.instance_count, draw.first_element,
+                   draw.first_instance);
+    }
+  }
+
+  /* forget the bound state, e.g. before recording into another encoder */
+  void reset()
+  {
+    pipeline_      = nullptr;
+    groups_        = {};
+    vertex_buffer_ = {};
+    index_buffer_  = {};
+  }
+
+  const Counts &getCounts() const
+  {
+    return counts_;
+  }
+
+  void resetCounts()
+  {
+    counts_ = {};
+  }
+
+private:
+  struct BoundGroup {
+    const void *group   = nullptr;
+    uint32_t    offset  = 0;
+    bool        dynamic = false;
+
+    bool        operator==(const BoundGroup &) const = default;
+  };
+
+  struct BoundBuffer {
+    const void       *buffer = nullptr;
+    uint64_t          offset = 0;
+    uint64_t          size   = 0;
+    wgpu::IndexFormat format = wgpu::IndexFormat::Undefined;
+
+    bool              operator==(const BoundBuffer &) const = default;
+  };
+
+  const void                                 *pipeline_      = nullptr;
+  std::array<BoundGroup, DrawCall::max_bind_groups> groups_  = {};
+  BoundBuffer                                 vertex_buffer_ = {};
+  BoundBuffer                                 index_buffer_  = {};
+
+  Counts                                      counts_        = {};
+};
+
+} // namespace rndr
+
+#endif
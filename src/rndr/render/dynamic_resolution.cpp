@@ -0,0 +1,224 @@
+/**
+ * @file dynamic_resolution.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "dynamic_resolution.h"
+#include "rndr/profiling/trace.h"
+
+#include <array>
+
+namespace rndr {
+
+static const char *upscale_source = R"(
+override SHARPEN: bool = false;
+
+@group(0) @binding(0) var source: texture_2d<f32>;
+@group(0) @binding(1) var source_sampler: sampler;
+
+struct VertexOut {
+  @builtin(position) position: vec4f,
+  @location(0) uv: vec2f,
+}
+
+/* one triangle covering the output, uv (0, 0) at its top left */
+@vertex
+fn vs_main(@builtin(vertex_index) vertex: u32) -> VertexOut {
+  let uv = vec2f(f32((vertex << 1u) & 2u), f32(vertex & 2u));
+
+  var out: VertexOut;
+  out.position = vec4f(uv * vec2f(2.0, -2.0) + vec2f(-1.0, 1.0), 0.0, 1.0);
+  out.uv       = uv;
+  return out;
+}
+
+fn sample_at(uv: vec2f) -> vec4f {
+  return textureSampleLevel(source, source_sampler, uv, 0.0);
+}
+
+@fragment
+fn fs_main(in: VertexOut) -> @location(0) vec4f {
+  let color = sample_at(in.uv);
+  if (!SHARPEN) {
+    return color;
+  }
+
+  /* push the color away from the average of its neighbours */
+  let texel = 1.0 / vec2f(textureDimensions(source));
+  let blur  = (sample_at(in.uv + vec2f(texel.x, 0.0))
+               + sample_at(in.uv - vec2f(texel.x, 0.0))
+               + sample_at(in.uv + vec2f(0.0, texel.y))
+               + sample_at(in.uv - vec2f(0.0, texel.y))) * 0.25;
+  return vec4f(saturate(color.rgb + 0.5 * (color.rgb - blur.rgb)), color.a);
+}
+)";
+
+static Material::Config upscaleConfig(const DynamicResolution::Config &config)
+{
+  wgpu::BindGroupLayoutEntry source = {};
+  source.binding                    = 0;
+  source.visibility                 = wgpu::ShaderStage::Fragment;
+  source.texture.sampleType         = wgpu::TextureSampleType::Float;
+  source.texture.viewDimension      = wgpu::TextureViewDimension::e2D;
+
+  wgpu::BindGroupLayoutEntry sampler = {};
+  sampler.binding                    = 1;
+  sampler.visibility                 = wgpu::ShaderStage::Fragment;
+  sampler.sampler.type               = wgpu::SamplerBindingType::Filtering;
+
+  Material::Config material = {};
+  material.shader_source    = upscale_source;
+  material.color_format     = config.output_format;
+  material.uses_mesh        = false;
+  material.features         = {"SHARPEN"};
+  /* the source changes with the scale, so it is bound as the frame group */
+  material.frame_entries    = {source, sampler};
+  return material;
+}
+
+DynamicResolution::DynamicResolution(Context &context, ResourceCache &cache)
+    : DynamicResolution(context, cache, Config{})
+{
+}
+
+DynamicResolution::DynamicResolution(Context       &context,
+                                     ResourceCache &cache,
+                                     Config         config)
+    : GlobalAccess(context),
+      config_(config),
+      controller_(config.controller),
+      material_(context, cache, upscaleConfig(config))
+{
+}
+
+ustd::result DynamicResolution::initialize()
+{
+  if (auto result = material_.initialize(); !result) {
+    return result;
+  }
+
+  if (config_.filter == Filter::Sharpen) {
+    variant_ = material_.getVariant({"SHARPEN"});
+  }
+
+  wgpu::SamplerDescriptor sampler_desc = {};
+  sampler_desc.label                   = "Upscale Sampler";
+  sampler_desc.magFilter               = wgpu::FilterMode::Linear;
+  sampler_desc.minFilter               = wgpu::FilterMode::Linear;
+  sampler_ = getDevice().CreateSampler(&sampler_desc);
+
+  return {};
+}
+
+void DynamicResolution::resize(uint32_t width, uint32_t height)
+{
+  auto [scaled_width, scaled_height] = controller_.scaled(width, height);
+  if (texture_ && scaled_width == width_ && scaled_height == height_) {
+    return;
+  }
+
+  RNDR_TRACE_ZONE("DynamicResolution::resize");
+
+  wgpu::TextureDescriptor texture_desc = {};
+  texture_desc.label                   = "Dynamic Resolution Target";
+  texture_desc.size                    = {scaled_width, scaled_height, 1};
+  texture_desc.format                  = config_.color_format;
+  texture_desc.usage = wgpu::TextureUsage::RenderAttachment
+                       | wgpu::TextureUsage::TextureBinding;
+
+  getContext().destroyLater(std::move(texture_));
+  texture_ = getContext().createTexture(texture_desc);
+  view_    = texture_.CreateView();
+  width_   = scaled_width;
+  height_  = scaled_height;
+
+  std::array<wgpu::BindGroupEntry, 2> entries = {};
+  entries[0].binding                          = 0;
+  entries[0].textureView                      = view_;
+  entries[1].binding                          = 1;
+  entries[1].sampler                          = sampler_;
+
+  wgpu::BindGroupDescriptor group_desc        = {};
+  group_desc.layout     = material_.getBindGroupLayout(frame_group);
+  group_desc.entryCount = entries.size();
+  group_desc.entries    = entries.data();
+  source_group_         = getDevice().CreateBindGroup(&group_desc);
+}
+
+void DynamicResolution::fit(const wgpu::Texture &output)
+{
+  resize(output.GetWidth(), output.GetHeight());
+}
+
+void DynamicResolution::upscale(
+    const wgpu::CommandEncoder             &encoder,
+    const wgpu::TextureView                &output,
+    const wgpu::RenderPassTimestampWrites *timestamps) const
+{
+  wgpu::RenderPassColorAttachment attachment = {};
+  attachment.view                            = output;
+  attachment.loadOp                          = wgpu::LoadOp::Clear;
+  attachment.storeOp                         = wgpu::StoreOp::Store;
+
+  wgpu::RenderPassDescriptor pass_desc       = {};
+  pass_desc.label                            = "Upscale Pass";
+  pass_desc.colorAttachmentCount             = 1;
+  pass_desc.colorAttachments                 = &attachment;
+  pass_desc.timestampWrites                  = timestamps;
+
+  DrawCall draw                              = {};
+  draw.element_count                         = 3;
+  material_.apply(draw, source_group_, variant_);
+
+  wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&pass_desc);
+  encode_draw(pass, draw);
+  pass.End();
+}
+
+bool DynamicResolution::addFrame(double gpu_ms, double cpu_ms)
+{
+  return controller_.addFrame(gpu_ms, cpu_ms);
+}
+
+float DynamicResolution::getScale() const
+{
+  return controller_.getScale();
+}
+
+const ResolutionController &DynamicResolution::getController() const
+{
+  return controller_;
+}
+
+ResolutionController &DynamicResolution::getController()
+{
+  return controller_;
+}
+
+const wgpu::Texture &DynamicResolution::getTexture() const
+{
+  return texture_;
+}
+
+const wgpu::TextureView &DynamicResolution::getView() const
+{
+  return view_;
+}
+
+uint32_t DynamicResolution::getWidth() const
+{
+  return width_;
+}
+
+uint32_t DynamicResolution::getHeight() const
+{
+  return height_;
+}
+
+} // namespace rndr
@@ -0,0 +1,105 @@
+/**
+ * @file dynamic_resolution.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_DYNAMIC_RESOLUTION_H_
+#define RNDR_DYNAMIC_RESOLUTION_H_
+
+#include "resolution_controller.h"
+#include "rndr/context.h"
+#include "rndr/resources/material.h"
+#include "rndr/resources/resource_cache.h"
+#include "ustd/expected.h"
+
+#include <cstdint>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+/**
+ * @brief An offscreen color target sized by a `ResolutionController`, and the
+ * pass that upscales it to the output with a bilinear or sharpening filter.
+ *
+ * Each frame, `fit()` the output texture, render the scene into `getView()`,
+ * with any depth target fit to `getTexture()`, then `upscale()` into the
+ * output and feed the frame's timings to `addFrame()`. The target is only
+ * recreated when the scale changes, at most once per `interval` frames.
+ */
+class DynamicResolution : public GlobalAccess {
+public:
+  enum class Filter {
+    Bilinear,
+    /* bilinear, then an unsharp mask one source texel wide */
+    Sharpen,
+  };
+
+  struct Config {
+    ResolutionController::Config controller    = {};
+    /* format of the target the scene renders into */
+    wgpu::TextureFormat color_format  = wgpu::TextureFormat::RGBA8Unorm;
+    /* format of the texture upscaled into, e.g. the surface's */
+    wgpu::TextureFormat output_format = wgpu::TextureFormat::BGRA8Unorm;
+    Filter                       filter        = Filter::Bilinear;
+  };
+
+  DynamicResolution(Context &context, ResourceCache &cache);
+  DynamicResolution(Context &context, ResourceCache &cache, Config config);
+
+  DynamicResolution(const DynamicResolution &)            = delete;
+  DynamicResolution &operator=(const DynamicResolution &) = delete;
+
+  DynamicResolution(DynamicResolution &&)                 = delete;
+  DynamicResolution &operator=(DynamicResolution &&)      = delete;
+
+  [[nodiscard]] ustd::result initialize();
+
+  /**
+   * @brief Size the target for an output of `width` x `height` at the current
+   * scale. The old target is destroyed once the work submitted with it is done.
+   */
+  void resize(uint32_t width, uint32_t height);
+  /* `resize()` for the texture `upscale()` will write to */
+  void fit(const wgpu::Texture &output);
+
+  /* record the upscale of the target into `output`, as a pass of its own */
+  void upscale(const wgpu::CommandEncoder             &encoder,
+               const wgpu::TextureView                &output,
+               const wgpu::RenderPassTimestampWrites *timestamps
+               = nullptr) const;
+
+  /* see `ResolutionController::addFrame()`, takes effect on the next `fit()` */
+  bool addFrame(double gpu_ms, double cpu_ms);
+
+  float                       getScale() const;
+  const ResolutionController &getController() const;
+  ResolutionController       &getController();
+
+  const wgpu::Texture        &getTexture() const;
+  const wgpu::TextureView    &getView() const;
+  uint32_t                    getWidth() const;
+  uint32_t                    getHeight() const;
+
+private:
+  const Config         config_;
+  ResolutionController controller_;
+  Material             material_;
+  uint32_t             variant_      = 0;
+
+  wgpu::Sampler        sampler_      = {};
+  TrackedTexture       texture_      = {};
+  wgpu::TextureView    view_         = {};
+  wgpu::BindGroup      source_group_ = {};
+  uint32_t             width_        = 0;
+  uint32_t             height_       = 0;
+};
+
+} // namespace rndr
+
+#endif
@@ -0,0 +1,91 @@
+/**
+ * @file frustum.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_FRUSTUM_H_
+#define RNDR_FRUSTUM_H_
+
+#include "rndr/math/matrix.h"
+
+#include <array>
+#include <cmath>
+
+namespace rndr {
+
+/* world-space bounds, laid out as a WGSL `vec4f` */
+struct BoundingSphere {
+  float x      = 0.f;
+  float y      = 0.f;
+  float z      = 0.f;
+  float radius = 0.f;
+};
+
+/**
+ * @brief The six inward-facing planes `(a, b, c, d)` of a view frustum, where
+ * a point is inside a plane when `a * x + b * y + c * z + d >= 0`.
+ */
+struct Frustum {
+  std::array<std::array<float, 4>, 6> planes = {};
+
+  /**
+   * @brief Extract the planes from a view-projection matrix laid out as the
+   * shaders read it, i.e. as a column-major `mat4x4f`, with WebGPU's [0, 1]
+   * clip depth.
+   */
+  static Frustum fromViewProjection(const math::matrix<4, 4> &view_projection)
+  {
+    auto  m   = view_projection.get_data();
+    auto  row = [&m](int r) {
+      return std::array<float, 4>{m[r], m[4 + r], m[8 + r], m[12 + r]};
+    };
+
+    auto  r0 = row(0), r1 = row(1), r2 = row(2), r3 = row(3);
+
+    Frustum frustum;
+    for (int i = 0; i < 4; ++i) {
+      frustum.planes[0][i] = r3[i] + r0[i]; /* left */
+      frustum.planes[1][i] = r3[i] - r0[i]; /* right */
+      frustum.planes[2][i] = r3[i] + r1[i]; /* bottom */
+      frustum.planes[3][i] = r3[i] - r1[i]; /* top */
+      frustum.planes[4][i] = r2[i];         /* near */
+      frustum.planes[5][i] = r3[i] - r2[i]; /* far */
+    }
+
+    /* normalized, so that plane distances compare against radii */
+    for (auto &plane : frustum.planes) {
+      float length
+          = std::sqrt(plane[0] * plane[0] + plane[1] * plane[1]
+                      + plane[2] * plane[2]);
+      if (length > 0.f) {
+        for (float &v : plane) {
+          v /= length;
+        }
+      }
+    }
+
+    return frustum;
+  }
+
+  bool intersects(const BoundingSphere &sphere) const
+  {
+    for (const auto &plane : planes) {
+      if (plane[0] * sphere.x + plane[1] * sphere.y + plane[2] * sphere.z
+              + plane[3]
+          < -sphere.radius) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+} // namespace rndr
+
+#endif
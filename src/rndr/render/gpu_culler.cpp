@@ -0,0 +1,657 @@
+/**
+ * @file gpu_culler.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "gpu_culler.h"
+#include "rndr/profiling/trace.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace rndr {
+
+static constexpr uint64_t vertex_stride = sizeof(math::vec3);
+static constexpr uint64_t index_stride  = sizeof(uint32_t);
+static constexpr uint32_t no_slot       = std::numeric_limits<uint32_t>::max();
+
+static const char        *cull_source   = R"(
+struct Camera {
+  planes: array<vec4f, 6>,
+  position: vec4f,
+  instance_count: u32,
+  slot_count: u32,
+}
+
+struct Cullable {
+  sphere: vec4f,
+  draw: u32,
+}
+
+struct Draw {
+  first_slot: u32,
+  lod_count: u32,
+  max_distance: vec4f,
+  visible_base: vec4u,
+}
+
+@group(0) @binding(0) var<uniform> camera: Camera;
+@group(0) @binding(1) var<storage, read> cullables: array<Cullable>;
+@group(0) @binding(2) var<storage, read> draws: array<Draw>;
+@group(0) @binding(3) var<storage, read_write> args: array<atomic<u32>>;
+@group(0) @binding(4) var<storage, read_write> visible: array<u32>;
+
+@compute @workgroup_size(64)
+fn reset(@builtin(global_invocation_id) id: vec3u) {
+  if (id.x < camera.slot_count) {
+    atomicStore(&args[id.x * 5u + 1u], 0u);
+  }
+}
+
+@compute @workgroup_size(64)
+fn cull(@builtin(global_invocation_id) id: vec3u) {
+  if (id.x >= camera.instance_count) {
+    return;
+  }
+
+  let sphere = cullables[id.x].sphere;
+  for (var i = 0u; i < 6u; i++) {
+    let plane = camera.planes[i];
+    if (dot(plane.xyz, sphere.xyz) + plane.w < -sphere.w) {
+      return;
+    }
+  }
+
+  let entry = draws[cullables[id.x].draw];
+  let dist = max(distance(sphere.xyz, camera.position.xyz) - sphere.w, 0.0);
+  var lod = 0u;
+  while (lod < entry.lod_count && dist > entry.max_distance[lod]) {
+    lod++;
+  }
+  if (lod == entry.lod_count) {
+    return;
+  }
+
+  let index = atomicAdd(&args[(entry.first_slot + lod) * 5u + 1u], 1u);
+  visible[entry.visible_base[lod] + index] = id.x;
+}
+)";
+
+static uint64_t align_up(uint64_t value, uint64_t alignment)
+{
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+static uint32_t group_count(uint32_t invocations)
+{
+  return (invocations + GpuCuller::workgroup_size - 1)
+         / GpuCuller::workgroup_size;
+}
+
+GpuCuller::GpuCuller(Context &context, UploadRing &uploads)
+    : GpuCuller(context, uploads, Config{})
+{
+}
+
+GpuCuller::GpuCuller(Context &context, UploadRing &uploads, Config config)
+    : GlobalAccess(context), uploads_(uploads), config_(config)
+{
+}
+
+ustd::result GpuCuller::initialize()
+{
+  const wgpu::Limits &limits = getContext().getLimits();
+
+  if (group_count(config_.max_instances)
+      > limits.maxComputeWorkgroupsPerDimension) {
+    return ustd::unexpected(
+        "Culling dispatch exceeds maxComputeWorkgroupsPerDimension");
+  }
+
+  if (uint64_t{config_.max_instances} * sizeof(Transform)
+      > limits.maxStorageBufferBindingSize) {
+    return ustd::unexpected(
+        "Instance buffer exceeds the device's maxStorageBufferBindingSize");
+  }
+
+  /* dynamic offsets into the visible list must be aligned */
+  region_alignment_ = std::max<uint32_t>(
+      1, limits.minStorageBufferOffsetAlignment / sizeof(uint32_t));
+
+  wgpu::BindGroupLayoutEntry render_entries[2] = {};
+  for (uint32_t i = 0; i < 2; ++i) {
+    render_entries[i].binding    = i;
+    render_entries[i].visibility = wgpu::ShaderStage::Vertex;
+    render_entries[i].buffer.type = wgpu::BufferBindingType::ReadOnlyStorage;
+  }
+  render_entries[0].buffer.minBindingSize   = sizeof(Transform);
+  render_entries[1].buffer.minBindingSize   = sizeof(uint32_t);
+  render_entries[1].buffer.hasDynamicOffset = true;
+
+  wgpu::BindGroupLayoutDescriptor layout_desc = {};
+  layout_desc.label                           = "Culled Instance Layout";
+  layout_desc.entryCount                      = 2;
+  layout_desc.entries                         = render_entries;
+  render_layout_ = getDevice().CreateBindGroupLayout(&layout_desc);
+
+  wgpu::BindGroupLayoutEntry cull_entries[5] = {};
+  for (uint32_t i = 0; i < 5; ++i) {
+    cull_entries[i].binding    = i;
+    cull_entries[i].visibility = wgpu::ShaderStage::Compute;
+  }
+  cull_entries[0].buffer.type = wgpu::BufferBindingType::Uniform;
+  cull_entries[1].buffer.type = wgpu::BufferBindingType::ReadOnlyStorage;
+  cull_entries[2].buffer.type = wgpu::BufferBindingType::ReadOnlyStorage;
+  cull_entries[3].buffer.type = wgpu::BufferBindingType::Storage;
+  cull_entries[4].buffer.type = wgpu::BufferBindingType::Storage;
+
+  layout_desc.label           = "Culling Layout";
+  layout_desc.entryCount      = 5;
+  layout_desc.entries         = cull_entries;
+  cull_layout_ = getDevice().CreateBindGroupLayout(&layout_desc);
+
+  wgpu::PipelineLayoutDescriptor pipeline_layout_desc = {};
+  pipeline_layout_desc.bindGroupLayoutCount           = 1;
+  pipeline_layout_desc.bindGroupLayouts               = &cull_layout_;
+  wgpu::PipelineLayout pipeline_layout
+      = getDevice().CreatePipelineLayout(&pipeline_layout_desc);
+
+  wgpu::ShaderModuleWGSLDescriptor wgsl_desc = {};
+  wgsl_desc.code                             = cull_source;
+
+  wgpu::ShaderModuleDescriptor module_desc   = {};
+  module_desc.nextInChain                    = &wgsl_desc;
+  module_desc.label                          = "Culling Shader";
+  wgpu::ShaderModule module = getDevice().CreateShaderModule(&module_desc);
+
+  wgpu::ComputePipelineDescriptor pipeline_desc = {};
+  pipeline_desc.layout                          = pipeline_layout;
+  pipeline_desc.compute.module                  = module;
+
+  pipeline_desc.label                           = "Culling Reset Pipeline";
+  pipeline_desc.compute.entryPoint              = "reset";
+  reset_pipeline_ = getDevice().CreateComputePipeline(&pipeline_desc);
+
+  pipeline_desc.label                           = "Culling Pipeline";
+  pipeline_desc.compute.entryPoint              = "cull";
+  cull_pipeline_ = getDevice().CreateComputePipeline(&pipeline_desc);
+
+  if (!reset_pipeline_ || !cull_pipeline_) {
+    return ustd::unexpected("Failed to create culling pipelines");
+  }
+
+  wgpu::BufferDescriptor buffer_desc = {};
+  buffer_desc.label = "Culling Camera Buffer";
+  buffer_desc.usage = wgpu::BufferUsage::Uniform | wgpu::BufferUsage::CopyDst;
+  buffer_desc.size  = sizeof(GpuCamera);
+  camera_buffer_
+      = getContext().createBuffer(buffer_desc, MemoryCategory::Uniform);
+
+  return {};
+}
+
+void GpuCuller::clear()
+{
+  draws_.clear();
+  slots_.clear();
+  transforms_.clear();
+  cullables_.clear();
+  cpu_counts_.clear();
+  built_ = false;
+  stats_ = {};
+}
+
+ustd::expected<uint32_t> GpuCuller::addDraw(const wgpu::RenderPipeline &pipeline,
+                                            std::span<const Lod>        lods)
+{
+  if (lods.empty() || lods.size() > max_lods) {
+    return ustd::unexpected("A culled draw needs between 1 and "
+                            + std::to_string(max_lods) + " LODs");
+  }
+
+  if (draws_.size() >= config_.max_draws) {
+    return ustd::unexpected("Culler draw table is full");
+  }
+
+  for (const Lod &lod : lods) {
+    if (lod.mesh == nullptr || !lod.mesh->isUploaded()) {
+      return ustd::unexpected("Cannot cull a mesh that is not uploaded");
+    }
+  }
+
+  DrawRecord draw;
+  draw.pipeline   = &pipeline;
+  draw.lods       = {lods.begin(), lods.end()};
+  draw.first_slot = draws_.empty() ? 0
+                                   : draws_.back().first_slot
+                                         + static_cast<uint32_t>(
+                                             draws_.back().lods.size());
+  draws_.push_back(std::move(draw));
+  built_ = false;
+
+  return static_cast<uint32_t>(draws_.size() - 1);
+}
+
+ustd::expected<uint32_t> GpuCuller::addInstance(uint32_t              draw,
+                                                const Transform      &transform,
+                                                const BoundingSphere &bounds)
+{
+  if (draw >= draws_.size()) {
+    return ustd::unexpected("Instance of an unknown draw");
+  }
+
+  if (cullables_.size() >= config_.max_instances) {
+    return ustd::unexpected("Culler is full");
+  }
+
+  transforms_.push_back(transform);
+  cullables_.push_back({bounds, draw, {}});
+  ++draws_[draw].instance_count;
+  built_ = false;
+
+  return static_cast<uint32_t>(cullables_.size() - 1);
+}
+
+GpuCuller::GpuDraw GpuCuller::packDraw(const DrawRecord &draw) const
+{
+  GpuDraw packed   = {};
+  packed.first_slot = draw.first_slot;
+  packed.lod_count  = static_cast<uint32_t>(draw.lods.size());
+  for (size_t lod = 0; lod < draw.lods.size(); ++lod) {
+    packed.max_distance[lod] = draw.lods[lod].max_distance;
+    packed.visible_base[lod] = slots_[draw.first_slot + lod].visible_base;
+  }
+  return packed;
+}
+
+GpuCuller::GpuCamera
+GpuCuller::packCamera(const Transform  &view_projection,
+                      const math::vec3 &camera_position) const
+{
+  Frustum   frustum  = Frustum::fromViewProjection(view_projection);
+  auto      position = camera_position.get_data();
+
+  GpuCamera camera   = {};
+  std::memcpy(camera.planes, frustum.planes.data(), sizeof(camera.planes));
+  camera.position[0]    = position[0];
+  camera.position[1]    = position[1];
+  camera.position[2]    = position[2];
+  camera.instance_count = static_cast<uint32_t>(cullables_.size());
+  camera.slot_count     = static_cast<uint32_t>(slots_.size());
+  return camera;
+}
+
+ustd::result GpuCuller::build()
+{
+  RNDR_TRACE_ZONE("GpuCuller::build");
+
+  assert(camera_buffer_ && "GpuCuller::initialize() was not called");
+
+  slots_.clear();
+  built_ = false;
+
+  if (draws_.empty()) {
+    return ustd::unexpected("Nothing to cull, no draw was added");
+  }
+
+  /* one visible region per slot, large enough for every instance of its draw */
+  uint64_t visible_count = 0;
+  uint64_t region_count  = 1;
+  for (const DrawRecord &draw : draws_) {
+    uint64_t region = align_up(std::max<uint32_t>(draw.instance_count, 1),
+                               region_alignment_);
+    region_count    = std::max(region_count, region);
+
+    for (const Lod &lod : draw.lods) {
+      BufferRange vertices = lod.mesh->getVertexRange();
+      BufferRange indices  = lod.mesh->getIndexRange();
+
+      SlotDraw    slot     = {};
+      slot.pipeline        = draw.pipeline;
+      slot.index_buffer    = indices.buffer;
+      slot.index_count     = lod.mesh->getIndexCount();
+      slot.first_index     = static_cast<uint32_t>(indices.offset / index_stride);
+      slot.vertex_buffer   = vertices.buffer;
+
+      /* `baseVertex` can only express offsets that are whole vertices */
+      if (vertices.offset % vertex_stride == 0) {
+        slot.base_vertex
+            = static_cast<int32_t>(vertices.offset / vertex_stride);
+      }
+      else {
+        slot.vertex_offset = vertices.offset;
+      }
+
+      slot.visible_base   = static_cast<uint32_t>(visible_count);
+      slot.visible_offset
+          = static_cast<uint32_t>(visible_count * sizeof(uint32_t));
+      visible_count += region;
+
+      const SlotDraw *prev = slots_.empty() ? nullptr : &slots_.back();
+      slot.rebind_vertices = prev == nullptr
+                             || prev->vertex_buffer.Get()
+                                    != slot.vertex_buffer.Get()
+                             || prev->vertex_offset != slot.vertex_offset
+                             || prev->pipeline != slot.pipeline;
+      slot.rebind_indices  = prev == nullptr
+                            || prev->index_buffer.Get() != slot.index_buffer.Get()
+                            || prev->pipeline != slot.pipeline;
+
+      slots_.push_back(std::move(slot));
+    }
+  }
+
+  /* room past the last region so that every dynamic binding fits */
+  visible_count += region_count;
+  if (visible_count * sizeof(uint32_t)
+      > getContext().getLimits().maxStorageBufferBindingSize) {
+    slots_.clear();
+    return ustd::unexpected(
+        "Visible list exceeds the device's maxStorageBufferBindingSize");
+  }
+
+  auto create = [this](const char *label, wgpu::BufferUsage usage,
+                       uint64_t size) {
+    wgpu::BufferDescriptor buffer_desc = {};
+    buffer_desc.label                  = label;
+    buffer_desc.usage                  = usage | wgpu::BufferUsage::CopyDst;
+    buffer_desc.size                   = align_up(size, 4);
+    return getContext().createBuffer(buffer_desc, MemoryCategory::Storage);
+  };
+
+  size_t instance_count = std::max<size_t>(cullables_.size(), 1);
+  transform_buffer_
+      = create("Culled Transform Buffer", wgpu::BufferUsage::Storage,
+               instance_count * sizeof(Transform));
+  cullable_buffer_
+      = create("Culled Bounds Buffer", wgpu::BufferUsage::Storage,
+               instance_count * sizeof(GpuCullable));
+  draw_buffer_
+      = create("Culled Draw Buffer", wgpu::BufferUsage::Storage,
+               draws_.size() * sizeof(GpuDraw));
+  args_buffer_ = create("Culled Indirect Buffer",
+                        wgpu::BufferUsage::Storage | wgpu::BufferUsage::Indirect
+                            | wgpu::BufferUsage::CopySrc,
+                        slots_.size() * indirect_stride);
+  visible_buffer_
+      = create("Culled Visible Buffer",
+               wgpu::BufferUsage::Storage | wgpu::BufferUsage::CopySrc,
+               visible_count * sizeof(uint32_t));
+
+  if (!cullables_.empty()) {
+    auto transforms = uploads_.reserve(transform_buffer_, 0,
+                                       transforms_.size() * sizeof(Transform));
+    auto cullables  = uploads_.reserve(cullable_buffer_, 0,
+                                       cullables_.size() * sizeof(GpuCullable));
+    if (!transforms || !cullables) {
+      return ustd::unexpected("Failed to stage culled instances");
+    }
+    std::memcpy((*transforms).data(), transforms_.data(),
+                transforms_.size() * sizeof(Transform));
+    std::memcpy((*cullables).data(), cullables_.data(),
+                cullables_.size() * sizeof(GpuCullable));
+  }
+
+  auto draws = uploads_.reserve(draw_buffer_, 0,
+                                draws_.size() * sizeof(GpuDraw));
+  auto args  = uploads_.reserve(args_buffer_, 0,
+                                slots_.size() * indirect_stride);
+  if (!draws || !args) {
+    return ustd::unexpected("Failed to stage culled draws");
+  }
+
+  std::byte *dst = (*draws).data();
+  for (const DrawRecord &draw : draws_) {
+    GpuDraw packed = packDraw(draw);
+    std::memcpy(dst, &packed, sizeof(packed));
+    dst += sizeof(packed);
+  }
+
+  /* instance counts start at zero, until the first cull fills them in */
+  dst = (*args).data();
+  for (const SlotDraw &slot : slots_) {
+    uint32_t block[5] = {slot.index_count, 0, slot.first_index,
+                         static_cast<uint32_t>(slot.base_vertex), 0};
+    std::memcpy(dst, block, sizeof(block));
+    dst += indirect_stride;
+  }
+
+  if (auto result = createBindGroups(region_count); !result) {
+    return result;
+  }
+
+  stats_.instances = static_cast<uint32_t>(cullables_.size());
+  stats_.draws     = static_cast<uint32_t>(draws_.size());
+  stats_.slots     = static_cast<uint32_t>(slots_.size());
+  built_           = true;
+  return {};
+}
+
+ustd::result GpuCuller::createBindGroups(uint64_t region_count)
+{
+  wgpu::BindGroupEntry render_entries[2] = {};
+  render_entries[0].binding              = 0;
+  render_entries[0].buffer               = transform_buffer_;
+  render_entries[0].size                 = transform_buffer_.GetSize();
+  render_entries[1].binding              = 1;
+  render_entries[1].buffer               = visible_buffer_;
+  render_entries[1].size                 = region_count * sizeof(uint32_t);
+
+  wgpu::BindGroupDescriptor group_desc   = {};
+  group_desc.label                       = "Culled Instance Bind Group";
+  group_desc.layout                      = render_layout_;
+  group_desc.entryCount                  = 2;
+  group_desc.entries                     = render_entries;
+  render_group_ = getDevice().CreateBindGroup(&group_desc);
+
+  const wgpu::Buffer cull_buffers[5]
+      = {camera_buffer_, cullable_buffer_, draw_buffer_, args_buffer_,
+         visible_buffer_};
+
+  wgpu::BindGroupEntry cull_entries[5] = {};
+  for (uint32_t i = 0; i < 5; ++i) {
+    cull_entries[i].binding = i;
+    cull_entries[i].buffer  = cull_buffers[i];
+    cull_entries[i].size    = cull_buffers[i].GetSize();
+  }
+
+  group_desc.label      = "Culling Bind Group";
+  group_desc.layout     = cull_layout_;
+  group_desc.entryCount = 5;
+  group_desc.entries    = cull_entries;
+  cull_group_           = getDevice().CreateBindGroup(&group_desc);
+
+  if (!render_group_ || !cull_group_) {
+    return ustd::unexpected("Failed to create culling bind groups");
+  }
+
+  return {};
+}
+
+ustd::result GpuCuller::updateInstance(uint32_t              instance,
+                                       const Transform      &transform,
+                                       const BoundingSphere &bounds)
+{
+  if (!built_ || instance >= cullables_.size()) {
+    return ustd::unexpected("Cannot update an instance that was not built");
+  }
+
+  transforms_[instance]        = transform;
+  cullables_[instance].bounds = bounds;
+
+  auto dst_transform
+      = uploads_.reserve(transform_buffer_, instance * sizeof(Transform),
+                         sizeof(Transform));
+  auto dst_cullable
+      = uploads_.reserve(cullable_buffer_, instance * sizeof(GpuCullable),
+                         sizeof(GpuCullable));
+  if (!dst_transform || !dst_cullable) {
+    return ustd::unexpected("Failed to stage an instance update");
+  }
+
+  std::memcpy((*dst_transform).data(), &transform, sizeof(Transform));
+  std::memcpy((*dst_cullable).data(), &cullables_[instance],
+              sizeof(GpuCullable));
+  return {};
+}
+
+ustd::result GpuCuller::cull(const wgpu::CommandEncoder &encoder,
+                             const Transform            &view_projection,
+                             const math::vec3           &camera_position)
+{
+  RNDR_TRACE_ZONE("GpuCuller::cull");
+
+  if (!built_) {
+    return ustd::unexpected("GpuCuller::build() was not called");
+  }
+
+  GpuCamera camera = packCamera(view_projection, camera_position);
+  auto      staged = uploads_.reserve(camera_buffer_, 0, sizeof(GpuCamera));
+  if (!staged) {
+    return ustd::unexpected(staged.message());
+  }
+  std::memcpy((*staged).data(), &camera, sizeof(GpuCamera));
+
+  wgpu::ComputePassDescriptor pass_desc = {};
+  pass_desc.label                       = "Culling Pass";
+  wgpu::ComputePassEncoder pass         = encoder.BeginComputePass(&pass_desc);
+  pass.SetBindGroup(0, cull_group_);
+
+  /* dispatches in one pass are ordered, so the counts are zeroed first */
+  pass.SetPipeline(reset_pipeline_);
+  pass.DispatchWorkgroups(group_count(camera.slot_count));
+  ++stats_.dispatches;
+
+  if (camera.instance_count > 0) {
+    pass.SetPipeline(cull_pipeline_);
+    pass.DispatchWorkgroups(group_count(camera.instance_count));
+    ++stats_.dispatches;
+  }
+
+  pass.End();
+  return {};
+}
+
+ustd::result GpuCuller::cullOnCpu(const Transform  &view_projection,
+                                  const math::vec3 &camera_position)
+{
+  RNDR_TRACE_ZONE("GpuCuller::cullOnCpu");
+
+  if (!built_) {
+    return ustd::unexpected("GpuCuller::build() was not called");
+  }
+
+  GpuCamera camera = packCamera(view_projection, camera_position);
+  Frustum   frustum;
+  std::memcpy(frustum.planes.data(), camera.planes, sizeof(camera.planes));
+
+  cpu_counts_.assign(slots_.size(), 0);
+  cpu_slots_.resize(cullables_.size());
+
+  /* mirrors the `cull` entry point of the culling shader */
+  for (size_t i = 0; i < cullables_.size(); ++i) {
+    const BoundingSphere &sphere = cullables_[i].bounds;
+    cpu_slots_[i]                = no_slot;
+
+    if (!frustum.intersects(sphere)) {
+      continue;
+    }
+
+    const DrawRecord &draw = draws_[cullables_[i].draw];
+    float dx = sphere.x - camera.position[0];
+    float dy = sphere.y - camera.position[1];
+    float dz = sphere.z - camera.position[2];
+    float dist
+        = std::max(std::sqrt(dx * dx + dy * dy + dz * dz) - sphere.radius, 0.f);
+
+    uint32_t lod = 0;
+    while (lod < draw.lods.size() && dist > draw.lods[lod].max_distance) {
+      ++lod;
+    }
+    if (lod == draw.lods.size()) {
+      continue;
+    }
+
+    cpu_slots_[i] = draw.first_slot + lod;
+    ++cpu_counts_[cpu_slots_[i]];
+  }
+
+  /* stage each slot's region, then scatter the survivors into it */
+  std::vector<uint32_t *> cursors(slots_.size(), nullptr);
+  for (size_t slot = 0; slot < slots_.size(); ++slot) {
+    if (cpu_counts_[slot] == 0) {
+      continue;
+    }
+    auto region = uploads_.reserve(
+        visible_buffer_, slots_[slot].visible_base * sizeof(uint32_t),
+        cpu_counts_[slot] * sizeof(uint32_t));
+    if (!region) {
+      return ustd::unexpected(region.message());
+    }
+    cursors[slot] = reinterpret_cast<uint32_t *>((*region).data());
+  }
+
+  for (uint32_t i = 0; i < cpu_slots_.size(); ++i) {
+    if (cpu_slots_[i] != no_slot) {
+      *cursors[cpu_slots_[i]]++ = i;
+    }
+  }
+
+  auto args = uploads_.reserve(args_buffer_, 0, slots_.size() * indirect_stride);
+  if (!args) {
+    return ustd::unexpected(args.message());
+  }
+
+  std::byte *dst = (*args).data();
+  for (size_t slot = 0; slot < slots_.size(); ++slot) {
+    const SlotDraw &cmd      = slots_[slot];
+    uint32_t        block[5] = {cmd.index_count, cpu_counts_[slot],
+                                cmd.first_index,
+                                static_cast<uint32_t>(cmd.base_vertex), 0};
+    std::memcpy(dst, block, sizeof(block));
+    dst += indirect_stride;
+  }
+
+  return {};
+}
+
+uint32_t GpuCuller::getFirstSlot(uint32_t draw) const
+{
+  return draws_.at(draw).first_slot;
+}
+
+std::span<const uint32_t> GpuCuller::getCpuCounts() const
+{
+  return cpu_counts_;
+}
+
+const wgpu::BindGroupLayout &GpuCuller::getBindGroupLayout() const
+{
+  return render_layout_;
+}
+
+const wgpu::Buffer &GpuCuller::getArgsBuffer() const
+{
+  return args_buffer_;
+}
+
+const wgpu::Buffer &GpuCuller::getVisibleBuffer() const
+{
+  return visible_buffer_;
+}
+
+const GpuCuller::Stats &GpuCuller::getStats() const
+{
+  return stats_;
+}
+
+} // namespace rndr
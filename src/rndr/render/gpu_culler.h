@@ -0,0 +1,249 @@
+/**
+ * @file gpu_culler.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_GPU_CULLER_H_
+#define RNDR_GPU_CULLER_H_
+
+#include "rndr/context.h"
+#include "rndr/math/matrix.h"
+#include "rndr/memory/upload_ring.h"
+#include "rndr/render/frustum.h"
+#include "rndr/resources/renderable_mesh.h"
+#include "ustd/expected.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+/**
+ * @brief Frustum and distance culling of a persistent set of instances in a
+ * compute pass, which writes the survivors' `DrawIndexedIndirect` arguments
+ * without the CPU ever seeing the results.
+ *
+ * Every (draw, LOD) pair owns one indirect argument slot and one region of a
+ * visible-instance list. `cull()` zeroes the instance counts, then each
+ * surviving instance picks an LOD by distance, bumps that slot's count and
+ * appends its index to the slot's region. The vertex shader reads
+ * `transforms[visible[instance_index]]` through `getBindGroupLayout()`:
+ *
+ *   @group(N) @binding(0) var<storage, read> transforms: array<mat4x4f>;
+ *   @group(N) @binding(1) var<storage, read> visible: array<u32>;
+ *
+ * where `visible` is bound at each slot's region with a dynamic offset, so the
+ * arguments never need `wgpu::FeatureName::IndirectFirstInstance`.
+ *
+ * Instances, transforms and arguments are uploaded once by `build()`; a frame
+ * only uploads the camera. `cullOnCpu()` computes the same results on the CPU
+ * and uploads them instead, as a reference and a baseline.
+ */
+class GpuCuller : public GlobalAccess {
+public:
+  using Transform = math::matrix<4, 4>;
+
+  static constexpr uint32_t max_lods        = 4;
+  /* must match `@workgroup_size` in the culling shader */
+  static constexpr uint32_t workgroup_size  = 64;
+  static constexpr uint64_t indirect_stride = 5 * sizeof(uint32_t);
+
+  struct Config {
+    uint32_t max_instances = 1 << 20;
+    uint32_t max_draws     = 1 << 12;
+  };
+
+  struct Stats {
+    uint32_t instances   = 0;
+    uint32_t draws       = 0;
+    /* indirect argument slots, one per (draw, LOD) */
+    uint32_t slots       = 0;
+    uint32_t dispatches  = 0;
+  };
+
+  struct Lod {
+    const RenderableMesh *mesh         = nullptr;
+    /* instances further than this from the camera use the next LOD */
+    float                 max_distance = 0.f;
+  };
+
+  GpuCuller(Context &context, UploadRing &uploads);
+  GpuCuller(Context &context, UploadRing &uploads, Config config);
+
+  GpuCuller(const GpuCuller &)            = delete;
+  GpuCuller &operator=(const GpuCuller &) = delete;
+
+  GpuCuller(GpuCuller &&)                 = delete;
+  GpuCuller &operator=(GpuCuller &&)      = delete;
+
+  [[nodiscard]] ustd::result initialize();
+
+  /* forget every draw and instance */
+  void                       clear();
+
+  /**
+   * @brief Register a mesh with up to `max_lods` LODs, nearest first. Beyond
+   * the last LOD's `max_distance` instances are culled.
+   *
+   * @return id of the draw, to add instances of it with
+   */
+  [[nodiscard]] ustd::expected<uint32_t>
+  addDraw(const wgpu::RenderPipeline &pipeline, std::span<const Lod> lods);
+
+  /* `bounds` must enclose the transformed mesh of every LOD */
+  [[nodiscard]] ustd::expected<uint32_t> addInstance(uint32_t         draw,
+                                                     const Transform &transform,
+                                                     const BoundingSphere &bounds);
+
+  /**
+   * @brief Allocate the GPU buffers and queue every draw and instance on the
+   * `UploadRing`. Call again after adding draws or instances.
+   */
+  [[nodiscard]] ustd::result build();
+
+  /* queue a moved instance's new transform and bounds, after `build()` */
+  [[nodiscard]] ustd::result updateInstance(uint32_t              instance,
+                                            const Transform      &transform,
+                                            const BoundingSphere &bounds);
+
+  /**
+   * @brief Record the culling pass into `encoder`, ahead of the render pass
+   * that calls `draw()`. The camera is queued on the `UploadRing`, so only one
+   * view can be culled per submit.
+   */
+  [[nodiscard]] ustd::result cull(const wgpu::CommandEncoder &encoder,
+                                  const Transform            &view_projection,
+                                  const math::vec3           &camera_position);
+
+  /* the same culling on the CPU, with the results queued on the `UploadRing` */
+  [[nodiscard]] ustd::result cullOnCpu(const Transform  &view_projection,
+                                       const math::vec3 &camera_position);
+
+  /* issue one indirect draw per slot, with the instance data at `group_index` */
+  template <typename Encoder>
+  void draw(const Encoder &encoder, uint32_t group_index) const
+  {
+    const wgpu::RenderPipeline *pipeline = nullptr;
+    for (size_t i = 0; i < slots_.size(); ++i) {
+      const SlotDraw &slot = slots_[i];
+
+      if (slot.pipeline != pipeline) {
+        pipeline = slot.pipeline;
+        encoder.SetPipeline(*pipeline);
+      }
+      if (slot.rebind_vertices) {
+        encoder.SetVertexBuffer(0, slot.vertex_buffer, slot.vertex_offset);
+      }
+      if (slot.rebind_indices) {
+        encoder.SetIndexBuffer(slot.index_buffer, RenderableMesh::index_format);
+      }
+
+      encoder.SetBindGroup(group_index, render_group_, 1, &slot.visible_offset);
+      encoder.DrawIndexedIndirect(args_buffer_, i * indirect_stride);
+    }
+  }
+
+  uint32_t                     getFirstSlot(uint32_t draw) const;
+
+  /* per-slot instance counts found by the last `cullOnCpu()` */
+  std::span<const uint32_t>    getCpuCounts() const;
+
+  const wgpu::BindGroupLayout &getBindGroupLayout() const;
+  const wgpu::Buffer          &getArgsBuffer() const;
+  const wgpu::Buffer          &getVisibleBuffer() const;
+  const Stats                 &getStats() const;
+
+private:
+  /* the layouts below mirror the structs of the culling shader */
+  struct GpuCamera {
+    float    planes[6][4];
+    float    position[4];
+    uint32_t instance_count;
+    uint32_t slot_count;
+    uint32_t pad[2];
+  };
+
+  struct GpuCullable {
+    BoundingSphere bounds;
+    uint32_t       draw;
+    uint32_t       pad[3];
+  };
+
+  struct GpuDraw {
+    uint32_t first_slot;
+    uint32_t lod_count;
+    uint32_t pad[2];
+    float    max_distance[max_lods];
+    /* start of each LOD's visible region, in instances */
+    uint32_t visible_base[max_lods];
+  };
+
+  struct DrawRecord {
+    const wgpu::RenderPipeline *pipeline       = nullptr;
+    std::vector<Lod>            lods           = {};
+    uint32_t                    first_slot     = 0;
+    uint32_t                    instance_count = 0;
+  };
+
+  struct SlotDraw {
+    const wgpu::RenderPipeline *pipeline        = nullptr;
+    wgpu::Buffer                vertex_buffer   = {};
+    uint64_t                    vertex_offset   = 0;
+    wgpu::Buffer                index_buffer    = {};
+    uint32_t                    index_count     = 0;
+    uint32_t                    first_index     = 0;
+    int32_t                     base_vertex     = 0;
+    uint32_t                    visible_base    = 0;
+    uint32_t                    visible_offset  = 0;
+    bool                        rebind_vertices = false;
+    bool                        rebind_indices  = false;
+  };
+
+  GpuDraw            packDraw(const DrawRecord &draw) const;
+  GpuCamera          packCamera(const Transform  &view_projection,
+                                const math::vec3 &camera_position) const;
+  /* `region_count` is the largest visible region, in instances */
+  ustd::result       createBindGroups(uint64_t region_count);
+
+  UploadRing                 &uploads_;
+  const Config                config_;
+  /* visible regions start on multiples of this many instances */
+  uint32_t                    region_alignment_ = 1;
+  bool                        built_            = false;
+
+  wgpu::BindGroupLayout       render_layout_    = {};
+  wgpu::BindGroupLayout       cull_layout_      = {};
+  wgpu::ComputePipeline       reset_pipeline_   = {};
+  wgpu::ComputePipeline       cull_pipeline_    = {};
+
+  TrackedBuffer               camera_buffer_    = {};
+  TrackedBuffer               transform_buffer_ = {};
+  TrackedBuffer               cullable_buffer_  = {};
+  TrackedBuffer               draw_buffer_      = {};
+  TrackedBuffer               args_buffer_      = {};
+  TrackedBuffer               visible_buffer_   = {};
+  wgpu::BindGroup             render_group_     = {};
+  wgpu::BindGroup             cull_group_       = {};
+
+  std::vector<DrawRecord>     draws_            = {};
+  std::vector<SlotDraw>       slots_            = {};
+  std::vector<Transform>      transforms_       = {};
+  std::vector<GpuCullable>    cullables_        = {};
+  std::vector<uint32_t>       cpu_counts_       = {};
+  /* slot each instance landed in during `cullOnCpu()`, or none */
+  std::vector<uint32_t>       cpu_slots_        = {};
+
+  Stats                       stats_            = {};
+};
+
+} // namespace rndr
+
+#endif
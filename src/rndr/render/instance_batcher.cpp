@@ -0,0 +1,251 @@
+/**
+ * @file instance_batcher.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "instance_batcher.h"
+#include "rndr/profiling/trace.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+namespace rndr {
+
+static constexpr uint64_t vertex_stride = sizeof(math::vec3);
+static constexpr uint64_t index_stride  = sizeof(uint32_t);
+
+InstanceBatcher::InstanceBatcher(Context &context, UploadRing &uploads)
+    : InstanceBatcher(context, uploads, Config{})
+{
+}
+
+InstanceBatcher::InstanceBatcher(Context    &context,
+                                 UploadRing &uploads,
+                                 Config      config)
+    : GlobalAccess(context), uploads_(uploads), config_(config)
+{
+}
+
+ustd::result InstanceBatcher::initialize()
+{
+  uint64_t instance_bytes = uint64_t{config_.max_instances} * sizeof(Transform);
+  if (instance_bytes > getContext().getLimits().maxStorageBufferBindingSize) {
+    return ustd::unexpected(
+        "Instance buffer exceeds the device's maxStorageBufferBindingSize");
+  }
+
+  indirect_ = getContext().hasFeature(wgpu::FeatureName::IndirectFirstInstance);
+
+  wgpu::BufferDescriptor buffer_desc = {};
+  buffer_desc.label                  = "Instance Transform Buffer";
+  buffer_desc.usage = wgpu::BufferUsage::Storage | wgpu::BufferUsage::CopyDst
+                      | wgpu::BufferUsage::CopySrc;
+  buffer_desc.size = instance_bytes;
+  instance_buffer_
+      = getContext().createBuffer(buffer_desc, MemoryCategory::Storage);
+
+  if (indirect_) {
+    buffer_desc.label = "Instance Batch Indirect Buffer";
+    buffer_desc.usage
+        = wgpu::BufferUsage::Indirect | wgpu::BufferUsage::CopyDst;
+    buffer_desc.size = config_.max_batches * indirect_stride;
+    indirect_buffer_
+        = getContext().createBuffer(buffer_desc, MemoryCategory::Storage);
+  }
+
+  wgpu::BindGroupLayoutEntry layout_entry = {};
+  layout_entry.binding                    = 0;
+  layout_entry.visibility                 = wgpu::ShaderStage::Vertex;
+  layout_entry.buffer.type           = wgpu::BufferBindingType::ReadOnlyStorage;
+  layout_entry.buffer.minBindingSize = sizeof(Transform);
+
+  wgpu::BindGroupLayoutDescriptor layout_desc = {};
+  layout_desc.label                           = "Instance Transform Layout";
+  layout_desc.entryCount                      = 1;
+  layout_desc.entries                         = &layout_entry;
+  layout_ = getDevice().CreateBindGroupLayout(&layout_desc);
+
+  wgpu::BindGroupEntry group_entry = {};
+  group_entry.binding              = 0;
+  group_entry.buffer               = instance_buffer_;
+  group_entry.offset               = 0;
+  group_entry.size                 = instance_bytes;
+
+  wgpu::BindGroupDescriptor group_desc = {};
+  group_desc.label                     = "Instance Transform Bind Group";
+  group_desc.layout                    = layout_;
+  group_desc.entryCount                = 1;
+  group_desc.entries                   = &group_entry;
+  bind_group_ = getDevice().CreateBindGroup(&group_desc);
+
+  return {};
+}
+
+bool InstanceBatcher::usesIndirect() const
+{
+  return indirect_;
+}
+
+void InstanceBatcher::begin()
+{
+  instances_.clear();
+  transforms_.clear();
+  batches_.clear();
+  draws_.clear();
+  stats_ = {};
+}
+
+ustd::result InstanceBatcher::add(const RenderableMesh       &mesh,
+                                  const wgpu::RenderPipeline &pipeline,
+                                  const Transform            &transform)
+{
+  if (!mesh.isUploaded()) {
+    return ustd::unexpected("Cannot batch a mesh that is not uploaded");
+  }
+
+  if (instances_.size() >= config_.max_instances) {
+    return ustd::unexpected("Instance batcher is full");
+  }
+
+  instances_.push_back(
+      {&mesh, &pipeline, static_cast<uint32_t>(transforms_.size())});
+  transforms_.push_back(transform);
+  return {};
+}
+
+ustd::result InstanceBatcher::build()
+{
+  RNDR_TRACE_ZONE("InstanceBatcher::build");
+
+  batches_.clear();
+  draws_.clear();
+  stats_.instances = static_cast<uint32_t>(instances_.size());
+
+  if (instances_.empty()) {
+    return {};
+  }
+
+  /* pipeline first, so that batches also minimize pipeline switches */
+  std::sort(instances_.begin(), instances_.end(),
+            [](const Instance &a, const Instance &b) {
+              std::less<const void *> less;
+              return a.pipeline != b.pipeline ? less(a.pipeline, b.pipeline)
+                                              : less(a.mesh, b.mesh);
+            });
+
+  for (uint32_t i = 0; i < instances_.size(); ++i) {
+    const Instance &instance = instances_[i];
+    if (batches_.empty() || batches_.back().mesh != instance.mesh
+        || batches_.back().pipeline != instance.pipeline) {
+      batches_.push_back({instance.mesh, instance.pipeline, i, 0});
+    }
+    ++batches_.back().instance_count;
+  }
+
+  if (indirect_ && batches_.size() > config_.max_batches) {
+    batches_.clear();
+    return ustd::unexpected("Too many distinct instance batches");
+  }
+
+  auto transforms = uploads_.reserve(instance_buffer_, 0,
+                                     instances_.size() * sizeof(Transform));
+  if (!transforms) {
+    return ustd::unexpected(transforms.message());
+  }
+
+  std::byte *dst = (*transforms).data();
+  for (const Instance &instance : instances_) {
+    std::memcpy(dst, &transforms_[instance.transform], sizeof(Transform));
+    dst += sizeof(Transform);
+  }
+
+  /* meshes in the same block share binds, told apart by their offsets */
+  draws_.resize(batches_.size());
+  for (size_t i = 0; i < batches_.size(); ++i) {
+    BufferRange vertices = batches_[i].mesh->getVertexRange();
+    BufferRange indices  = batches_[i].mesh->getIndexRange();
+    BatchDraw  &cmd      = draws_[i];
+
+    cmd.index_buffer     = indices.buffer;
+    cmd.index_count      = batches_[i].mesh->getIndexCount();
+    cmd.first_index      = static_cast<uint32_t>(indices.offset / index_stride);
+    cmd.vertex_buffer    = vertices.buffer;
+
+    /* `baseVertex` can only express offsets that are whole vertices */
+    if (vertices.offset % vertex_stride == 0) {
+      cmd.vertex_offset = 0;
+      cmd.base_vertex   = static_cast<int32_t>(vertices.offset / vertex_stride);
+    }
+    else {
+      cmd.vertex_offset = vertices.offset;
+      cmd.base_vertex   = 0;
+    }
+
+    const BatchDraw *prev = i > 0 ? &draws_[i - 1] : nullptr;
+    cmd.rebind_vertices   = prev == nullptr
+                          || prev->vertex_buffer.Get() != cmd.vertex_buffer.Get()
+                          || prev->vertex_offset != cmd.vertex_offset
+                          || batches_[i - 1].pipeline != batches_[i].pipeline;
+    cmd.rebind_indices = prev == nullptr
+                         || prev->index_buffer.Get() != cmd.index_buffer.Get()
+                         || batches_[i - 1].pipeline != batches_[i].pipeline;
+
+    stats_.buffer_binds += cmd.rebind_vertices + cmd.rebind_indices;
+  }
+
+  if (indirect_) {
+    auto args = uploads_.reserve(indirect_buffer_, 0,
+                                 batches_.size() * indirect_stride);
+    if (!args) {
+      return ustd::unexpected(args.message());
+    }
+
+    std::byte *arg = (*args).data();
+    for (size_t i = 0; i < batches_.size(); ++i) {
+      const BatchDraw &cmd = draws_[i];
+      uint32_t         block[5]
+          = {cmd.index_count, batches_[i].instance_count, cmd.first_index,
+             static_cast<uint32_t>(cmd.base_vertex),
+             batches_[i].first_instance};
+      std::memcpy(arg, block, sizeof(block));
+      arg += indirect_stride;
+    }
+  }
+
+  stats_.batches = static_cast<uint32_t>(batches_.size());
+  return {};
+}
+
+const wgpu::BindGroupLayout &InstanceBatcher::getBindGroupLayout() const
+{
+  return layout_;
+}
+
+const wgpu::BindGroup &InstanceBatcher::getBindGroup() const
+{
+  return bind_group_;
+}
+
+const wgpu::Buffer &InstanceBatcher::getInstanceBuffer() const
+{
+  return instance_buffer_;
+}
+
+std::span<const InstanceBatcher::Batch> InstanceBatcher::getBatches() const
+{
+  return batches_;
+}
+
+const InstanceBatcher::Stats &InstanceBatcher::getStats() const
+{
+  return stats_;
+}
+
+} // namespace rndr
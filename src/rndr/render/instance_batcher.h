@@ -0,0 +1,171 @@
+/**
+ * @file instance_batcher.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_INSTANCE_BATCHER_H_
+#define RNDR_INSTANCE_BATCHER_H_
+
+#include "rndr/context.h"
+#include "rndr/math/matrix.h"
+#include "rndr/memory/upload_ring.h"
+#include "rndr/resources/renderable_mesh.h"
+#include "ustd/expected.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+/**
+ * @brief Collapses instances that share a mesh and pipeline into one instanced
+ * draw each.
+ *
+ * Transforms land contiguously per batch in a storage buffer that the vertex
+ * shader indexes with `@builtin(instance_index)`, bound through
+ * `getBindGroupLayout()` as `array<mat4x4f>`. Each transform is uploaded as
+ * laid out in `math::matrix<4, 4>`.
+ *
+ * With `wgpu::FeatureName::IndirectFirstInstance` the batches are issued as
+ * `DrawIndexedIndirect` calls whose arguments are uploaded alongside the
+ * transforms, so meshes sharing a suballocated block differ only in their
+ * arguments. Otherwise they fall back to direct `DrawIndexed` calls.
+ */
+class InstanceBatcher : public GlobalAccess {
+public:
+  using Transform = math::matrix<4, 4>;
+
+  /* bytes of one `DrawIndexedIndirect` argument block */
+  static constexpr uint64_t indirect_stride = 5 * sizeof(uint32_t);
+
+  struct Config {
+    uint32_t max_instances = 1 << 17;
+    uint32_t max_batches   = 1 << 12;
+  };
+
+  struct Stats {
+    uint32_t instances      = 0;
+    uint32_t batches        = 0;
+    /* vertex or index buffer binds `draw()` could not avoid */
+    uint32_t buffer_binds   = 0;
+  };
+
+  struct Batch {
+    const RenderableMesh       *mesh           = nullptr;
+    const wgpu::RenderPipeline *pipeline       = nullptr;
+    uint32_t                    first_instance = 0;
+    uint32_t                    instance_count = 0;
+  };
+
+  InstanceBatcher(Context &context, UploadRing &uploads);
+  InstanceBatcher(Context &context, UploadRing &uploads, Config config);
+
+  InstanceBatcher(const InstanceBatcher &)            = delete;
+  InstanceBatcher &operator=(const InstanceBatcher &) = delete;
+
+  InstanceBatcher(InstanceBatcher &&)                 = delete;
+  InstanceBatcher &operator=(InstanceBatcher &&)      = delete;
+
+  [[nodiscard]] ustd::result initialize();
+  bool                       usesIndirect() const;
+
+  /* forget the previous frame's instances */
+  void                       begin();
+
+  /* the mesh must be uploaded and, like the pipeline, outlive `draw()` */
+  [[nodiscard]] ustd::result add(const RenderableMesh       &mesh,
+                                 const wgpu::RenderPipeline &pipeline,
+                                 const Transform            &transform);
+
+  /**
+   * @brief Group the instances into batches and queue their transforms and
+   * draw arguments on the `UploadRing`, which must be submitted before the
+   * frame's draws.
+   */
+  [[nodiscard]] ustd::result build();
+
+  /* issue every batch, with the instance data bound at `group_index` */
+  template <typename Encoder>
+  void draw(const Encoder &encoder, uint32_t group_index) const
+  {
+    encoder.SetBindGroup(group_index, bind_group_);
+
+    const wgpu::RenderPipeline *pipeline = nullptr;
+    for (size_t i = 0; i < batches_.size(); ++i) {
+      const Batch     &batch = batches_[i];
+      const BatchDraw &cmd   = draws_[i];
+
+      if (batch.pipeline != pipeline) {
+        pipeline = batch.pipeline;
+        encoder.SetPipeline(*pipeline);
+      }
+      if (cmd.rebind_vertices) {
+        encoder.SetVertexBuffer(0, cmd.vertex_buffer, cmd.vertex_offset);
+      }
+      if (cmd.rebind_indices) {
+        encoder.SetIndexBuffer(cmd.index_buffer, RenderableMesh::index_format);
+      }
+
+      if (indirect_) {
+        encoder.DrawIndexedIndirect(indirect_buffer_, i * indirect_stride);
+      }
+      else {
+        encoder.DrawIndexed(cmd.index_count, batch.instance_count,
+                            cmd.first_index, cmd.base_vertex,
+                            batch.first_instance);
+      }
+    }
+  }
+
+  const wgpu::BindGroupLayout &getBindGroupLayout() const;
+  const wgpu::BindGroup       &getBindGroup() const;
+  const wgpu::Buffer          &getInstanceBuffer() const;
+  std::span<const Batch>       getBatches() const;
+  const Stats                 &getStats() const;
+
+private:
+  struct Instance {
+    const RenderableMesh       *mesh;
+    const wgpu::RenderPipeline *pipeline;
+    uint32_t                    transform;
+  };
+
+  struct BatchDraw {
+    wgpu::Buffer vertex_buffer   = {};
+    uint64_t     vertex_offset   = 0;
+    wgpu::Buffer index_buffer    = {};
+    uint32_t     index_count     = 0;
+    uint32_t     first_index     = 0;
+    int32_t      base_vertex     = 0;
+    bool         rebind_vertices = false;
+    bool         rebind_indices  = false;
+  };
+
+  UploadRing              &uploads_;
+  const Config             config_;
+  bool                     indirect_        = false;
+
+  TrackedBuffer            instance_buffer_ = {};
+  TrackedBuffer            indirect_buffer_ = {};
+  wgpu::BindGroupLayout    layout_          = {};
+  wgpu::BindGroup          bind_group_      = {};
+
+  std::vector<Instance>    instances_       = {};
+  std::vector<Transform>   transforms_      = {};
+  std::vector<Batch>       batches_         = {};
+  std::vector<BatchDraw>   draws_           = {};
+
+  Stats                    stats_           = {};
+};
+
+} // namespace rndr
+
+#endif
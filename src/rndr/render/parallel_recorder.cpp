@@ -0,0 +1,145 @@
+/**
+ * @file parallel_recorder.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "parallel_recorder.h"
+#include "rndr/profiling/trace.h"
+
+#include <algorithm>
+
+namespace rndr {
+
+ParallelRecorder::ParallelRecorder(Context &context, JobSystem &jobs)
+    : ParallelRecorder(context, jobs, Config{})
+{
+}
+
+ParallelRecorder::ParallelRecorder(Context   &context,
+                                   JobSystem &jobs,
+                                   Config     config)
+    : GlobalAccess(context), jobs_(jobs), config_(config)
+{
+  if (context.hasFeature(wgpu::FeatureName::ImplicitDeviceSynchronization)) {
+    thread_count_ = config_.thread_count != 0 ? config_.thread_count
+                                              : jobs_.getWorkerCount() + 1;
+  }
+}
+
+bool ParallelRecorder::isMultithreaded() const
+{
+  return thread_count_ > 1;
+}
+
+ustd::expected<std::vector<wgpu::RenderBundle>>
+ParallelRecorder::record(std::span<const DrawCall>  draws,
+                         const RenderTargetLayout &layout)
+{
+  RNDR_TRACE_ZONE("ParallelRecorder::record");
+
+  if (layout.color_formats.empty()
+      && layout.depth_stencil_format == wgpu::TextureFormat::Undefined) {
+    return ustd::unexpected("Render bundles need at least one attachment");
+  }
+
+  for (const DrawCall &draw : draws) {
+    if (draw.pipeline == nullptr) {
+      return ustd::unexpected("Cannot record a draw without a pipeline");
+    }
+  }
+
+  std::vector<wgpu::RenderBundle> bundles;
+  if (draws.empty()) {
+    return bundles;
+  }
+
+  wgpu::RenderBundleEncoderDescriptor bundle_desc = {};
+  bundle_desc.label                               = "Parallel Recorder Bundle";
+  bundle_desc.colorFormatCount   = layout.color_formats.size();
+  bundle_desc.colorFormats       = layout.color_formats.data();
+  bundle_desc.depthStencilFormat = layout.depth_stencil_format;
+  bundle_desc.sampleCount        = layout.sample_count;
+
+  size_t min_slice   = std::max<size_t>(1, config_.min_draws_per_bundle);
+  size_t slice_count = std::min<size_t>(
+      thread_count_, (draws.size() + min_slice - 1) / min_slice);
+  size_t slice_size = (draws.size() + slice_count - 1) / slice_count;
+  /* rounding the size up can leave the last slices empty, e.g. 5 draws over
+   * 4 slices of 2, so drop those */
+  slice_count       = (draws.size() + slice_size - 1) / slice_size;
+
+  bundles.resize(slice_count);
+
+  auto record_slices = [&](size_t first, size_t last) {
+    for (size_t slice = first; slice < last; ++slice) {
+      size_t begin   = slice * slice_size;
+      size_t count   = std::min(slice_size, draws.size() - begin);
+      bundles[slice] = recordSlice(draws.subspan(begin, count), bundle_desc);
+    }
+  };
+
+  if (slice_count > 1) {
+    jobs_.parallelFor(0, slice_count, 1, record_slices);
+  }
+  else {
+    record_slices(0, 1);
+  }
+
+  stats_.bundles_recorded += slice_count;
+  stats_.draws_recorded += draws.size();
+  stats_.threads_used = static_cast<uint32_t>(slice_count);
+
+  return bundles;
+}
+
+void ParallelRecorder::execute(const wgpu::RenderPassEncoder        &pass,
+                               std::span<const wgpu::RenderBundle> bundles) const
+{
+  if (!bundles.empty()) {
+    pass.ExecuteBundles(bundles.size(), bundles.data());
+  }
+}
+
+void ParallelRecorder::submit(const wgpu::RenderPassDescriptor    &pass_desc,
+                              std::span<const wgpu::RenderBundle> bundles)
+{
+  RNDR_TRACE_ZONE("ParallelRecorder::submit");
+
+  wgpu::CommandEncoderDescriptor encoder_desc = {};
+  encoder_desc.label           = "Parallel Recorder Command Encoder";
+  wgpu::CommandEncoder encoder = getDevice().CreateCommandEncoder(&encoder_desc);
+
+  wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&pass_desc);
+  execute(pass, bundles);
+  pass.End();
+
+  wgpu::CommandBuffer command_buffer = encoder.Finish();
+  getContext().getQueue().Submit(1, &command_buffer);
+}
+
+const ParallelRecorder::Stats &ParallelRecorder::getStats() const
+{
+  return stats_;
+}
+
+wgpu::RenderBundle
+ParallelRecorder::recordSlice(std::span<const DrawCall>                 draws,
+                              const wgpu::RenderBundleEncoderDescriptor &desc)
+{
+  RNDR_TRACE_ZONE("ParallelRecorder::recordSlice");
+
+  wgpu::RenderBundleEncoder encoder = getDevice().CreateRenderBundleEncoder(&desc);
+  StateTracker              state;
+  for (const DrawCall &draw : draws) {
+    state.encode(encoder, draw);
+  }
+  return encoder.Finish();
+}
+
+} // namespace rndr
@@ -0,0 +1,99 @@
+/**
+ * @file parallel_recorder.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_PARALLEL_RECORDER_H_
+#define RNDR_PARALLEL_RECORDER_H_
+
+#include "rndr/context.h"
+#include "rndr/jobs/job_system.h"
+#include "rndr/render/draw_call.h"
+#include "ustd/expected.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+/* attachment formats a render bundle must be compatible with */
+struct RenderTargetLayout {
+  std::vector<wgpu::TextureFormat> color_formats = {};
+  wgpu::TextureFormat depth_stencil_format       = wgpu::TextureFormat::Undefined;
+  uint32_t            sample_count               = 1;
+};
+
+/**
+ * @brief Records a draw list into render bundles from several threads at once,
+ * to be replayed on the main thread with `ExecuteBundles`.
+ *
+ * The list is cut into one contiguous slice per thread, so bundles replay the
+ * draws in their original order. Slices are recorded as `JobSystem` jobs, with
+ * the calling thread helping out. Recording from more than one thread needs
+ * `wgpu::FeatureName::ImplicitDeviceSynchronization`; without it every slice
+ * is recorded on the calling thread.
+ */
+class ParallelRecorder : public GlobalAccess {
+public:
+  struct Config {
+    /* 0 uses every worker of the job system plus the calling thread */
+    uint32_t thread_count         = 0;
+    /* slices smaller than this are not worth another thread */
+    size_t   min_draws_per_bundle = 512;
+  };
+
+  struct Stats {
+    size_t   bundles_recorded = 0;
+    size_t   draws_recorded   = 0;
+    uint32_t threads_used     = 0;
+  };
+
+  ParallelRecorder(Context &context, JobSystem &jobs);
+  ParallelRecorder(Context &context, JobSystem &jobs, Config config);
+
+  ParallelRecorder(const ParallelRecorder &)            = delete;
+  ParallelRecorder &operator=(const ParallelRecorder &) = delete;
+
+  ParallelRecorder(ParallelRecorder &&)                 = delete;
+  ParallelRecorder &operator=(ParallelRecorder &&)      = delete;
+
+  bool              isMultithreaded() const;
+
+  /**
+   * @brief Record `draws` into bundles compatible with `layout`. Blocks until
+   * every slice is recorded.
+   */
+  [[nodiscard]] ustd::expected<std::vector<wgpu::RenderBundle>>
+       record(std::span<const DrawCall> draws, const RenderTargetLayout &layout);
+
+  void execute(const wgpu::RenderPassEncoder        &pass,
+               std::span<const wgpu::RenderBundle> bundles) const;
+
+  /* encode one pass replaying `bundles` and submit it */
+  void submit(const wgpu::RenderPassDescriptor    &pass_desc,
+              std::span<const wgpu::RenderBundle> bundles);
+
+  const Stats &getStats() const;
+
+private:
+  wgpu::RenderBundle
+                 recordSlice(std::span<const DrawCall>                 draws,
+                             const wgpu::RenderBundleEncoderDescriptor &desc);
+
+  JobSystem     &jobs_;
+  const Config   config_;
+  uint32_t       thread_count_ = 1;
+  Stats          stats_        = {};
+};
+
+} // namespace rndr
+
+#endif
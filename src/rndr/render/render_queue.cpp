@@ -0,0 +1,181 @@
+/**
+ * @file render_queue.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "render_queue.h"
+#include "rndr/profiling/trace.h"
+
+#include <cassert>
+#include <functional>
+
+namespace rndr {
+
+void radix_sort(std::span<SortEntry> entries, std::span<SortEntry> scratch)
+{
+  assert(scratch.size() >= entries.size());
+
+  constexpr size_t digits = sizeof(uint64_t);
+  const size_t     count  = entries.size();
+  if (count < 2) {
+    return;
+  }
+
+  /* one sweep builds the histograms of every digit */
+  std::array<std::array<uint32_t, 256>, digits> histograms = {};
+  for (const SortEntry &entry : entries) {
+    for (size_t digit = 0; digit < digits; ++digit) {
+      ++histograms[digit][(entry.key >> (digit * 8)) & 0xff];
+    }
+  }
+
+  SortEntry *src = entries.data();
+  SortEntry *dst = scratch.data();
+  for (size_t digit = 0; digit < digits; ++digit) {
+    const size_t shift     = digit * 8;
+    auto        &histogram = histograms[digit];
+
+    /* every key shares this digit, so the pass would not move anything */
+    if (histogram[(src[0].key >> shift) & 0xff] == count) {
+      continue;
+    }
+
+    uint32_t offset = 0;
+    for (uint32_t &bucket : histogram) {
+      uint32_t size = bucket;
+      bucket        = offset;
+      offset       += size;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+      dst[histogram[(src[i].key >> shift) & 0xff]++] = src[i];
+    }
+    std::swap(src, dst);
+  }
+
+  if (src != entries.data()) {
+    std::copy(src, src + count, entries.data());
+  }
+}
+
+size_t RenderQueue::StateKeyHash::operator()(const StateKey &key) const
+{
+  size_t hash = std::hash<uint64_t>{}(key.offset);
+  for (const void *handle : key.handles) {
+    hash ^= std::hash<const void *>{}(handle) + 0x9e3779b97f4a7c15ull
+            + (hash << 6) + (hash >> 2);
+  }
+  return hash;
+}
+
+RenderQueue::RenderQueue()
+{
+}
+
+void RenderQueue::begin()
+{
+  draws_.clear();
+  entries_.clear();
+  sorted_ = true;
+  stats_  = {};
+
+  /* objects come and go, so forget ids once a field has wrapped around */
+  if (pipeline_ids_.size() > (size_t{1} << pipeline_bits)) {
+    pipeline_ids_.clear();
+  }
+  if (material_ids_.size() > (size_t{1} << material_bits)) {
+    material_ids_.clear();
+  }
+  if (mesh_ids_.size() > (size_t{1} << mesh_bits)) {
+    mesh_ids_.clear();
+  }
+}
+
+uint32_t RenderQueue::intern(IdMap &ids, const StateKey &key, uint32_t bits)
+{
+  auto [it, inserted] = ids.try_emplace(key, static_cast<uint32_t>(ids.size()));
+  return it->second & ((1u << bits) - 1);
+}
+
+uint64_t RenderQueue::makeKey(uint32_t pass, const DrawCall &draw, float depth)
+{
+  assert(pass < max_passes && "Render queue pass out of range");
+  assert(draw.pipeline != nullptr);
+
+  StateKey pipeline   = {};
+  pipeline.handles[0] = draw.pipeline->Get();
+
+  /* dynamic offsets vary per object, so they are not part of the material */
+  StateKey material   = {};
+  for (uint32_t group = 0; group < DrawCall::max_bind_groups; ++group) {
+    if (draw.bind_groups[group] != nullptr) {
+      material.handles[group] = draw.bind_groups[group]->Get();
+    }
+  }
+
+  StateKey mesh = {};
+  if (draw.vertex_buffer != nullptr) {
+    mesh.handles[0] = draw.vertex_buffer->Get();
+    mesh.offset     = draw.vertex_offset;
+  }
+  if (draw.index_buffer != nullptr) {
+    mesh.handles[1] = draw.index_buffer->Get();
+  }
+
+  constexpr uint32_t depth_max = (1u << depth_bits) - 1;
+  float              clamped   = std::clamp(depth, 0.f, 1.f);
+  uint64_t           bucket    = static_cast<uint64_t>(clamped * depth_max);
+
+  uint64_t           key       = pass;
+  key = (key << pipeline_bits) | intern(pipeline_ids_, pipeline, pipeline_bits);
+  key = (key << material_bits) | intern(material_ids_, material, material_bits);
+  key = (key << mesh_bits) | intern(mesh_ids_, mesh, mesh_bits);
+  key = (key << depth_bits) | bucket;
+  return key;
+}
+
+void RenderQueue::push(uint32_t pass, const DrawCall &draw, float depth)
+{
+  entries_.push_back(
+      {makeKey(pass, draw, depth), static_cast<uint32_t>(draws_.size())});
+  draws_.push_back(draw);
+  sorted_ = false;
+  ++stats_.queued;
+}
+
+void RenderQueue::sort()
+{
+  RNDR_TRACE_ZONE("RenderQueue::sort");
+
+  scratch_.resize(entries_.size());
+  radix_sort(entries_, scratch_);
+  sorted_ = true;
+}
+
+std::vector<DrawCall> RenderQueue::getSortedDraws(uint32_t pass)
+{
+  if (!sorted_) {
+    sort();
+  }
+
+  std::vector<DrawCall> draws;
+  for (const SortEntry &entry : entries_) {
+    if (passOf(entry.key) == pass) {
+      draws.push_back(draws_[entry.index]);
+    }
+  }
+  return draws;
+}
+
+const RenderQueue::Stats &RenderQueue::getStats() const
+{
+  return stats_;
+}
+
+} // namespace rndr
@@ -0,0 +1,167 @@
+/**
+ * @file render_queue.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_RENDER_QUEUE_H_
+#define RNDR_RENDER_QUEUE_H_
+
+#include "rndr/render/draw_call.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace rndr {
+
+struct SortEntry {
+  uint64_t key   = 0;
+  uint32_t index = 0;
+};
+
+/**
+ * @brief Stable LSD radix sort of `entries` by key, a byte per pass. Passes
+ * where every key shares the byte are skipped. `scratch` must be as large as
+ * `entries`.
+ */
+void radix_sort(std::span<SortEntry> entries, std::span<SortEntry> scratch);
+
+/**
+ * @brief Orders a frame's draws to minimize state changes.
+ *
+ * Each pushed draw gets a 64-bit key which, from the most significant bits
+ * down, holds its pass, pipeline, bind groups ("material"), vertex and index
+ * buffers ("mesh") and a quantized depth. Sorting by the key groups draws
+ * sharing state, and `encode()` then skips every bind that would not change
+ * the encoder's state.
+ *
+ * Pipelines, materials and meshes get small ids the first time they are seen.
+ * When more distinct objects are seen than a field can hold ids are shared,
+ * which only weakens the grouping.
+ */
+class RenderQueue {
+public:
+  static constexpr uint32_t pass_bits     = 4;
+  static constexpr uint32_t pipeline_bits = 12;
+  static constexpr uint32_t material_bits = 14;
+  static constexpr uint32_t mesh_bits     = 14;
+  static constexpr uint32_t depth_bits    = 20;
+  static_assert(pass_bits + pipeline_bits + material_bits + mesh_bits
+                    + depth_bits
+                == 64);
+
+  static constexpr uint32_t max_passes = 1 << pass_bits;
+
+  struct Stats {
+    uint32_t              queued = 0;
+    /* binds issued and skipped by `encode()` this frame */
+    StateTracker::Counts  state  = {};
+  };
+
+  RenderQueue();
+
+  RenderQueue(const RenderQueue &)            = delete;
+  RenderQueue &operator=(const RenderQueue &) = delete;
+
+  RenderQueue(RenderQueue &&)                 = delete;
+  RenderQueue &operator=(RenderQueue &&)      = delete;
+
+  /* forget the previous frame's draws and state-change counts */
+  void         begin();
+
+  /**
+   * @brief Queue `draw` for `pass`, whose objects must outlive `encode()`.
+   *
+   * @param depth view depth normalized to [0, 1], nearest first. Pass
+   * `1 - depth` for back-to-front ordering of transparent draws.
+   */
+  void         push(uint32_t pass, const DrawCall &draw, float depth = 0.f);
+
+  void         sort();
+
+  /* record the sorted draws of `pass`, sorting first if needed */
+  template <typename Encoder>
+  void encode(const Encoder &encoder, uint32_t pass)
+  {
+    if (!sorted_) {
+      sort();
+    }
+
+    auto first = std::lower_bound(
+        entries_.begin(), entries_.end(), passKey(pass),
+        [](const SortEntry &entry, uint64_t key) { return entry.key < key; });
+
+    StateTracker state;
+    for (auto it = first; it != entries_.end() && passOf(it->key) == pass;
+         ++it) {
+      state.encode(encoder, draws_[it->index]);
+    }
+
+    const StateTracker::Counts &counts = state.getCounts();
+    stats_.state.draws                 += counts.draws;
+    stats_.state.pipelines             += counts.pipelines;
+    stats_.state.bind_groups           += counts.bind_groups;
+    stats_.state.vertex_buffers        += counts.vertex_buffers;
+    stats_.state.index_buffers         += counts.index_buffers;
+    stats_.state.skipped               += counts.skipped;
+  }
+
+  /* the key `push()` computes for a draw */
+  uint64_t     makeKey(uint32_t pass, const DrawCall &draw, float depth);
+
+  /* the queued draws of `pass` in sorted order, for other recorders */
+  std::vector<DrawCall> getSortedDraws(uint32_t pass);
+
+  const Stats &getStats() const;
+
+private:
+  /* up to four GPU handles and an offset naming one piece of state */
+  struct StateKey {
+    std::array<const void *, DrawCall::max_bind_groups> handles = {};
+    uint64_t                                            offset  = 0;
+
+    bool operator==(const StateKey &) const = default;
+  };
+
+  struct StateKeyHash {
+    size_t operator()(const StateKey &key) const;
+  };
+
+  using IdMap = std::unordered_map<StateKey, uint32_t, StateKeyHash>;
+
+  static uint64_t passKey(uint32_t pass)
+  {
+    return uint64_t{pass} << (64 - pass_bits);
+  }
+
+  static uint32_t passOf(uint64_t key)
+  {
+    return static_cast<uint32_t>(key >> (64 - pass_bits));
+  }
+
+  static uint32_t intern(IdMap &ids, const StateKey &key, uint32_t bits);
+
+  std::vector<DrawCall>  draws_        = {};
+  std::vector<SortEntry> entries_      = {};
+  std::vector<SortEntry> scratch_      = {};
+  bool                   sorted_       = true;
+
+  IdMap                  pipeline_ids_ = {};
+  IdMap                  material_ids_ = {};
+  IdMap                  mesh_ids_     = {};
+
+  Stats                  stats_        = {};
+};
+
+} // namespace rndr
+
+#endif
@@ -0,0 +1,208 @@
+/**
+ * @file render_thread.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_RENDER_THREAD_H_
+#define RNDR_RENDER_THREAD_H_
+
+#include "rndr/jobs/triple_buffer.h"
+#include "rndr/profiling/trace.h"
+#include "ustd/expected.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+namespace rndr {
+
+/**
+ * @brief A thread that owns encoding, submission and presentation, fed one
+ * `Frame` description at a time by the application thread.
+ *
+ * The application fills `beginFrame()` and `submit()`s it without ever
+ * waiting, while the render thread draws the frame before it, so simulation
+ * and rendering overlap at the cost of one frame of latency. Frames are
+ * handed over through a `TripleBuffer`: when the render thread falls behind,
+ * it skips straight to the newest frame rather than stalling the application.
+ * Neither side takes a lock: the idle render thread sleeps in an atomic wait
+ * that `submit()` wakes.
+ *
+ * Once started, only the render thread may use the `Context` and everything
+ * created from it, `processEvents()` and `acquireFrame()` included. GLFW must
+ * still be polled on the main thread, whose resize callbacks the `Context`
+ * picks up safely.
+ */
+template <typename Frame> class RenderThread {
+public:
+  /* draws one frame, an error stops the render thread */
+  using RenderFunction = std::function<ustd::result(const Frame &)>;
+
+  struct Stats {
+    uint64_t submitted = 0;
+    uint64_t rendered  = 0;
+    /* frames replaced by a newer one before the render thread got to them */
+    uint64_t dropped   = 0;
+    /* time spent in the render function */
+    double   last_ms   = 0.0;
+    double   avg_ms    = 0.0;
+  };
+
+  explicit RenderThread(RenderFunction render) : render_(std::move(render))
+  {
+  }
+
+  ~RenderThread()
+  {
+    stop();
+  }
+
+  RenderThread(const RenderThread &)            = delete;
+  RenderThread &operator=(const RenderThread &) = delete;
+
+  RenderThread(RenderThread &&)                 = delete;
+  RenderThread &operator=(RenderThread &&)      = delete;
+
+  void start()
+  {
+    if (thread_.joinable()) {
+      return;
+    }
+
+    stop_.store(false);
+    running_.store(true);
+    result_ = {};
+    thread_ = std::thread(&RenderThread::loop, this);
+  }
+
+  /* finish the frame being drawn, if any, and join the render thread */
+  void stop()
+  {
+    stop_.store(true, std::memory_order_release);
+    pending_.store(true, std::memory_order_release);
+    pending_.notify_one();
+
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+  /* false once stopped, or once a frame failed, see `getResult()` */
+  bool isRunning() const
+  {
+    return running_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Application thread only, the frame to describe next. It holds
+   * whatever was written to it three frames ago, so containers in it can be
+   * cleared and refilled without allocating.
+   */
+  Frame &beginFrame()
+  {
+    return frames_.write();
+  }
+
+  /* application thread only, hand the frame to the render thread */
+  void submit()
+  {
+    ++submitted_;
+    if (frames_.publish()) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    pending_.store(true, std::memory_order_release);
+    pending_.notify_one();
+  }
+
+  /* application thread only */
+  Stats getStats() const
+  {
+    Stats stats     = {};
+    stats.submitted = submitted_;
+    stats.rendered  = rendered_.load(std::memory_order_acquire);
+    stats.dropped   = dropped_.load(std::memory_order_relaxed);
+    stats.last_ms   = last_ms_.load(std::memory_order_relaxed);
+    stats.avg_ms    = avg_ms_.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+  /* the error that stopped the render thread, once `isRunning()` is false */
+  ustd::result getResult() const
+  {
+    /* only written before the render thread clears `running_` */
+    if (isRunning()) {
+      return {};
+    }
+    return result_;
+  }
+
+private:
+  void loop()
+  {
+    while (true) {
+      pending_.wait(false, std::memory_order_acquire);
+      if (stop_.load(std::memory_order_acquire)) {
+        break;
+      }
+
+      /* a frame submitted from here on sets it again, and is not missed */
+      pending_.exchange(false, std::memory_order_acq_rel);
+
+      if (!frames_.acquire()) {
+        continue;
+      }
+
+      RNDR_TRACE_ZONE("RenderThread::render");
+
+      auto         start  = std::chrono::steady_clock::now();
+      ustd::result result = render_(frames_.read());
+      double       ms     = std::chrono::duration<double, std::milli>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+
+      uint64_t rendered = rendered_.load(std::memory_order_relaxed) + 1;
+      double   avg_ms   = avg_ms_.load(std::memory_order_relaxed);
+      last_ms_.store(ms, std::memory_order_relaxed);
+      avg_ms_.store(avg_ms + (ms - avg_ms) / static_cast<double>(rendered),
+                    std::memory_order_relaxed);
+      rendered_.store(rendered, std::memory_order_release);
+
+      if (!result) {
+        result_ = result;
+        break;
+      }
+    }
+
+    running_.store(false, std::memory_order_release);
+  }
+
+  const RenderFunction    render_;
+  TripleBuffer<Frame>     frames_    = {};
+  std::thread             thread_    = {};
+
+  uint64_t                submitted_ = 0;
+  std::atomic<uint64_t>   dropped_   = 0;
+  std::atomic<uint64_t>   rendered_  = 0;
+  std::atomic<bool>       running_   = false;
+  std::atomic<bool>       stop_      = false;
+  /* set by `submit()`, the idle render thread waits on it */
+  std::atomic<bool>       pending_   = false;
+
+  std::atomic<double>     last_ms_   = 0.0;
+  std::atomic<double>     avg_ms_    = 0.0;
+  /* read once `running_` is cleared, which publishes it */
+  ustd::result            result_    = {};
+};
+
+} // namespace rndr
+
+#endif
@@ -0,0 +1,118 @@
+/**
+ * @file resolution_controller.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "resolution_controller.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rndr {
+
+ResolutionController::ResolutionController()
+    : ResolutionController(Config{})
+{
+}
+
+ResolutionController::ResolutionController(Config config)
+    : config_(config), scale_(config.max_scale)
+{
+  history_.reserve(config_.history);
+}
+
+bool ResolutionController::addFrame(double gpu_ms, double cpu_ms)
+{
+  if (config_.history > 0) {
+    Frame frame = {gpu_ms, cpu_ms, scale_};
+    if (history_.size() < config_.history) {
+      history_.push_back(frame);
+    }
+    else {
+      history_[next_] = frame;
+    }
+    next_ = (next_ + 1) % config_.history;
+  }
+
+  elapsed_ms_ += gpu_ms > 0.0 ? gpu_ms : cpu_ms;
+  if (++frames_ < std::max(config_.interval, 1u)) {
+    return false;
+  }
+
+  double average = elapsed_ms_ / frames_;
+  elapsed_ms_    = 0.0;
+  frames_        = 0;
+
+  double low     = config_.target_ms * (1.0 - config_.headroom);
+  if (average <= 0.0 || (average <= config_.target_ms && average >= low)) {
+    return false;
+  }
+
+  /* pixels scale with its square, so aim for the middle of the band */
+  double goal  = 0.5 * (config_.target_ms + low);
+  float  ideal = scale_ * static_cast<float>(std::sqrt(goal / average));
+  float  scale = std::clamp(ideal, scale_ - config_.max_step,
+                            scale_ + config_.max_step);
+  scale        = std::clamp(scale, config_.min_scale, config_.max_scale);
+
+  if (scale == scale_) {
+    return false;
+  }
+
+  scale_ = scale;
+  ++adjustments_;
+  return true;
+}
+
+void ResolutionController::reset(float scale)
+{
+  scale_      = std::clamp(scale, config_.min_scale, config_.max_scale);
+  elapsed_ms_ = 0.0;
+  frames_     = 0;
+}
+
+float ResolutionController::getScale() const
+{
+  return scale_;
+}
+
+std::pair<uint32_t, uint32_t> ResolutionController::scaled(uint32_t width,
+                                                           uint32_t height) const
+{
+  auto scale = [this](uint32_t size) {
+    return std::max(static_cast<uint32_t>(std::lround(size * scale_)), 1u);
+  };
+  return {scale(width), scale(height)};
+}
+
+std::vector<ResolutionController::Frame>
+ResolutionController::getHistory() const
+{
+  if (history_.size() < config_.history) {
+    return history_;
+  }
+
+  std::vector<Frame> frames;
+  frames.reserve(history_.size());
+  frames.insert(frames.end(), history_.begin() + next_, history_.end());
+  frames.insert(frames.end(), history_.begin(), history_.begin() + next_);
+  return frames;
+}
+
+uint32_t ResolutionController::getAdjustments() const
+{
+  return adjustments_;
+}
+
+const ResolutionController::Config &ResolutionController::getConfig() const
+{
+  return config_;
+}
+
+} // namespace rndr
@@ -0,0 +1,99 @@
+/**
+ * @file resolution_controller.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_RESOLUTION_CONTROLLER_H_
+#define RNDR_RESOLUTION_CONTROLLER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace rndr {
+
+/**
+ * @brief Picks the render scale, the fraction of the output width and height
+ * the scene is rendered at, from the measured frame times.
+ *
+ * Frame times are averaged over `Config::interval` frames. Above
+ * `Config::target_ms` the scale drops, below `target_ms * (1 - headroom)` it
+ * rises, and in between it holds, so that it does not oscillate around the
+ * target. Assuming the cost of a frame grows with its pixel count, each
+ * adjustment aims for the middle of that band, by at most `Config::max_step`.
+ *
+ * GPU time is used when it is measured, since only that scales with the
+ * resolution; the CPU time stands in for it otherwise, e.g. the time to the
+ * queue reporting the frame done. Either may lag the frame it belongs to by a
+ * few frames, see `GpuProfiler`, which `interval` should comfortably exceed.
+ */
+class ResolutionController {
+public:
+  struct Config {
+    /* frame time to stay under, e.g. one refresh at 60 Hz */
+    double   target_ms = 1000.0 / 60.0;
+    float    min_scale = 0.5f;
+    float    max_scale = 1.f;
+    /* frames averaged before each adjustment */
+    uint32_t interval  = 8;
+    /* fraction of the target kept free before the scale rises again */
+    double   headroom  = 0.15;
+    /* largest change of the scale per adjustment */
+    float    max_step  = 0.1f;
+    /* frames kept for `getHistory()` */
+    size_t   history   = 256;
+  };
+
+  struct Frame {
+    double gpu_ms = 0.0;
+    double cpu_ms = 0.0;
+    /* scale the frame was rendered at */
+    float  scale  = 1.f;
+  };
+
+  ResolutionController();
+  ResolutionController(Config config);
+
+  /**
+   * @brief Record the timings of a frame rendered at the current scale, where
+   * 0 means not measured.
+   *
+   * @return true if the scale changed
+   */
+  bool               addFrame(double gpu_ms, double cpu_ms);
+
+  /* start over at `scale`, clamped, forgetting the frames since an adjustment */
+  void               reset(float scale);
+
+  float              getScale() const;
+  /* `width` x `height` at the current scale, at least 1 x 1 */
+  std::pair<uint32_t, uint32_t> scaled(uint32_t width, uint32_t height) const;
+
+  /* the recorded frames, oldest first */
+  std::vector<Frame> getHistory() const;
+  /* adjustments that changed the scale so far */
+  uint32_t           getAdjustments() const;
+  const Config      &getConfig() const;
+
+private:
+  const Config       config_;
+  float              scale_       = 1.f;
+
+  double             elapsed_ms_  = 0.0;
+  uint32_t           frames_      = 0;
+  uint32_t           adjustments_ = 0;
+
+  std::vector<Frame> history_     = {};
+  size_t             next_        = 0;
+};
+
+} // namespace rndr
+
+#endif
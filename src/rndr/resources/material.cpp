@@ -10,97 +10,286 @@
  */
 
 #include "material.h"
+#include "rndr/render/depth_target.h"
+#include "rndr/utils/helpers.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
 
 namespace rndr {
 
-Material::Material(Context &context) : GlobalAccess(context)
+static std::atomic<uint32_t> next_material_id = 0;
+
+Material::Material(Context &context, ResourceCache &cache, Config config)
+    : GlobalAccess(context), cache_(cache), config_(std::move(config)),
+      id_(next_material_id++)
 {
-  const char *shaderSource = R"(
-@vertex
-fn vs_main(@builtin(vertex_index) in_vertex_index: u32) -> @builtin(position) vec4<f32> 
-{ 	
-  var p = vec2<f32>(0.0, 0.0); 	
-  if (in_vertex_index == 0u) {
-    p = vec2<f32>(-0.5, -0.8); 	
-  } else if (in_vertex_index == 1u) { 
-    p = vec2<f32>(0.5, -0.5); 	
-  } else { 		
-    p = vec2<f32>(0.0, 0.5);
-  }
-	return vec4<f32>(p, 0.0, 1.0);
 }
 
-@fragment
-fn fs_main() -> @location(0) vec4<f32> {
-    return vec4<f32>(0.0, 0.4, 1.0, 1.0);
-}
+ustd::result Material::initialize()
+{
+  if (config_.shader_source.empty()) {
+    return ustd::unexpected("Material has no shader source");
+  }
 
-)";
+  if (config_.features.size() > 32) {
+    return ustd::unexpected("Materials support at most 32 shader features");
+  }
+
+  if (config_.depth_prepass
+      && config_.depth_format == wgpu::TextureFormat::Undefined) {
+    return ustd::unexpected("A depth prepass needs a depth format");
+  }
+
+  for (const std::string &feature : config_.features) {
+    if (!helpers::declares_override(config_.shader_source, feature)) {
+      return ustd::unexpected("Shader feature " + feature
+                              + " is not an override constant of the shader");
+    }
+  }
+
+  /* groups without entries still need a layout to keep the slots in place */
+  layouts_[frame_group]    = cache_.getBindGroupLayout(config_.frame_entries);
+  layouts_[material_group] = cache_.getBindGroupLayout(config_.material_entries);
+  layouts_[object_group]   = cache_.getBindGroupLayout(config_.object_entries);
+
+  size_t group_count       = 0;
+  if (!config_.object_entries.empty()) {
+    group_count = 3;
+  }
+  else if (!config_.material_entries.empty()) {
+    group_count = 2;
+  }
+  else if (!config_.frame_entries.empty()) {
+    group_count = 1;
+  }
+
+  /* data layout, shared with every material declaring the same groups */
+  pipeline_layout_ = cache_.getPipelineLayout(
+      std::span<const wgpu::BindGroupLayout>(layouts_.data(), group_count));
 
   /* create shader module */
   wgpu::ShaderModuleWGSLDescriptor shader_code_desc = {};
-  // Set the chained struct's header
-  shader_code_desc.code                           = shaderSource;
+  shader_code_desc.code = config_.shader_source.c_str();
 
   wgpu::ShaderModuleDescriptor shader_module_desc = {};
-  shader_module_desc.label                        = "Default Shader Module";
+  shader_module_desc.label                        = "Material Shader Module";
   shader_module_desc.nextInChain                  = &shader_code_desc;
-  wgpu::ShaderModule shader_module
-      = getDevice().CreateShaderModule(&shader_module_desc);
+  shader_module_ = getDevice().CreateShaderModule(&shader_module_desc);
+
+  if (!getPipeline(0) || (config_.depth_prepass && !getDepthPipeline(0))) {
+    return ustd::unexpected("Failed to create material pipeline");
+  }
+
+  return {};
+}
 
-  wgpu::RenderPipelineDescriptor pipeline_desc = {};
-  pipeline_desc.nextInChain                    = nullptr;
+/* the test that passes for the very depth a prepass wrote */
+static wgpu::CompareFunction inclusive(wgpu::CompareFunction compare)
+{
+  switch (compare) {
+  case wgpu::CompareFunction::Less:
+    return wgpu::CompareFunction::LessEqual;
+  case wgpu::CompareFunction::Greater:
+    return wgpu::CompareFunction::GreaterEqual;
+  default:
+    return compare;
+  }
+}
+
+void Material::describe(uint32_t      variant,
+                        bool          depth_only,
+                        PipelineDesc &out) const
+{
+  /* shifting a 32-bit variant by 32 is undefined, every bit is a feature */
+  assert((config_.features.size() == 32
+          || variant >> config_.features.size() == 0)
+         && "Unknown shader feature");
+
+  /* each feature is set either way, so the shader's defaults never apply */
+  out.constants.resize(config_.features.size());
+  for (size_t i = 0; i < config_.features.size(); ++i) {
+    out.constants[i].key   = config_.features[i].c_str();
+    out.constants[i].value = (variant >> i) & 1;
+  }
+
+  wgpu::RenderPipelineDescriptor &desc = out.desc;
 
   /* pipeline describe vertex stage */
-  wgpu::VertexState vertex_state = {};
-  vertex_state.module            = shader_module;
-  vertex_state.entryPoint        = "vs_main";
-  vertex_state.bufferCount       = 0;
-  vertex_state.buffers           = nullptr;
-  vertex_state.constantCount     = 0;
-  vertex_state.constants         = nullptr;
-  pipeline_desc.vertex           = std::move(vertex_state);
+  out.position_attribute.format         = wgpu::VertexFormat::Float32x3;
+  out.position_attribute.offset         = 0;
+  out.position_attribute.shaderLocation = 0;
+
+  out.vertex_layout.arrayStride         = sizeof(math::vec3);
+  out.vertex_layout.attributeCount      = 1;
+  out.vertex_layout.attributes          = &out.position_attribute;
+
+  desc.vertex.module                    = shader_module_;
+  desc.vertex.entryPoint                = config_.vertex_entry.c_str();
+  desc.vertex.bufferCount               = config_.uses_mesh ? 1 : 0;
+  desc.vertex.buffers = config_.uses_mesh ? &out.vertex_layout : nullptr;
+  desc.vertex.constantCount             = out.constants.size();
+  desc.vertex.constants                 = out.constants.data();
 
   /* pipeline describe primitive stage */
-  pipeline_desc.primitive.topology = wgpu::PrimitiveTopology::TriangleList;
-  pipeline_desc.primitive.stripIndexFormat = wgpu::IndexFormat::Undefined;
-  pipeline_desc.primitive.frontFace        = wgpu::FrontFace::CCW;
-  pipeline_desc.primitive.cullMode         = wgpu::CullMode::None;
+  desc.primitive.topology               = wgpu::PrimitiveTopology::TriangleList;
+  desc.primitive.frontFace              = wgpu::FrontFace::CCW;
+  desc.primitive.cullMode               = wgpu::CullMode::None;
 
   /* pipeline describe fragment stage */
-  wgpu::BlendState blend_state = {};
-  blend_state.color.srcFactor  = wgpu::BlendFactor::SrcAlpha;
-  blend_state.color.dstFactor  = wgpu::BlendFactor::OneMinusSrcAlpha;
-  blend_state.color.operation  = wgpu::BlendOperation::Add;
-  blend_state.alpha.srcFactor  = wgpu::BlendFactor::One;
-  blend_state.alpha.dstFactor  = wgpu::BlendFactor::Zero;
-  blend_state.alpha.operation  = wgpu::BlendOperation::Add;
-
-  wgpu::ColorTargetState color_target_state = {};
-  color_target_state.blend                  = &blend_state;
-  color_target_state.format                 = wgpu::TextureFormat::BGRA8Unorm;
-  color_target_state.writeMask              = wgpu::ColorWriteMask::All;
-
-  wgpu::FragmentState fragment_state        = {};
-  fragment_state.module                     = shader_module;
-  fragment_state.entryPoint                 = "fs_main";
-  fragment_state.targetCount                = 1;
-  fragment_state.targets                    = &color_target_state;
-
-  pipeline_desc.fragment                    = &fragment_state;
-
-  /* pipeline depth/stencil settings */
-  pipeline_desc.depthStencil = nullptr;
+  out.blend_state.color.srcFactor       = wgpu::BlendFactor::SrcAlpha;
+  out.blend_state.color.dstFactor       = wgpu::BlendFactor::OneMinusSrcAlpha;
+  out.blend_state.color.operation       = wgpu::BlendOperation::Add;
+  out.blend_state.alpha.srcFactor       = wgpu::BlendFactor::One;
+  out.blend_state.alpha.dstFactor       = wgpu::BlendFactor::Zero;
+  out.blend_state.alpha.operation       = wgpu::BlendOperation::Add;
+
+  out.color_target_state.blend = config_.blend ? &out.blend_state : nullptr;
+  out.color_target_state.format         = config_.color_format;
+  out.color_target_state.writeMask      = wgpu::ColorWriteMask::All;
+
+  out.fragment_state.module             = shader_module_;
+  out.fragment_state.entryPoint         = config_.fragment_entry.c_str();
+  out.fragment_state.targetCount        = 1;
+  out.fragment_state.targets            = &out.color_target_state;
+  out.fragment_state.constantCount      = out.constants.size();
+  out.fragment_state.constants          = out.constants.data();
+
+  /* a prepass only needs the rasterized depth */
+  desc.fragment = depth_only ? nullptr : &out.fragment_state;
+
+  /* pipeline describe depth stage */
+  if (config_.depth_format != wgpu::TextureFormat::Undefined) {
+    out.depth_stencil = config_.depth_prepass && !depth_only
+                            ? DepthTarget::state(config_.depth_format, false,
+                                                 inclusive(config_.depth_compare))
+                            : DepthTarget::state(config_.depth_format, true,
+                                                 config_.depth_compare);
+    desc.depthStencil = &out.depth_stencil;
+  }
 
   /* pipeline describe multisampling */
-  pipeline_desc.multisample.count                  = 1;
-  pipeline_desc.multisample.mask                   = ~0U;
-  pipeline_desc.multisample.alphaToCoverageEnabled = false;
+  desc.multisample.count                = 1;
+  desc.multisample.mask                 = ~0U;
+
+  desc.layout                           = pipeline_layout_;
+}
+
+uint64_t Material::pipelineKey(uint32_t variant, bool depth_only) const
+{
+  return (uint64_t{id_} << 33) | (uint64_t{depth_only} << 32) | variant;
+}
+
+ustd::result
+Material::setBindings(std::span<const wgpu::BindGroupEntry> entries)
+{
+  if (!shader_module_) {
+    return ustd::unexpected("Material::initialize() was not called");
+  }
+
+  if (entries.size() != config_.material_entries.size()) {
+    return ustd::unexpected("Material bindings do not match its layout");
+  }
+
+  bind_group_ = cache_.getBindGroup(layouts_[material_group], entries);
+  return {};
+}
+
+void Material::apply(DrawCall              &draw,
+                     const wgpu::BindGroup &frame,
+                     uint32_t               variant) const
+{
+  draw.pipeline = &getPipeline(variant);
+  bindGroups(draw, frame);
+}
+
+void Material::applyDepthOnly(DrawCall              &draw,
+                              const wgpu::BindGroup &frame,
+                              uint32_t               variant) const
+{
+  draw.pipeline = &getDepthPipeline(variant);
+  bindGroups(draw, frame);
+}
+
+void Material::bindGroups(DrawCall &draw, const wgpu::BindGroup &frame) const
+{
+  if (!config_.frame_entries.empty()) {
+    draw.bind_groups[frame_group] = &frame;
+  }
+  if (!config_.material_entries.empty()) {
+    draw.bind_groups[material_group] = &bind_group_;
+  }
+}
+
+uint32_t
+Material::getVariant(std::initializer_list<std::string_view> features) const
+{
+  uint32_t variant = 0;
+  for (std::string_view feature : features) {
+    auto it = std::find(config_.features.begin(), config_.features.end(),
+                        feature);
+    assert(it != config_.features.end() && "Unknown shader feature");
+    variant |= 1u << (it - config_.features.begin());
+  }
+  return variant;
+}
 
-  /* data layout */
-  pipeline_desc.layout = nullptr;
+const wgpu::RenderPipeline &Material::getPipeline(uint32_t variant) const
+{
+  return pipeline(variant, false);
+}
+
+const wgpu::RenderPipeline &Material::getDepthPipeline(uint32_t variant) const
+{
+  assert(config_.depth_prepass && "Material has no depth prepass");
+  return pipeline(variant, true);
+}
 
-  pipeline_            = getDevice().CreateRenderPipeline(&pipeline_desc);
+const wgpu::RenderPipeline &Material::pipeline(uint32_t variant,
+                                               bool     depth_only) const
+{
+  uint64_t key = pipelineKey(variant, depth_only);
+  if (const wgpu::RenderPipeline *cached = cache_.findRenderPipeline(key)) {
+    return *cached;
+  }
+
+  PipelineDesc desc;
+  describe(variant, depth_only, desc);
+  return cache_.getRenderPipeline(key, desc.desc);
+}
+
+void Material::precompile(std::span<const uint32_t> variants) const
+{
+  for (uint32_t variant : variants) {
+    for (bool depth_only : {false, true}) {
+      if (depth_only && !config_.depth_prepass) {
+        continue;
+      }
+      PipelineDesc desc;
+      describe(variant, depth_only, desc);
+      cache_.precompileRenderPipeline(pipelineKey(variant, depth_only),
+                                      desc.desc);
+    }
+  }
+}
+
+bool Material::isCompiled(uint32_t variant) const
+{
+  return cache_.findRenderPipeline(pipelineKey(variant, false)) != nullptr
+         && (!config_.depth_prepass
+             || cache_.findRenderPipeline(pipelineKey(variant, true))
+                    != nullptr);
+}
+
+const wgpu::BindGroupLayout &Material::getBindGroupLayout(uint32_t group) const
+{
+  return layouts_.at(group);
+}
+
+const wgpu::BindGroup &Material::getBindGroup() const
+{
+  return bind_group_;
 }
 
 } // namespace rndr
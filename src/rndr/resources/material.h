@@ -13,13 +13,72 @@
 #define RNDR_MATERIAL_H_
 
 #include "renderable_mesh.h"
+#include "resource_cache.h"
 #include "rndr/context.h"
+#include "rndr/render/draw_call.h"
+#include "ustd/expected.h"
+
+#include <array>
+#include <initializer_list>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace rndr {
 
+/**
+ * @brief Bind group slots shared by every material, ordered by how often they
+ * change, so that consecutive draws only rebind the groups that differ.
+ */
+static constexpr uint32_t frame_group    = 0;
+static constexpr uint32_t material_group = 1;
+static constexpr uint32_t object_group   = 2;
+
+/**
+ * @brief A pipeline with an explicit layout, and the bindings of its
+ * `material_group`.
+ *
+ * Layouts are interned through the `ResourceCache`, so materials declaring the
+ * same frame entries share one frame layout and one frame bind group, and
+ * materials binding the same resources share one material bind group.
+ *
+ * Shader variants are selected by a feature bitmask. Bit `i` sets the WGSL
+ * constant `override <features[i]>: bool` of both stages, so the compiler
+ * removes the branches a variant does not take. Variants are compiled on
+ * first use, or ahead of time with `precompile()`, and cached in the
+ * `ResourceCache`. Variant 0 is compiled by `initialize()`.
+ *
+ * With a `Config::depth_format`, pipelines test and write depth. With
+ * `Config::depth_prepass` as well, each variant also gets a depth-only
+ * pipeline without a fragment stage for a prepass, and the color pipelines
+ * only test against the depth it wrote, see `DepthTarget`.
+ */
 class Material : public GlobalAccess {
+public:
+  struct Config {
+    std::string                             shader_source  = {};
+    std::string                             vertex_entry   = "vs_main";
+    std::string                             fragment_entry = "fs_main";
+    wgpu::TextureFormat color_format = wgpu::TextureFormat::BGRA8Unorm;
+    bool                                    blend          = false;
+    /* read positions as laid out by `RenderableMesh`, else no vertex buffer */
+    bool                                    uses_mesh      = true;
+
+    /* `Undefined` draws without a depth attachment */
+    wgpu::TextureFormat depth_format = wgpu::TextureFormat::Undefined;
+    wgpu::CompareFunction depth_compare = wgpu::CompareFunction::Less;
+    bool                                    depth_prepass  = false;
+
+    /* names of the `override` bool constants, by variant mask bit */
+    std::vector<std::string>                features         = {};
+
+    std::vector<wgpu::BindGroupLayoutEntry> frame_entries    = {};
+    std::vector<wgpu::BindGroupLayoutEntry> material_entries = {};
+    std::vector<wgpu::BindGroupLayoutEntry> object_entries   = {};
+  };
 
-  Material(Context &context);
+  Material(Context &context, ResourceCache &cache, Config config);
 
   Material(const Material &)            = delete;
   Material &operator=(const Material &) = delete;
@@ -27,11 +86,68 @@ class Material : public GlobalAccess {
   Material(Material &&)                 = delete;
   Material &operator=(Material &&)      = delete;
 
-  void      draw();
+  [[nodiscard]] ustd::result initialize();
+
+  /* bind the resources of `material_group`, reusing a cached group if any */
+  [[nodiscard]] ustd::result
+  setBindings(std::span<const wgpu::BindGroupEntry> entries);
+
+  /**
+   * @brief Point `draw` at this material's pipeline and bind groups. `frame`
+   * must outlive the draw, the object group and buffers are left to the caller.
+   */
+  void apply(DrawCall              &draw,
+             const wgpu::BindGroup &frame,
+             uint32_t               variant = 0) const;
+
+  /* `apply()` with the depth-only pipeline of `variant`, for a prepass */
+  void applyDepthOnly(DrawCall              &draw,
+                      const wgpu::BindGroup &frame,
+                      uint32_t               variant = 0) const;
+
+  /* mask of the named features, which must be in `Config::features` */
+  uint32_t getVariant(std::initializer_list<std::string_view> features) const;
+
+  /* the pipeline of `variant`, compiling it now if it is not cached yet */
+  const wgpu::RenderPipeline &getPipeline(uint32_t variant = 0) const;
+  /* the depth-only pipeline of `variant`, with `Config::depth_prepass` set */
+  const wgpu::RenderPipeline &getDepthPipeline(uint32_t variant = 0) const;
+
+  /* compile `variants` in the background, see `ResourceCache` */
+  void precompile(std::span<const uint32_t> variants) const;
+
+  bool                        isCompiled(uint32_t variant) const;
+
+  const wgpu::BindGroupLayout &getBindGroupLayout(uint32_t group) const;
+  const wgpu::BindGroup       &getBindGroup() const;
 
 protected:
-  wgpu::RenderPipelineDescriptor desc_;
-  wgpu::RenderPipeline           pipeline_;
+  /* a pipeline descriptor and everything it points to */
+  struct PipelineDesc {
+    wgpu::VertexAttribute              position_attribute = {};
+    wgpu::VertexBufferLayout           vertex_layout      = {};
+    wgpu::BlendState                   blend_state        = {};
+    wgpu::ColorTargetState             color_target_state = {};
+    wgpu::FragmentState                fragment_state     = {};
+    wgpu::DepthStencilState            depth_stencil      = {};
+    std::vector<wgpu::ConstantEntry>   constants          = {};
+    wgpu::RenderPipelineDescriptor     desc               = {};
+  };
+
+  void     describe(uint32_t variant, bool depth_only, PipelineDesc &out) const;
+  uint64_t pipelineKey(uint32_t variant, bool depth_only) const;
+  void     bindGroups(DrawCall &draw, const wgpu::BindGroup &frame) const;
+  const wgpu::RenderPipeline &pipeline(uint32_t variant, bool depth_only) const;
+
+  ResourceCache                       &cache_;
+  const Config                         config_;
+  /* tells this material's pipelines apart in the cache */
+  const uint32_t                       id_;
+
+  std::array<wgpu::BindGroupLayout, 3> layouts_         = {};
+  wgpu::PipelineLayout                 pipeline_layout_ = {};
+  wgpu::ShaderModule                   shader_module_   = {};
+  wgpu::BindGroup                      bind_group_      = {};
 };
 
 } // namespace rndr
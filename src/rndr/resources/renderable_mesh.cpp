@@ -0,0 +1,132 @@
+/**
+ * @file renderable_mesh.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "renderable_mesh.h"
+
+#include <utility>
+
+namespace rndr {
+
+RenderableMesh::RenderableMesh(MeshData &inMeshData)
+    : vertices_(inMeshData.vertices)
+{
+  indices_.reserve(inMeshData.faces.size() * 3);
+
+  /* .obj indices are 1-based */
+  for (math::zvec3 &face : inMeshData.faces) {
+    for (size_t i = 0; i < 3; ++i) {
+      indices_.push_back(static_cast<uint32_t>(face.at(i) - 1));
+    }
+  }
+}
+
+RenderableMesh::~RenderableMesh()
+{
+  release();
+}
+
+RenderableMesh::RenderableMesh(RenderableMesh &&other) noexcept
+    : vertices_(std::move(other.vertices_)),
+      indices_(std::move(other.indices_)),
+      allocator_(std::exchange(other.allocator_, nullptr)),
+      vertex_alloc_(std::exchange(other.vertex_alloc_, {})),
+      index_alloc_(std::exchange(other.index_alloc_, {}))
+{
+}
+
+RenderableMesh &RenderableMesh::operator=(RenderableMesh &&other) noexcept
+{
+  if (this != &other) {
+    release();
+    vertices_     = std::move(other.vertices_);
+    indices_      = std::move(other.indices_);
+    allocator_    = std::exchange(other.allocator_, nullptr);
+    vertex_alloc_ = std::exchange(other.vertex_alloc_, {});
+    index_alloc_  = std::exchange(other.index_alloc_, {});
+  }
+  return *this;
+}
+
+ustd::result RenderableMesh::upload(BufferAllocator &allocator,
+                                    UploadRing      &uploads)
+{
+  release();
+
+  std::span<const math::vec3> vertex_data(vertices_);
+  std::span<const uint32_t>   index_data(indices_);
+
+  auto vertex_alloc = allocator.allocate(BufferClass::Vertex,
+                                         vertex_data.size_bytes());
+  if (!vertex_alloc) {
+    return ustd::unexpected(vertex_alloc.message());
+  }
+
+  auto index_alloc
+      = allocator.allocate(BufferClass::Index, index_data.size_bytes());
+  if (!index_alloc) {
+    allocator.free(*vertex_alloc);
+    return ustd::unexpected(index_alloc.message());
+  }
+
+  allocator_    = &allocator;
+  vertex_alloc_ = *vertex_alloc;
+  index_alloc_  = *index_alloc;
+
+  BufferRange vertex_range = getVertexRange();
+  BufferRange index_range  = getIndexRange();
+
+  if (auto result
+      = uploads.write(vertex_range.buffer, vertex_range.offset, vertex_data);
+      !result) {
+    return result;
+  }
+
+  return uploads.write(index_range.buffer, index_range.offset, index_data);
+}
+
+void RenderableMesh::release()
+{
+  if (allocator_) {
+    allocator_->free(vertex_alloc_);
+    allocator_->free(index_alloc_);
+  }
+
+  allocator_    = nullptr;
+  vertex_alloc_ = {};
+  index_alloc_  = {};
+}
+
+bool RenderableMesh::isUploaded() const
+{
+  return allocator_ != nullptr;
+}
+
+BufferRange RenderableMesh::getVertexRange() const
+{
+  return allocator_ ? allocator_->resolve(vertex_alloc_) : BufferRange{};
+}
+
+BufferRange RenderableMesh::getIndexRange() const
+{
+  return allocator_ ? allocator_->resolve(index_alloc_) : BufferRange{};
+}
+
+uint32_t RenderableMesh::getVertexCount() const
+{
+  return static_cast<uint32_t>(vertices_.size());
+}
+
+uint32_t RenderableMesh::getIndexCount() const
+{
+  return static_cast<uint32_t>(indices_.size());
+}
+
+} // namespace rndr
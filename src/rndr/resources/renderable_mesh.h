@@ -13,6 +13,8 @@
 #define RNDR_MESH_H_
 
 #include "rndr/math/matrix.h"
+#include "rndr/memory/buffer_allocator.h"
+#include "rndr/memory/upload_ring.h"
 #include "rndr/types/types.h"
 
 #include <vector>
@@ -23,11 +25,41 @@ namespace rndr {
 class RenderableMesh {
 public:
   RenderableMesh(MeshData &inMeshData);
+  ~RenderableMesh();
+
+  RenderableMesh(const RenderableMesh &)            = delete;
+  RenderableMesh &operator=(const RenderableMesh &) = delete;
+
+  RenderableMesh(RenderableMesh &&other) noexcept;
+  RenderableMesh &operator=(RenderableMesh &&other) noexcept;
+
+  /**
+   * @brief Suballocate vertex and index ranges from `allocator` and queue the
+   * mesh data on `uploads`. The data is usable once `uploads` is submitted.
+   */
+  [[nodiscard]] ustd::result upload(BufferAllocator &allocator,
+                                    UploadRing      &uploads);
+
+  /* returns the suballocated ranges to the allocator */
+  void                       release();
+
+  bool                       isUploaded() const;
+  BufferRange                getVertexRange() const;
+  BufferRange                getIndexRange() const;
+  uint32_t                   getVertexCount() const;
+  uint32_t                   getIndexCount() const;
+
+  static constexpr wgpu::IndexFormat index_format = wgpu::IndexFormat::Uint32;
 
 private:
   std::vector<math::vec3> vertices_;
+  std::vector<uint32_t>   indices_;
+
+  BufferAllocator        *allocator_    = nullptr;
+  BufferAllocation        vertex_alloc_ = {};
+  BufferAllocation        index_alloc_  = {};
 };
 
 } // namespace rndr
 
-#endif
\ No newline at end of file
+#endif
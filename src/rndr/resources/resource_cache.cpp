@@ -0,0 +1,250 @@
+/**
+ * @file resource_cache.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "resource_cache.h"
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+
+namespace rndr {
+
+template <typename T>
+static uint64_t word(T value)
+{
+  return static_cast<uint64_t>(value);
+}
+
+static uint64_t handle_word(const void *handle)
+{
+  return reinterpret_cast<uintptr_t>(handle);
+}
+
+size_t ResourceCache::KeyHash::operator()(const Key &key) const
+{
+  size_t hash = key.size();
+  for (uint64_t value : key) {
+    hash ^= std::hash<uint64_t>{}(value) + 0x9e3779b97f4a7c15ull + (hash << 6)
+            + (hash >> 2);
+  }
+  return hash;
+}
+
+size_t ResourceCache::ComputePipelineKeyHash::operator()(
+    const ComputePipelineKey &key) const
+{
+  size_t hash = std::hash<std::string>{}(key.source);
+  auto   mix  = [&hash](size_t value) {
+    hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+  };
+  mix(std::hash<std::string>{}(key.entry_point));
+  mix(std::hash<const void *>{}(key.layout));
+  for (const auto &[name, value] : key.constants) {
+    mix(std::hash<std::string>{}(name));
+    mix(std::hash<double>{}(value));
+  }
+  return hash;
+}
+
+ResourceCache::ResourceCache(Context &context) : GlobalAccess(context)
+{
+}
+
+const wgpu::BindGroupLayout &ResourceCache::getBindGroupLayout(
+    std::span<const wgpu::BindGroupLayoutEntry> entries)
+{
+  std::vector<wgpu::BindGroupLayoutEntry> sorted(entries.begin(), entries.end());
+  std::sort(sorted.begin(), sorted.end(),
+            [](const wgpu::BindGroupLayoutEntry &a,
+               const wgpu::BindGroupLayoutEntry &b) {
+              return a.binding < b.binding;
+            });
+
+  Key key;
+  key.reserve(sorted.size() * 12);
+  for (const wgpu::BindGroupLayoutEntry &entry : sorted) {
+    key.insert(key.end(),
+               {word(entry.binding), word(entry.visibility),
+                word(entry.buffer.type), word(entry.buffer.hasDynamicOffset),
+                word(entry.buffer.minBindingSize), word(entry.sampler.type),
+                word(entry.texture.sampleType),
+                word(entry.texture.viewDimension),
+                word(entry.texture.multisampled),
+                word(entry.storageTexture.access),
+                word(entry.storageTexture.format),
+                word(entry.storageTexture.viewDimension)});
+  }
+
+  auto it = layouts_.find(key);
+  if (it != layouts_.end()) {
+    ++stats_.layout_hits;
+    return it->second;
+  }
+
+  wgpu::BindGroupLayoutDescriptor layout_desc = {};
+  layout_desc.entryCount                      = sorted.size();
+  layout_desc.entries                         = sorted.data();
+
+  ++stats_.layouts;
+  return layouts_
+      .emplace(std::move(key), getDevice().CreateBindGroupLayout(&layout_desc))
+      .first->second;
+}
+
+const wgpu::PipelineLayout &
+ResourceCache::getPipelineLayout(std::span<const wgpu::BindGroupLayout> layouts)
+{
+  Key key;
+  key.reserve(layouts.size());
+  for (const wgpu::BindGroupLayout &layout : layouts) {
+    key.push_back(handle_word(layout.Get()));
+  }
+
+  auto it = pipeline_layouts_.find(key);
+  if (it != pipeline_layouts_.end()) {
+    return it->second;
+  }
+
+  wgpu::PipelineLayoutDescriptor layout_desc = {};
+  layout_desc.bindGroupLayoutCount           = layouts.size();
+  layout_desc.bindGroupLayouts               = layouts.data();
+
+  return pipeline_layouts_
+      .emplace(std::move(key), getDevice().CreatePipelineLayout(&layout_desc))
+      .first->second;
+}
+
+const wgpu::BindGroup &
+ResourceCache::getBindGroup(const wgpu::BindGroupLayout          &layout,
+                            std::span<const wgpu::BindGroupEntry> entries)
+{
+  std::vector<wgpu::BindGroupEntry> sorted(entries.begin(), entries.end());
+  std::sort(sorted.begin(), sorted.end(),
+            [](const wgpu::BindGroupEntry &a, const wgpu::BindGroupEntry &b) {
+              return a.binding < b.binding;
+            });
+
+  Key key;
+  key.reserve(1 + sorted.size() * 6);
+  key.push_back(handle_word(layout.Get()));
+  for (const wgpu::BindGroupEntry &entry : sorted) {
+    key.insert(key.end(),
+               {word(entry.binding), handle_word(entry.buffer.Get()),
+                word(entry.offset), word(entry.size),
+                handle_word(entry.sampler.Get()), handle_word(entry.textureView.Get())});
+  }
+
+  auto it = groups_.find(key);
+  if (it != groups_.end()) {
+    ++stats_.group_hits;
+    return it->second;
+  }
+
+  wgpu::BindGroupDescriptor group_desc = {};
+  group_desc.layout                    = layout;
+  group_desc.entryCount                = sorted.size();
+  group_desc.entries                   = sorted.data();
+
+  ++stats_.groups;
+  return groups_
+      .emplace(std::move(key), getDevice().CreateBindGroup(&group_desc))
+      .first->second;
+}
+
+const wgpu::RenderPipeline *ResourceCache::findRenderPipeline(uint64_t key) const
+{
+  auto it = pipelines_.find(key);
+  return it != pipelines_.end() ? &it->second : nullptr;
+}
+
+const wgpu::RenderPipeline &
+ResourceCache::getRenderPipeline(uint64_t                              key,
+                                 const wgpu::RenderPipelineDescriptor &desc)
+{
+  auto it = pipelines_.find(key);
+  if (it != pipelines_.end()) {
+    ++stats_.pipeline_hits;
+    return it->second;
+  }
+
+  /* a pending compile of the same key finds the entry taken and is dropped */
+  ++stats_.pipelines;
+  return pipelines_.emplace(key, getDevice().CreateRenderPipeline(&desc))
+      .first->second;
+}
+
+void ResourceCache::precompileRenderPipeline(
+    uint64_t key, const wgpu::RenderPipelineDescriptor &desc)
+{
+  if (pipelines_.contains(key) || !pending_.insert(key).second) {
+    return;
+  }
+
+  ++stats_.pending;
+  std::weak_ptr<bool> alive = alive_;
+  getDevice().CreateRenderPipelineAsync(
+      &desc, wgpu::CallbackMode::AllowProcessEvents,
+      [this, alive, key](wgpu::CreatePipelineAsyncStatus status,
+                         wgpu::RenderPipeline pipeline, char const *message) {
+        if (alive.expired()) {
+          return;
+        }
+
+        pending_.erase(key);
+        --stats_.pending;
+
+        if (status != wgpu::CreatePipelineAsyncStatus::Success) {
+          std::cerr << "PIPELINE PRECOMPILE FAILED WITH MESSAGE: " << message
+                    << std::endl;
+          return;
+        }
+
+        if (pipelines_.emplace(key, std::move(pipeline)).second) {
+          ++stats_.pipelines;
+        }
+      });
+}
+
+const wgpu::ComputePipeline *
+ResourceCache::findComputePipeline(const ComputePipelineKey &key) const
+{
+  auto it = compute_pipelines_.find(key);
+  return it != compute_pipelines_.end() ? &it->second : nullptr;
+}
+
+const wgpu::ComputePipeline &
+ResourceCache::getComputePipeline(const ComputePipelineKey              &key,
+                                  const wgpu::ComputePipelineDescriptor &desc)
+{
+  auto it = compute_pipelines_.find(key);
+  if (it != compute_pipelines_.end()) {
+    ++stats_.pipeline_hits;
+    return it->second;
+  }
+
+  ++stats_.pipelines;
+  return compute_pipelines_
+      .emplace(key, getDevice().CreateComputePipeline(&desc))
+      .first->second;
+}
+
+void ResourceCache::clearBindGroups()
+{
+  groups_.clear();
+  stats_.groups = 0;
+}
+
+const ResourceCache::Stats &ResourceCache::getStats() const
+{
+  return stats_;
+}
+
+} // namespace rndr
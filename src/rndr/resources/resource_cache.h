@@ -0,0 +1,142 @@
+/**
+ * @file resource_cache.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_RESOURCE_CACHE_H_
+#define RNDR_RESOURCE_CACHE_H_
+
+#include "rndr/context.h"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+/**
+ * @brief Interns bind group layouts and pipeline layouts by content, caches
+ * bind groups by the resources they bind, and render pipelines by a key the
+ * caller derives from everything that distinguishes them.
+ *
+ * Two layouts described by the same entries are the same object, so a bind
+ * group made for one material's layout is compatible with every other material
+ * declaring that group identically. Cached bind groups keep their resources
+ * alive until `clearBindGroups()`.
+ */
+class ResourceCache : public GlobalAccess {
+public:
+  struct Stats {
+    size_t layout_hits   = 0;
+    size_t layouts       = 0;
+    size_t group_hits    = 0;
+    size_t groups        = 0;
+    /* render and compute pipelines alike */
+    size_t pipeline_hits = 0;
+    size_t pipelines     = 0;
+    /* pipelines still compiling in the background */
+    size_t pending       = 0;
+  };
+
+  /* everything that goes into a compute pipeline, compared in full */
+  struct ComputePipelineKey {
+    std::string                                  source      = {};
+    std::string                                  entry_point = {};
+    /* layouts are interned, so they compare by identity */
+    const void                                  *layout      = nullptr;
+    std::vector<std::pair<std::string, double>>  constants   = {};
+
+    bool operator==(const ComputePipelineKey &other) const = default;
+  };
+
+  ResourceCache(Context &context);
+
+  ResourceCache(const ResourceCache &)            = delete;
+  ResourceCache &operator=(const ResourceCache &) = delete;
+
+  ResourceCache(ResourceCache &&)                 = delete;
+  ResourceCache &operator=(ResourceCache &&)      = delete;
+
+  /* entries may come in any order */
+  const wgpu::BindGroupLayout &
+  getBindGroupLayout(std::span<const wgpu::BindGroupLayoutEntry> entries);
+
+  const wgpu::PipelineLayout &
+  getPipelineLayout(std::span<const wgpu::BindGroupLayout> layouts);
+
+  /* `layout` should come from `getBindGroupLayout()` */
+  const wgpu::BindGroup &
+  getBindGroup(const wgpu::BindGroupLayout         &layout,
+               std::span<const wgpu::BindGroupEntry> entries);
+
+  /* the pipeline cached under `key`, or `nullptr` */
+  const wgpu::RenderPipeline *findRenderPipeline(uint64_t key) const;
+
+  /* the pipeline cached under `key`, compiled from `desc` on a miss */
+  const wgpu::RenderPipeline &
+  getRenderPipeline(uint64_t key, const wgpu::RenderPipelineDescriptor &desc);
+
+  /**
+   * @brief Compile `desc` in the background and cache it under `key` once
+   * done, during a later `Context::processEvents()`. Does nothing if `key` is
+   * cached or already compiling.
+   */
+  void precompileRenderPipeline(uint64_t                              key,
+                                const wgpu::RenderPipelineDescriptor &desc);
+
+  /* the compute pipeline cached under `key`, or `nullptr` */
+  const wgpu::ComputePipeline *
+  findComputePipeline(const ComputePipelineKey &key) const;
+
+  /* the compute pipeline cached under `key`, compiled from `desc` on a miss */
+  const wgpu::ComputePipeline &
+  getComputePipeline(const ComputePipelineKey              &key,
+                     const wgpu::ComputePipelineDescriptor &desc);
+
+  /* drop every cached bind group, e.g. after destroying bound resources */
+  void         clearBindGroups();
+
+  const Stats &getStats() const;
+
+private:
+  using Key = std::vector<uint64_t>;
+
+  struct KeyHash {
+    size_t operator()(const Key &key) const;
+  };
+
+  struct ComputePipelineKeyHash {
+    size_t operator()(const ComputePipelineKey &key) const;
+  };
+
+  std::unordered_map<Key, wgpu::BindGroupLayout, KeyHash> layouts_          = {};
+  std::unordered_map<Key, wgpu::PipelineLayout, KeyHash>  pipeline_layouts_ = {};
+  std::unordered_map<Key, wgpu::BindGroup, KeyHash>       groups_           = {};
+  std::unordered_map<uint64_t, wgpu::RenderPipeline>      pipelines_        = {};
+  std::unordered_map<ComputePipelineKey,
+                     wgpu::ComputePipeline,
+                     ComputePipelineKeyHash>              compute_pipelines_ = {};
+  std::unordered_set<uint64_t>                            pending_          = {};
+
+  Stats                                                   stats_            = {};
+
+  /* lets compile callbacks outliving the cache know to bail */
+  std::shared_ptr<bool>                                   alive_
+      = std::make_shared<bool>(true);
+};
+
+} // namespace rndr
+
+#endif
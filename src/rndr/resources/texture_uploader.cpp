@@ -0,0 +1,502 @@
+/**
+ * @file texture_uploader.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "texture_uploader.h"
+#include "rndr/profiling/trace.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace rndr {
+
+static const char *mip_source = R"(
+@group(0) @binding(0) var src: texture_2d<f32>;
+@group(0) @binding(1) var dst: texture_storage_2d<rgba8unorm, write>;
+
+fn to_linear(c: vec3f) -> vec3f {
+  return select(pow((c + 0.055) / 1.055, vec3f(2.4)), c / 12.92,
+                c <= vec3f(0.04045));
+}
+
+fn to_srgb(c: vec3f) -> vec3f {
+  return select(1.055 * pow(c, vec3f(1.0 / 2.4)) - 0.055, c * 12.92,
+                c <= vec3f(0.0031308));
+}
+
+fn load(p: vec2i, srgb: bool) -> vec4f {
+  let c = textureLoad(src, min(p, vec2i(textureDimensions(src)) - 1), 0);
+  if (srgb) {
+    return vec4f(to_linear(c.rgb), c.a);
+  }
+  return c;
+}
+
+/* 2 x 2 box filter, clamped at the edges of odd-sized levels */
+fn downsample_at(id: vec2u, srgb: bool) {
+  if (any(id >= textureDimensions(dst))) {
+    return;
+  }
+
+  let p = vec2i(id) * 2;
+  var c = (load(p, srgb) + load(p + vec2i(1, 0), srgb)
+           + load(p + vec2i(0, 1), srgb) + load(p + vec2i(1, 1), srgb)) * 0.25;
+  if (srgb) {
+    c = vec4f(to_srgb(c.rgb), c.a);
+  }
+  textureStore(dst, id, c);
+}
+
+@compute @workgroup_size(8, 8)
+fn downsample(@builtin(global_invocation_id) id: vec3u) {
+  downsample_at(id.xy, false);
+}
+
+@compute @workgroup_size(8, 8)
+fn downsample_srgb(@builtin(global_invocation_id) id: vec3u) {
+  downsample_at(id.xy, true);
+}
+)";
+
+static const char *bc1_source = R"(
+@group(0) @binding(0) var src: texture_2d<f32>;
+@group(0) @binding(1) var<storage, read_write> blocks: array<vec2u>;
+
+fn pack565(c: vec3f) -> u32 {
+  let q = vec3u(round(saturate(c) * vec3f(31.0, 63.0, 31.0)));
+  return (q.r << 11u) | (q.g << 5u) | q.b;
+}
+
+fn unpack565(v: u32) -> vec3f {
+  return vec3f(f32((v >> 11u) & 31u) / 31.0, f32((v >> 5u) & 63u) / 63.0,
+               f32(v & 31u) / 31.0);
+}
+
+/* one opaque BC1 block per invocation, from the block's bounding box */
+@compute @workgroup_size(8, 8)
+fn encode_bc1(@builtin(global_invocation_id) id: vec3u) {
+  let size        = vec2i(textureDimensions(src));
+  let block_count = (vec2u(size) + 3u) / 4u;
+  if (any(id.xy >= block_count)) {
+    return;
+  }
+  /* rows of blocks are padded to 256 bytes for the copy into the texture */
+  let stride = arrayLength(&blocks) / block_count.y;
+
+  var texels: array<vec3f, 16>;
+  var lo = vec3f(1.0);
+  var hi = vec3f(0.0);
+  for (var i = 0u; i < 16u; i++) {
+    let p     = min(vec2i(id.xy * 4u + vec2u(i % 4u, i / 4u)), size - 1);
+    texels[i] = textureLoad(src, p, 0).rgb;
+    lo        = min(lo, texels[i]);
+    hi        = max(hi, texels[i]);
+  }
+
+  /* insetting the box by 1/16 of its extent reduces the average error */
+  let inset = (hi - lo) / 16.0;
+  let c0    = pack565(hi - inset);
+  let c1    = pack565(lo + inset);
+
+  /* c0 >= c1 per channel, so c0 > c1 selects the four color mode */
+  var indices = 0u;
+  if (c0 != c1) {
+    let e0 = unpack565(c0);
+    let e1 = unpack565(c1);
+    var palette = array<vec3f, 4>(e0, e1, mix(e0, e1, 1.0 / 3.0),
+                                  mix(e0, e1, 2.0 / 3.0));
+
+    for (var i = 0u; i < 16u; i++) {
+      var best      = 0u;
+      var best_dist = 4.0;
+      for (var j = 0u; j < 4u; j++) {
+        let d    = texels[i] - palette[j];
+        let dist = dot(d, d);
+        if (dist < best_dist) {
+          best      = j;
+          best_dist = dist;
+        }
+      }
+      indices |= best << (2u * i);
+    }
+  }
+
+  blocks[id.y * stride + id.x] = vec2u(c0 | (c1 << 16u), indices);
+}
+)";
+
+static constexpr uint32_t bc1_block_bytes = 8;
+
+static uint32_t align_up(uint32_t value, uint32_t alignment)
+{
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+static wgpu::BindGroupLayoutEntry sourceEntry()
+{
+  wgpu::BindGroupLayoutEntry entry = {};
+  entry.binding                    = 0;
+  entry.visibility                 = wgpu::ShaderStage::Compute;
+  entry.texture.sampleType         = wgpu::TextureSampleType::Float;
+  entry.texture.viewDimension      = wgpu::TextureViewDimension::e2D;
+  return entry;
+}
+
+static wgpu::BindGroupLayoutEntry storageTextureEntry()
+{
+  wgpu::BindGroupLayoutEntry entry   = {};
+  entry.binding                      = 1;
+  entry.visibility                   = wgpu::ShaderStage::Compute;
+  entry.storageTexture.access        = wgpu::StorageTextureAccess::WriteOnly;
+  entry.storageTexture.format        = wgpu::TextureFormat::RGBA8Unorm;
+  entry.storageTexture.viewDimension = wgpu::TextureViewDimension::e2D;
+  return entry;
+}
+
+static wgpu::BindGroupLayoutEntry blockEntry()
+{
+  wgpu::BindGroupLayoutEntry entry = {};
+  entry.binding                    = 1;
+  entry.visibility                 = wgpu::ShaderStage::Compute;
+  entry.buffer.type                = wgpu::BufferBindingType::Storage;
+  entry.buffer.minBindingSize      = bc1_block_bytes;
+  return entry;
+}
+
+static wgpu::TextureView levelView(const wgpu::Texture &texture, uint32_t level)
+{
+  wgpu::TextureViewDescriptor view_desc = {};
+  view_desc.dimension                   = wgpu::TextureViewDimension::e2D;
+  view_desc.baseMipLevel                = level;
+  view_desc.mipLevelCount               = 1;
+  return texture.CreateView(&view_desc);
+}
+
+/* bytes per padded row of BC1 blocks, and rows of blocks, of a level */
+static std::pair<uint32_t, uint32_t> blockLayout(uint32_t width, uint32_t height)
+{
+  return {align_up((width + 3) / 4 * bc1_block_bytes, UploadRing::row_alignment),
+          (height + 3) / 4};
+}
+
+TextureUploader::TextureUploader(Context       &context,
+                                 ResourceCache &cache,
+                                 UploadRing    &uploads)
+    : GlobalAccess(context),
+      uploads_(uploads),
+      downsample_(context, cache,
+                  {.source         = mip_source,
+                   .entry_point    = "downsample",
+                   .workgroup_size = {8, 8, 1},
+                   .entries        = {sourceEntry(), storageTextureEntry()}}),
+      downsample_srgb_(context, cache,
+                       {.source         = mip_source,
+                        .entry_point    = "downsample_srgb",
+                        .workgroup_size = {8, 8, 1},
+                        .entries = {sourceEntry(), storageTextureEntry()}}),
+      encode_bc1_(context, cache,
+                  {.source         = bc1_source,
+                   .entry_point    = "encode_bc1",
+                   .workgroup_size = {8, 8, 1},
+                   .entries        = {sourceEntry(), blockEntry()}})
+{
+}
+
+ustd::result TextureUploader::initialize()
+{
+  for (ComputeKernel *kernel : {&downsample_, &downsample_srgb_, &encode_bc1_}) {
+    if (auto result = kernel->initialize(); !result) {
+      return result;
+    }
+  }
+  return {};
+}
+
+ustd::expected<Texture> TextureUploader::create(const ImageData &image)
+{
+  return create(image, Config{});
+}
+
+ustd::expected<Texture> TextureUploader::create(const ImageData &image,
+                                                const Config    &config)
+{
+  RNDR_TRACE_ZONE("TextureUploader::create");
+
+  if (image.width == 0 || image.height == 0
+      || image.pixels.size() != size_t{image.width} * image.height * 4) {
+    return ustd::unexpected("Image is empty or not tightly packed RGBA8");
+  }
+
+  Job job        = {};
+  job.width      = image.width;
+  job.height     = image.height;
+  job.mip_levels = config.generate_mips
+                       ? mipLevelCount(image.width, image.height)
+                       : 1;
+  job.srgb       = config.srgb;
+  job.compressed = canCompress(image, config);
+
+  wgpu::TextureFormat     srgb_format  = wgpu::TextureFormat::RGBA8UnormSrgb;
+
+  wgpu::TextureDescriptor texture_desc = {};
+  texture_desc.label                    = "Texture";
+  texture_desc.size                     = {image.width, image.height, 1};
+  texture_desc.format                   = wgpu::TextureFormat::RGBA8Unorm;
+  texture_desc.mipLevelCount            = job.mip_levels;
+  texture_desc.usage = wgpu::TextureUsage::TextureBinding
+                       | wgpu::TextureUsage::CopyDst;
+  if (job.mip_levels > 1) {
+    texture_desc.usage = texture_desc.usage | wgpu::TextureUsage::StorageBinding;
+  }
+  if (!job.compressed) {
+    texture_desc.usage = texture_desc.usage | config.usage;
+  }
+  if (job.srgb && !job.compressed) {
+    texture_desc.viewFormatCount = 1;
+    texture_desc.viewFormats     = &srgb_format;
+  }
+  job.work   = getContext().createTexture(texture_desc);
+  job.target = job.work;
+
+  if (job.compressed) {
+    texture_desc.label  = "Compressed Texture";
+    texture_desc.format = job.srgb ? wgpu::TextureFormat::BC1RGBAUnormSrgb
+                                   : wgpu::TextureFormat::BC1RGBAUnorm;
+    texture_desc.usage  = wgpu::TextureUsage::TextureBinding
+                         | wgpu::TextureUsage::CopyDst | config.usage;
+    texture_desc.viewFormatCount = 0;
+    texture_desc.viewFormats     = nullptr;
+    job.target = getContext().createTexture(texture_desc);
+  }
+
+  /* stage the base level with its rows padded for the copy */
+  uint32_t row_bytes     = image.width * 4;
+  uint32_t bytes_per_row = align_up(row_bytes, UploadRing::row_alignment);
+
+  wgpu::ImageCopyTexture dst = {};
+  dst.texture                = job.work;
+
+  auto staged = uploads_.reserveTexture(dst, {image.width, image.height, 1},
+                                        bytes_per_row, image.height);
+  if (!staged) {
+    return ustd::unexpected(staged.message());
+  }
+  for (uint32_t y = 0; y < image.height; ++y) {
+    std::memcpy((*staged).data() + size_t{y} * bytes_per_row,
+                image.pixels.data() + size_t{y} * row_bytes, row_bytes);
+  }
+
+  Texture texture    = {};
+  texture.texture    = job.target;
+  texture.format     = texture_desc.format;
+  texture.width      = image.width;
+  texture.height     = image.height;
+  texture.mip_levels = job.mip_levels;
+  texture.compressed = job.compressed;
+
+  wgpu::TextureViewDescriptor view_desc = {};
+  view_desc.dimension                   = wgpu::TextureViewDimension::e2D;
+  if (job.srgb && !job.compressed) {
+    view_desc.format = srgb_format;
+    texture.format   = srgb_format;
+  }
+  texture.view = job.target.CreateView(&view_desc);
+
+  ++stats_.textures;
+  if (job.compressed) {
+    ++stats_.compressed;
+  }
+  if (job.mip_levels > 1 || job.compressed) {
+    pending_.push_back(std::move(job));
+  }
+
+  return texture;
+}
+
+ustd::result TextureUploader::submit()
+{
+  RNDR_TRACE_ZONE("TextureUploader::submit");
+
+  /* the base levels must land before the passes below read them */
+  if (auto result = uploads_.submit(); !result) {
+    return result;
+  }
+
+  if (pending_.empty()) {
+    return {};
+  }
+
+  wgpu::CommandEncoderDescriptor encoder_desc = {};
+  encoder_desc.label = "Texture Uploader Command Encoder";
+  wgpu::CommandEncoder encoder
+      = getDevice().CreateCommandEncoder(&encoder_desc);
+
+  wgpu::ComputePassDescriptor pass_desc = {};
+  pass_desc.label                       = "Texture Uploader Pass";
+  wgpu::ComputePassEncoder  pass        = encoder.BeginComputePass(&pass_desc);
+
+  std::vector<TrackedBuffer> blocks(pending_.size());
+  for (size_t i = 0; i < pending_.size(); ++i) {
+    recordMips(pass, pending_[i]);
+    if (pending_[i].compressed) {
+      blocks[i] = recordEncode(pass, pending_[i]);
+    }
+  }
+  pass.End();
+
+  for (size_t i = 0; i < pending_.size(); ++i) {
+    if (pending_[i].compressed) {
+      recordBlockCopies(encoder, pending_[i], blocks[i]);
+    }
+  }
+
+  wgpu::CommandBuffer commands = encoder.Finish();
+  getContext().getQueue().Submit(1, &commands);
+
+  ++stats_.submits;
+
+  /* scratch of compressed textures, freed once the encode has run */
+  for (size_t i = 0; i < pending_.size(); ++i) {
+    if (pending_[i].compressed) {
+      getContext().destroyLater(std::move(blocks[i]));
+      getContext().destroyLater(std::move(pending_[i].work));
+    }
+  }
+  pending_.clear();
+
+  return {};
+}
+
+bool TextureUploader::canCompress(const ImageData &image, const Config &config)
+{
+  if (!config.compress || image.width % 4 != 0 || image.height % 4 != 0
+      || !getContext().hasFeature(wgpu::FeatureName::TextureCompressionBC)) {
+    return false;
+  }
+
+  /* BC1 has no alpha to speak of, so only opaque images qualify */
+  for (size_t i = 3; i < image.pixels.size(); i += 4) {
+    if (image.pixels[i] != 255) {
+      return false;
+    }
+  }
+  return true;
+}
+
+uint32_t TextureUploader::mipLevelCount(uint32_t width, uint32_t height)
+{
+  return std::bit_width(std::max(width, height));
+}
+
+const TextureUploader::Stats &TextureUploader::getStats() const
+{
+  return stats_;
+}
+
+void TextureUploader::recordMips(const wgpu::ComputePassEncoder &pass,
+                                 const Job                      &job)
+{
+  const ComputeKernel &kernel = job.srgb ? downsample_srgb_ : downsample_;
+
+  for (uint32_t level = 1; level < job.mip_levels; ++level) {
+    wgpu::BindGroupEntry entries[2] = {};
+    entries[0].binding              = 0;
+    entries[0].textureView          = levelView(job.work, level - 1);
+    entries[1].binding              = 1;
+    entries[1].textureView          = levelView(job.work, level);
+
+    wgpu::BindGroupDescriptor group_desc = {};
+    group_desc.layout                    = kernel.getBindGroupLayout();
+    group_desc.entryCount                = 2;
+    group_desc.entries                   = entries;
+    wgpu::BindGroup group = getDevice().CreateBindGroup(&group_desc);
+
+    uint32_t width        = std::max(job.width >> level, 1u);
+    uint32_t height       = std::max(job.height >> level, 1u);
+
+    /* sizes are bounded by the texture limits, so this cannot fail */
+    (void)kernel.dispatch(pass, group, {width, height, 1});
+    ++stats_.levels_generated;
+  }
+}
+
+TrackedBuffer TextureUploader::recordEncode(const wgpu::ComputePassEncoder &pass,
+                                            const Job                      &job)
+{
+  std::vector<uint64_t> offsets(job.mip_levels + 1, 0);
+  for (uint32_t level = 0; level < job.mip_levels; ++level) {
+    auto [bytes_per_row, rows] = blockLayout(std::max(job.width >> level, 1u),
+                                             std::max(job.height >> level, 1u));
+    offsets[level + 1]         = offsets[level] + uint64_t{bytes_per_row} * rows;
+  }
+
+  wgpu::BufferDescriptor buffer_desc = {};
+  buffer_desc.label                  = "BC1 Blocks";
+  buffer_desc.usage = wgpu::BufferUsage::Storage | wgpu::BufferUsage::CopySrc;
+  buffer_desc.size  = offsets.back();
+  TrackedBuffer blocks
+      = getContext().createBuffer(buffer_desc, MemoryCategory::Storage);
+
+  for (uint32_t level = 0; level < job.mip_levels; ++level) {
+    wgpu::BindGroupEntry entries[2] = {};
+    entries[0].binding              = 0;
+    entries[0].textureView          = levelView(job.work, level);
+    entries[1].binding              = 1;
+    entries[1].buffer               = blocks;
+    /* level sizes are multiples of 256, so offsets stay storage-aligned */
+    entries[1].offset               = offsets[level];
+    entries[1].size                 = offsets[level + 1] - offsets[level];
+
+    wgpu::BindGroupDescriptor group_desc = {};
+    group_desc.layout                    = encode_bc1_.getBindGroupLayout();
+    group_desc.entryCount                = 2;
+    group_desc.entries                   = entries;
+    wgpu::BindGroup group = getDevice().CreateBindGroup(&group_desc);
+
+    uint32_t width        = std::max(job.width >> level, 1u);
+    uint32_t height       = std::max(job.height >> level, 1u);
+    (void)encode_bc1_.dispatch(pass, group,
+                               {(width + 3) / 4, (height + 3) / 4, 1});
+    ++stats_.levels_encoded;
+  }
+
+  return blocks;
+}
+
+void TextureUploader::recordBlockCopies(const wgpu::CommandEncoder &encoder,
+                                        const Job                  &job,
+                                        const wgpu::Buffer         &blocks)
+{
+  uint64_t offset = 0;
+  for (uint32_t level = 0; level < job.mip_levels; ++level) {
+    uint32_t width             = std::max(job.width >> level, 1u);
+    uint32_t height            = std::max(job.height >> level, 1u);
+    auto [bytes_per_row, rows] = blockLayout(width, height);
+
+    wgpu::ImageCopyBuffer src  = {};
+    src.buffer                 = blocks;
+    src.layout.offset          = offset;
+    src.layout.bytesPerRow     = bytes_per_row;
+    src.layout.rowsPerImage    = rows;
+
+    wgpu::ImageCopyTexture dst = {};
+    dst.texture                = job.target;
+    dst.mipLevel               = level;
+
+    /* compressed levels are copied whole blocks at a time */
+    wgpu::Extent3D size        = {(width + 3) / 4 * 4, rows * 4, 1};
+    encoder.CopyBufferToTexture(&src, &dst, &size);
+
+    offset += uint64_t{bytes_per_row} * rows;
+  }
+}
+
+} // namespace rndr
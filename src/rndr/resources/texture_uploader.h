@@ -0,0 +1,132 @@
+/**
+ * @file texture_uploader.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_TEXTURE_UPLOADER_H_
+#define RNDR_TEXTURE_UPLOADER_H_
+
+#include "resource_cache.h"
+#include "rndr/compute/compute_kernel.h"
+#include "rndr/context.h"
+#include "rndr/memory/upload_ring.h"
+#include "rndr/types/types.h"
+#include "ustd/expected.h"
+
+#include <cstdint>
+#include <vector>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+struct Texture {
+  TrackedTexture      texture    = {};
+  /* a view of every mip level, in the sRGB format if requested */
+  wgpu::TextureView   view       = {};
+  wgpu::TextureFormat format     = wgpu::TextureFormat::Undefined;
+  uint32_t            width      = 0;
+  uint32_t            height     = 0;
+  uint32_t            mip_levels = 1;
+  bool                compressed = false;
+};
+
+/**
+ * @brief Creates textures from decoded images, staging their pixels through
+ * the `UploadRing` and building everything else on the GPU.
+ *
+ * `create()` queues the base level. `submit()` submits the staged uploads,
+ * then records, for every texture created since the last submit, one compute
+ * pass that box-filters each mip level from the one above it and, for
+ * compressed textures, encodes each level into BC1 blocks that are copied
+ * into the final texture. The CPU never touches anything but the base level.
+ *
+ * Opaque images whose sides are multiples of 4 are compressed when
+ * `Context::hasFeature(wgpu::FeatureName::TextureCompressionBC)`.
+ */
+class TextureUploader : public GlobalAccess {
+public:
+  struct Config {
+    bool               generate_mips = true;
+    /* filter in linear space, and view the texture as sRGB */
+    bool               srgb          = false;
+    bool               compress      = true;
+    /* usages besides TextureBinding | CopyDst */
+    wgpu::TextureUsage usage         = wgpu::TextureUsage::None;
+  };
+
+  struct Stats {
+    uint32_t textures         = 0;
+    uint32_t compressed       = 0;
+    /* levels built on the GPU, whether filtered or encoded */
+    uint32_t levels_generated = 0;
+    uint32_t levels_encoded   = 0;
+    uint32_t submits          = 0;
+  };
+
+  TextureUploader(Context &context, ResourceCache &cache, UploadRing &uploads);
+
+  TextureUploader(const TextureUploader &)            = delete;
+  TextureUploader &operator=(const TextureUploader &) = delete;
+
+  TextureUploader(TextureUploader &&)                 = delete;
+  TextureUploader &operator=(TextureUploader &&)      = delete;
+
+  [[nodiscard]] ustd::result initialize();
+
+  /**
+   * @brief Create a texture of `image` and stage its base level. The texture
+   * may be bound right away, but holds its contents only after `submit()`.
+   */
+  [[nodiscard]] ustd::expected<Texture> create(const ImageData &image);
+  [[nodiscard]] ustd::expected<Texture> create(const ImageData &image,
+                                               const Config    &config);
+
+  /* submit the staged uploads, then build every pending texture's levels */
+  [[nodiscard]] ustd::result            submit();
+
+  /* whether `create()` would compress `image` on this device */
+  bool canCompress(const ImageData &image, const Config &config);
+
+  static uint32_t mipLevelCount(uint32_t width, uint32_t height);
+
+  const Stats    &getStats() const;
+
+private:
+  struct Job {
+    /* RGBA8 texture the mips are filtered in */
+    TrackedTexture work       = {};
+    /* the texture handed out, either `work` or a compressed copy of it */
+    TrackedTexture target     = {};
+    uint32_t       width      = 0;
+    uint32_t       height     = 0;
+    uint32_t       mip_levels = 1;
+    bool           srgb       = false;
+    bool           compressed = false;
+  };
+
+  void recordMips(const wgpu::ComputePassEncoder &pass, const Job &job);
+  /* @return the buffer of BC1 blocks encoded for every level of `job` */
+  TrackedBuffer recordEncode(const wgpu::ComputePassEncoder &pass,
+                             const Job                      &job);
+  void          recordBlockCopies(const wgpu::CommandEncoder &encoder,
+                                 const Job                  &job,
+                                 const wgpu::Buffer         &blocks);
+
+  UploadRing      &uploads_;
+  ComputeKernel    downsample_;
+  ComputeKernel    downsample_srgb_;
+  ComputeKernel    encode_bc1_;
+
+  std::vector<Job> pending_ = {};
+  Stats            stats_   = {};
+};
+
+} // namespace rndr
+
+#endif
@@ -0,0 +1,277 @@
+/**
+ * @file scene.cpp
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "scene.h"
+#include "rndr/math/ops.h"
+#include "rndr/profiling/trace.h"
+
+#include <algorithm>
+
+namespace rndr {
+
+/* `values[i] = values[order[i]]` */
+template <typename T>
+static void permute(std::vector<T> &values, const std::vector<uint32_t> &order)
+{
+  std::vector<T> permuted(values.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    permuted[i] = values[order[i]];
+  }
+  values = std::move(permuted);
+}
+
+void Scene::reserve(size_t count)
+{
+  parents_.reserve(count);
+  depths_.reserve(count);
+  locals_.reserve(count);
+  worlds_.reserve(count);
+  dirty_.reserve(count);
+  stamps_.reserve(count);
+  nodes_.reserve(count);
+  instances_.reserve(count);
+}
+
+Scene::Node Scene::addNode(const Transform &local, Node parent)
+{
+  const uint32_t instance = static_cast<uint32_t>(nodes_.size());
+  const Node     node     = static_cast<Node>(instances_.size());
+
+  uint32_t       depth           = 0;
+  uint32_t       parent_instance = no_parent;
+  if (parent != no_parent) {
+    parent_instance = instances_[parent];
+    depth           = depths_[parent_instance] + 1;
+  }
+
+  /* appending keeps the order unless a deeper node is already last */
+  if (!depths_.empty() && depth < depths_.back()) {
+    unsorted_ = true;
+  }
+
+  parents_.push_back(parent_instance);
+  depths_.push_back(depth);
+  locals_.push_back(local);
+  worlds_.push_back(local);
+  dirty_.push_back(1);
+  stamps_.push_back(0);
+  nodes_.push_back(node);
+  instances_.push_back(instance);
+
+  if (dirty_count_ == 0 || instance < first_dirty_) {
+    first_dirty_ = instance;
+  }
+  ++dirty_count_;
+  ++stats_.nodes;
+
+  return node;
+}
+
+void Scene::setLocal(Node node, const Transform &local)
+{
+  const uint32_t instance = instances_[node];
+  locals_[instance]       = local;
+
+  if (dirty_[instance]) {
+    return;
+  }
+
+  dirty_[instance] = 1;
+  if (dirty_count_ == 0 || instance < first_dirty_) {
+    first_dirty_ = instance;
+  }
+  ++dirty_count_;
+}
+
+const Scene::Transform &Scene::getLocal(Node node) const
+{
+  return locals_[instances_[node]];
+}
+
+const Scene::Transform &Scene::getWorld(Node node) const
+{
+  return worlds_[instances_[node]];
+}
+
+Scene::Node Scene::getParent(Node node) const
+{
+  uint32_t parent = parents_[instances_[node]];
+  return parent == no_parent ? no_parent : nodes_[parent];
+}
+
+uint32_t Scene::getDepth(Node node) const
+{
+  return depths_[instances_[node]];
+}
+
+uint32_t Scene::getInstance(Node node) const
+{
+  return instances_[node];
+}
+
+size_t Scene::size() const
+{
+  return nodes_.size();
+}
+
+void Scene::update()
+{
+  RNDR_TRACE_ZONE("Scene::update");
+
+  if (unsorted_) {
+    sortByDepth();
+  }
+
+  stats_.updated = 0;
+  if (dirty_count_ == 0) {
+    return;
+  }
+
+  /* a node moves if it was set or its parent moved in this same pass */
+  ++epoch_;
+  const uint32_t count = static_cast<uint32_t>(nodes_.size());
+  for (uint32_t i = first_dirty_; i < count; ++i) {
+    const uint32_t parent = parents_[i];
+    const bool     moved  = parent != no_parent && stamps_[parent] == epoch_;
+    if (!dirty_[i] && !moved) {
+      continue;
+    }
+
+    if (parent == no_parent) {
+      worlds_[i] = locals_[i];
+    }
+    else {
+      math::multiply_mat4(worlds_[parent].data(), locals_[i].data(),
+                          worlds_[i].data());
+    }
+
+    dirty_[i]  = 0;
+    stamps_[i] = epoch_;
+    markChanged(i);
+    ++stats_.updated;
+  }
+
+  dirty_count_ = 0;
+  first_dirty_ = 0;
+}
+
+std::span<const Scene::Transform> Scene::getWorlds() const
+{
+  return worlds_;
+}
+
+ustd::result Scene::upload(UploadRing         &uploads,
+                           const wgpu::Buffer &buffer,
+                           uint64_t            offset)
+{
+  RNDR_TRACE_ZONE("Scene::upload");
+
+  stats_.uploaded = 0;
+  stats_.copies   = 0;
+
+  if (offset + nodes_.size() * sizeof(Transform) > buffer.GetSize()) {
+    return ustd::unexpected("Scene does not fit in the instance buffer");
+  }
+
+  for (const Range &range : pending_) {
+    auto result = uploads.write(
+        buffer, offset + uint64_t{range.first} * sizeof(Transform),
+        worlds_.data() + range.first, uint64_t{range.count} * sizeof(Transform));
+    if (!result) {
+      return result;
+    }
+
+    stats_.uploaded += range.count;
+    ++stats_.copies;
+  }
+
+  pending_.clear();
+  return {};
+}
+
+const Scene::Stats &Scene::getStats() const
+{
+  return stats_;
+}
+
+void Scene::sortByDepth()
+{
+  RNDR_TRACE_ZONE("Scene::sortByDepth");
+
+  /* a counting sort, stable so siblings keep the order they were added in */
+  const uint32_t count     = static_cast<uint32_t>(nodes_.size());
+  const uint32_t max_depth = *std::max_element(depths_.begin(), depths_.end());
+
+  std::vector<uint32_t> starts(max_depth + 2, 0);
+  for (uint32_t depth : depths_) {
+    ++starts[depth + 1];
+  }
+  for (size_t d = 1; d < starts.size(); ++d) {
+    starts[d] += starts[d - 1];
+  }
+
+  /* `order[new instance] = old instance`, `remap` the other way around */
+  std::vector<uint32_t> order(count);
+  std::vector<uint32_t> remap(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    uint32_t instance     = starts[depths_[i]]++;
+    order[instance]       = i;
+    remap[i]              = instance;
+    instances_[nodes_[i]] = instance;
+  }
+
+  permute(parents_, order);
+  permute(depths_, order);
+  permute(locals_, order);
+  permute(worlds_, order);
+  permute(nodes_, order);
+
+  for (uint32_t &parent : parents_) {
+    if (parent != no_parent) {
+      parent = remap[parent];
+    }
+  }
+
+  /* the instance buffer is reordered as well, so all of it goes out again */
+  std::fill(dirty_.begin(), dirty_.end(), uint8_t{1});
+  std::fill(stamps_.begin(), stamps_.end(), 0u);
+  epoch_       = 0;
+  dirty_count_ = count;
+  first_dirty_ = 0;
+  pending_.clear();
+  unsorted_ = false;
+  ++stats_.sorts;
+}
+
+void Scene::markChanged(uint32_t instance)
+{
+  if (!pending_.empty()) {
+    Range   &last = pending_.back();
+    uint32_t end  = last.first + last.count;
+    if (instance >= last.first && instance < end) {
+      return;
+    }
+    if (instance >= end && instance - end <= upload_gap) {
+      last.count = instance + 1 - last.first;
+      return;
+    }
+  }
+
+  /* with runs this short, one copy of every instance is the cheaper upload */
+  if (pending_.size() > nodes_.size() / (upload_gap + 1)) {
+    pending_.assign(1, {0, static_cast<uint32_t>(nodes_.size())});
+    return;
+  }
+
+  pending_.push_back({instance, 1});
+}
+
+} // namespace rndr
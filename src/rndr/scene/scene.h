@@ -0,0 +1,138 @@
+/**
+ * @file scene.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_SCENE_H_
+#define RNDR_SCENE_H_
+
+#include "rndr/math/matrix.h"
+#include "rndr/memory/upload_ring.h"
+#include "ustd/expected.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+#include <webgpu/webgpu_cpp.h>
+
+namespace rndr {
+
+/**
+ * @brief A transform hierarchy stored as parallel arrays sorted by depth, so
+ * that every parent precedes its children and world transforms propagate in
+ * one linear pass.
+ *
+ * `setLocal()` only flags a node. `update()` then recomputes the world
+ * transforms of the flagged nodes and their descendants, starting at the
+ * first flagged one, and leaves every other node untouched. The recomputed
+ * transforms are coalesced into runs that `upload()` queues on an `UploadRing`
+ * into an instance buffer, read by shaders as `array<mat4x4f>` indexed by
+ * `getInstance()`.
+ *
+ * Nodes keep their `Node` handle, but adding a node shallower than the
+ * deepest one reorders the arrays on the next `update()`, which then
+ * recomputes and uploads every node.
+ */
+class Scene {
+public:
+  using Transform                 = math::matrix<4, 4>;
+  using Node                      = uint32_t;
+
+  static constexpr Node no_parent = std::numeric_limits<Node>::max();
+
+  /* clean instances uploaded anyway to join two runs, cheaper than a copy */
+  static constexpr uint32_t upload_gap = 4;
+
+  struct Stats {
+    uint32_t nodes    = 0;
+    /* world transforms recomputed by the last `update()` */
+    uint32_t updated  = 0;
+    /* instances and copies queued by the last `upload()` */
+    uint32_t uploaded = 0;
+    uint32_t copies   = 0;
+    /* times the arrays were reordered by depth */
+    uint32_t sorts    = 0;
+  };
+
+  Scene()                         = default;
+
+  Scene(const Scene &)            = delete;
+  Scene &operator=(const Scene &) = delete;
+
+  Scene(Scene &&)                 = delete;
+  Scene &operator=(Scene &&)      = delete;
+
+  void             reserve(size_t count);
+
+  /* `parent` must already exist, its world transform applies after `local` */
+  Node             addNode(const Transform &local, Node parent = no_parent);
+  void             setLocal(Node node, const Transform &local);
+
+  const Transform &getLocal(Node node) const;
+  /* as of the last `update()` */
+  const Transform &getWorld(Node node) const;
+  Node             getParent(Node node) const;
+  uint32_t         getDepth(Node node) const;
+  /* the node's index in `getWorlds()` and the instance buffer */
+  uint32_t         getInstance(Node node) const;
+  size_t           size() const;
+
+  /* recompute the world transforms of the changed subtrees */
+  void             update();
+
+  /* every world transform, in instance order */
+  std::span<const Transform> getWorlds() const;
+
+  /**
+   * @brief Queue the world transforms recomputed since the last `upload()`
+   * into `buffer`, which holds every instance from `offset` on. The
+   * `UploadRing` must be submitted before the frame's draws.
+   */
+  [[nodiscard]] ustd::result upload(UploadRing         &uploads,
+                                    const wgpu::Buffer &buffer,
+                                    uint64_t            offset = 0);
+
+  const Stats               &getStats() const;
+
+private:
+  /* instances `[first, first + count)` waiting for `upload()` */
+  struct Range {
+    uint32_t first = 0;
+    uint32_t count = 0;
+  };
+
+  void                   sortByDepth();
+  void                   markChanged(uint32_t instance);
+
+  /* indexed by instance, in depth order */
+  std::vector<uint32_t>  parents_     = {};
+  std::vector<uint32_t>  depths_      = {};
+  std::vector<Transform> locals_      = {};
+  std::vector<Transform> worlds_      = {};
+  std::vector<uint8_t>   dirty_       = {};
+  /* `epoch_` of the update that last recomputed the world transform */
+  std::vector<uint32_t>  stamps_      = {};
+  std::vector<Node>      nodes_       = {};
+
+  /* indexed by `Node` */
+  std::vector<uint32_t>  instances_   = {};
+
+  std::vector<Range>     pending_     = {};
+  uint32_t               epoch_       = 0;
+  uint32_t               first_dirty_ = 0;
+  uint32_t               dirty_count_ = 0;
+  bool                   unsorted_    = false;
+  Stats                  stats_       = {};
+};
+
+} // namespace rndr
+
+#endif
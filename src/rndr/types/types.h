@@ -14,6 +14,7 @@
 
 #include "rndr/math/matrix.h"
 
+#include <cstdint>
 #include <iostream>
 #include <type_traits>
 #include <vector>
@@ -32,6 +33,16 @@ struct MeshData {
   }
 };
 
+/********** Image Data **********/
+/* a decoded image, as tightly packed RGBA8 rows */
+struct ImageData {
+  uint32_t             width  = 0;
+  uint32_t             height = 0;
+  std::vector<uint8_t> pixels = {};
+
+  bool                 operator==(const ImageData &other) const = default;
+};
+
 /********** Resource Type Traits **********/
 template <typename T, typename = void>
 struct is_rndr_resource : std::false_type {};
@@ -10,7 +10,11 @@
  */
 
 #include "helpers.h"
+#include "rndr/profiling/trace.h"
+#include "rndr/render/depth_target.h"
 
+#include <algorithm>
+#include <cctype>
 #include <iostream>
 #include <vector>
 
@@ -107,8 +111,10 @@ wgpu::Device requestWGPUDevice(wgpu::Adapter adapter)
   return std::move(udata.device);
 }
 
-wgpu::RenderPipeline createRenderPipeline(Context &context)
+wgpu::RenderPipeline createRenderPipeline(Context            &context,
+                                          wgpu::TextureFormat depth_format)
 {
+  RNDR_TRACE_ZONE("createRenderPipeline");
 
   const char *shaderSource = R"(
 @vertex
@@ -173,7 +179,7 @@ fn fs_main() -> @location(0) vec4<f32> {
 
   wgpu::ColorTargetState color_target_state = {};
   color_target_state.blend                  = &blend_state;
-  color_target_state.format                 = wgpu::TextureFormat::BGRA8Unorm;
+  color_target_state.format                 = context.getSurfaceFormat();
   color_target_state.writeMask              = wgpu::ColorWriteMask::All;
 
   wgpu::FragmentState fragment_state        = {};
@@ -185,7 +191,10 @@ fn fs_main() -> @location(0) vec4<f32> {
   pipeline_desc.fragment                    = &fragment_state;
 
   /* pipeline depth/stencil settings */
-  pipeline_desc.depthStencil = nullptr;
+  wgpu::DepthStencilState depth_stencil = DepthTarget::state(depth_format);
+  pipeline_desc.depthStencil
+      = depth_format != wgpu::TextureFormat::Undefined ? &depth_stencil
+                                                       : nullptr;
 
   /* pipeline describe multisampling */
   pipeline_desc.multisample.count                  = 1;
@@ -361,6 +370,90 @@ bool limits_supported(wgpu::Limits required_limits,
   return temp;
 }
 
+template <typename T>
+static const T *first_supported(std::span<const T> preferred,
+                                std::span<const T> supported)
+{
+  for (const T &value : preferred) {
+    if (std::find(supported.begin(), supported.end(), value)
+        != supported.end()) {
+      return &value;
+    }
+  }
+  return nullptr;
+}
+
+wgpu::TextureFormat
+choose_surface_format(std::span<const wgpu::TextureFormat> preferred,
+                      std::span<const wgpu::TextureFormat> supported)
+{
+  if (const auto *format = first_supported(preferred, supported)) {
+    return *format;
+  }
+  return supported.empty() ? wgpu::TextureFormat::Undefined : supported[0];
+}
+
+wgpu::PresentMode
+choose_present_mode(std::span<const wgpu::PresentMode> preferred,
+                    std::span<const wgpu::PresentMode> supported)
+{
+  if (const auto *mode = first_supported(preferred, supported)) {
+    return *mode;
+  }
+  return wgpu::PresentMode::Fifo;
+}
+
+bool workgroup_size_supported(std::array<uint32_t, 3> size,
+                              const wgpu::Limits     &limits)
+{
+  uint64_t invocations = uint64_t{size[0]} * size[1] * size[2];
+  return invocations > 0
+         && invocations <= limits.maxComputeInvocationsPerWorkgroup
+         && size[0] <= limits.maxComputeWorkgroupSizeX
+         && size[1] <= limits.maxComputeWorkgroupSizeY
+         && size[2] <= limits.maxComputeWorkgroupSizeZ;
+}
+
+ustd::expected<std::array<uint32_t, 3>>
+workgroup_count(std::array<uint32_t, 3> invocations,
+                std::array<uint32_t, 3> size,
+                const wgpu::Limits     &limits)
+{
+  if (!workgroup_size_supported(size, limits)) {
+    return ustd::unexpected("Workgroup size exceeds the device's limits");
+  }
+
+  std::array<uint32_t, 3> count = {};
+  for (size_t i = 0; i < 3; ++i) {
+    count[i] = static_cast<uint32_t>(
+        (uint64_t{invocations[i]} + size[i] - 1) / size[i]);
+    if (count[i] > limits.maxComputeWorkgroupsPerDimension) {
+      return ustd::unexpected("Dispatch of " + std::to_string(count[i])
+                              + " workgroups exceeds "
+                                "maxComputeWorkgroupsPerDimension");
+    }
+  }
+  return count;
+}
+
+bool declares_override(std::string_view source, std::string_view name)
+{
+  const std::string declaration = "override " + std::string(name);
+
+  size_t position = source.find(declaration);
+  while (position != std::string_view::npos) {
+    /* `override size_x` must not match `override size_xy` */
+    size_t end = position + declaration.size();
+    if (end == source.size()
+        || (!std::isalnum(static_cast<unsigned char>(source[end]))
+            && source[end] != '_')) {
+      return true;
+    }
+    position = source.find(declaration, position + 1);
+  }
+  return false;
+}
+
 } // namespace helpers
 
 } // namespace rndr
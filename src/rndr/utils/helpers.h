@@ -10,16 +10,26 @@
  */
 
 #include "rndr/context.h"
+#include "ustd/expected.h"
 
 #include "webgpu/webgpu_cpp.h"
 #include <GLFW/glfw3.h>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
 
 #ifndef WGPU_HELPERS_H
 #define WGPU_HELPERS_H
 
 namespace rndr {
 
-wgpu::RenderPipeline createRenderPipeline(Context &context);
+/* draws into the surface format, `depth_format` other than `Undefined` tests
+ * and writes depth */
+wgpu::RenderPipeline
+createRenderPipeline(Context            &context,
+                     wgpu::TextureFormat depth_format
+                     = wgpu::TextureFormat::Undefined);
 
 namespace helpers {
 
@@ -35,6 +45,32 @@ void default_error_callback(WGPUErrorType type,
 bool limits_supported(wgpu::Limits required_limits,
                       wgpu::Limits supported_limits);
 
+/* the first of `preferred` in `supported`, else the first supported format */
+wgpu::TextureFormat
+choose_surface_format(std::span<const wgpu::TextureFormat> preferred,
+                      std::span<const wgpu::TextureFormat> supported);
+
+/* the first of `preferred` in `supported`, else `Fifo`, which is always there */
+wgpu::PresentMode
+choose_present_mode(std::span<const wgpu::PresentMode> preferred,
+                    std::span<const wgpu::PresentMode> supported);
+
+/* whether `@workgroup_size(size)` fits the device's maxComputeWorkgroupSize* */
+bool workgroup_size_supported(std::array<uint32_t, 3> size,
+                              const wgpu::Limits     &limits);
+
+/**
+ * @brief Workgroups of `size` needed to cover `invocations` threads, or an
+ * error if that takes more than maxComputeWorkgroupsPerDimension.
+ */
+ustd::expected<std::array<uint32_t, 3>>
+workgroup_count(std::array<uint32_t, 3> invocations,
+                std::array<uint32_t, 3> size,
+                const wgpu::Limits     &limits);
+
+/* whether `source` declares `override name`, matching the whole identifier */
+bool declares_override(std::string_view source, std::string_view name);
+
 } // namespace helpers
 
 } // namespace rndr
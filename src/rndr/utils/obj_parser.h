@@ -13,6 +13,7 @@
 #define RNDR_OBJ_PARSER_H_
 
 #include "rndr/math/matrix.h"
+#include "rndr/profiling/trace.h"
 #include "rndr/types/types.h"
 
 #include <cstddef>
@@ -27,6 +28,7 @@ namespace rndr {
 
 static std::optional<MeshData> parseObjFile(std::filesystem::path obj_path)
 {
+  RNDR_TRACE_ZONE("parseObjFile");
 
   enum class RowType { Vertex, Face, Invalid };
   const std::map<char, RowType> row_type_map
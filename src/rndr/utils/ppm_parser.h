@@ -0,0 +1,133 @@
+/**
+ * @file ppm_parser.h
+ * @author Jackson Wyatt Kaplan (JwyattK@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RNDR_PPM_PARSER_H_
+#define RNDR_PPM_PARSER_H_
+
+#include "rndr/profiling/trace.h"
+#include "rndr/types/types.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <system_error>
+
+namespace rndr {
+
+/* no texture may be larger than this along either axis */
+static constexpr uint32_t ppm_max_dimension = 16384;
+
+/**
+ * @brief Decode a binary (P6) or plain (P3) PPM with a maximum value of at
+ * most 255 and at most `ppm_max_dimension` pixels along each axis into opaque
+ * RGBA8.
+ */
+static std::optional<ImageData> parsePpmFile(std::filesystem::path ppm_path)
+{
+  RNDR_TRACE_ZONE("parsePpmFile");
+
+  if (!std::filesystem::exists(ppm_path) || ppm_path.extension() != ".ppm") {
+    return std::nullopt;
+  }
+
+  std::ifstream ifs(ppm_path, std::ios::binary);
+
+  /* header fields are separated by whitespace, with `#` comments to eol */
+  auto          next_field = [&ifs]() -> std::optional<uint32_t> {
+    for (int c = ifs.peek(); c != EOF; c = ifs.peek()) {
+      if (c == '#') {
+        std::string comment;
+        std::getline(ifs, comment);
+      }
+      else if (std::isspace(c)) {
+        ifs.get();
+      }
+      else {
+        break;
+      }
+    }
+
+    uint32_t value;
+    if (!(ifs >> value)) {
+      return std::nullopt;
+    }
+    return value;
+  };
+
+  std::string magic;
+  ifs >> magic;
+  if (magic != "P6" && magic != "P3") {
+    return std::nullopt;
+  }
+
+  auto width  = next_field();
+  auto height = next_field();
+  auto maxval = next_field();
+  if (!width || !height || !maxval || *width == 0 || *height == 0
+      || *maxval == 0 || *maxval > 255 || *width > ppm_max_dimension
+      || *height > ppm_max_dimension) {
+    return std::nullopt;
+  }
+
+  /* every pixel takes at least 3 bytes, so a header claiming more than the
+   * file holds never gets its pixels allocated */
+  std::error_code error;
+  uint64_t        file_size = std::filesystem::file_size(ppm_path, error);
+  auto            position  = ifs.tellg();
+  if (error || position < 0
+      || uint64_t{*width} * *height * 3
+             > file_size - static_cast<uint64_t>(position)) {
+    return std::nullopt;
+  }
+
+  ImageData image;
+  image.width  = *width;
+  image.height = *height;
+  image.pixels.resize(size_t{image.width} * image.height * 4);
+
+  /* exactly one whitespace byte separates the header from binary samples */
+  if (magic == "P6") {
+    ifs.get();
+  }
+
+  for (size_t i = 0; i < size_t{image.width} * image.height; ++i) {
+    for (size_t c = 0; c < 3; ++c) {
+      uint32_t sample;
+      if (magic == "P6") {
+        int byte = ifs.get();
+        if (byte == EOF) {
+          return std::nullopt;
+        }
+        sample = static_cast<uint32_t>(byte);
+      }
+      else if (auto field = next_field()) {
+        sample = *field;
+      }
+      else {
+        return std::nullopt;
+      }
+
+      image.pixels[i * 4 + c] = static_cast<uint8_t>(
+          std::min<uint32_t>(sample, *maxval) * 255 / *maxval);
+    }
+    image.pixels[i * 4 + 3] = 255;
+  }
+
+  return image;
+}
+
+} // namespace rndr
+
+#endif
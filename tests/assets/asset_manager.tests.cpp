@@ -0,0 +1,179 @@
+#include "rndr/assets/asset_manager.h"
+#include "rndr/context.h"
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+static std::filesystem::path writeTetrahedron(const std::string &name)
+{
+  std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+  std::ofstream         ofs(path);
+  ofs << "v 1.0 0.0 1.0\nv 0.0 0.0 1.0\nv 1.0 1.0 1.0\nv 1.0 1.0 0.0\n"
+         "f 1 2 3\nf 1 2 4\nf 2 3 4\nf 1 3 4\n";
+  return path;
+}
+
+static void pumpUntilSettled(rndr::Context      &context,
+                             rndr::AssetManager &assets,
+                             rndr::MeshHandle    handle)
+{
+  for (int i = 0; i < 1000; ++i) {
+    auto state = assets.getState(handle);
+    if (state != rndr::AssetManager::State::Loading
+        && state != rndr::AssetManager::State::Uploading) {
+      return;
+    }
+    context.processEvents();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+TEST_CASE("Asset manager loads, dedups and uploads meshes", "[assets]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::JobSystem       jobs;
+  rndr::BufferAllocator allocator(*context);
+  rndr::UploadRing      uploads(*context);
+  rndr::AssetManager    assets(*context, jobs, allocator, uploads);
+
+  auto                  path   = writeTetrahedron("asset_manager_a.obj");
+  rndr::MeshHandle      handle = assets.loadMesh(path);
+  REQUIRE(handle.valid());
+  REQUIRE(assets.loadMesh(path) == handle);
+  REQUIRE(assets.getStats().dedup_hits == 1);
+
+  pumpUntilSettled(*context, assets, handle);
+  REQUIRE(assets.isReady(handle));
+
+  const rndr::RenderableMesh *mesh = assets.getMesh(handle);
+  REQUIRE(mesh != nullptr);
+  REQUIRE(mesh->getVertexCount() == 4);
+  REQUIRE(mesh->getIndexCount() == 12);
+  REQUIRE(assets.getStats().resident_bytes == 4 * 12 + 12 * 4);
+
+  rndr::MeshHandle missing = assets.loadMesh("does_not_exist.obj");
+  pumpUntilSettled(*context, assets, missing);
+  REQUIRE(assets.getState(missing) == rndr::AssetManager::State::Failed);
+  REQUIRE(!assets.getError(missing).empty());
+
+  assets.release(missing);
+  REQUIRE(assets.getState(missing) == rndr::AssetManager::State::Invalid);
+}
+
+TEST_CASE("Asset manager evicts unreferenced meshes over budget", "[assets]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::JobSystem            jobs;
+  rndr::BufferAllocator      allocator(*context);
+  rndr::UploadRing           uploads(*context);
+  rndr::AssetManager::Config config;
+  config.budget_bytes = 100;
+  rndr::AssetManager assets(*context, jobs, allocator, uploads, config);
+
+  rndr::MeshHandle   a = assets.loadMesh(writeTetrahedron("asset_budget_a.obj"));
+  pumpUntilSettled(*context, assets, a);
+  REQUIRE(assets.isReady(a));
+
+  /* b does not fit while a is referenced */
+  rndr::MeshHandle b = assets.loadMesh(writeTetrahedron("asset_budget_b.obj"));
+  for (int i = 0; i < 10; ++i) {
+    context->processEvents();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  REQUIRE(assets.getState(b) == rndr::AssetManager::State::Loading);
+
+  assets.release(a);
+  pumpUntilSettled(*context, assets, b);
+  REQUIRE(assets.isReady(b));
+  REQUIRE(assets.getState(a) == rndr::AssetManager::State::Invalid);
+  REQUIRE(assets.getStats().evictions == 1);
+}
+
+TEST_CASE("Asset manager fails meshes larger than the budget", "[assets]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::JobSystem            jobs;
+  rndr::BufferAllocator      allocator(*context);
+  rndr::UploadRing           uploads(*context);
+  rndr::AssetManager::Config config;
+  config.budget_bytes = 100;
+  rndr::AssetManager    assets(*context, jobs, allocator, uploads, config);
+
+  /* two tetrahedra in one file, twice the budget */
+  std::filesystem::path large_path
+      = std::filesystem::temp_directory_path() / "asset_budget_large.obj";
+  {
+    std::ofstream ofs(large_path);
+    ofs << "v 1.0 0.0 1.0\nv 0.0 0.0 1.0\nv 1.0 1.0 1.0\nv 1.0 1.0 0.0\n"
+           "v 2.0 0.0 1.0\nv 1.0 0.0 1.0\nv 2.0 1.0 1.0\nv 2.0 1.0 0.0\n"
+           "f 1 2 3\nf 1 2 4\nf 2 3 4\nf 1 3 4\n"
+           "f 5 6 7\nf 5 6 8\nf 6 7 8\nf 5 7 8\n";
+  }
+
+  rndr::MeshHandle large = assets.loadMesh(large_path);
+  rndr::MeshHandle small
+      = assets.loadMesh(writeTetrahedron("asset_budget_small.obj"));
+
+  pumpUntilSettled(*context, assets, large);
+  REQUIRE(assets.getState(large) == rndr::AssetManager::State::Failed);
+  REQUIRE(!assets.getError(large).empty());
+
+  /* it does not hold up the meshes queued after it */
+  pumpUntilSettled(*context, assets, small);
+  REQUIRE(assets.isReady(small));
+  REQUIRE(assets.getStats().evictions == 0);
+}
+
+TEST_CASE("Asset manager uploads through a full ring without re-entering",
+          "[assets]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  /* a single chunk with room for two tetrahedra */
+  rndr::UploadRing::Config ring_config;
+  ring_config.chunk_size          = 256;
+  ring_config.dedicated_threshold = 128;
+  ring_config.max_chunks          = 1;
+
+  rndr::JobSystem       jobs;
+  rndr::BufferAllocator allocator(*context);
+  rndr::UploadRing      uploads(*context, ring_config);
+  rndr::AssetManager    assets(*context, jobs, allocator, uploads);
+
+  /* a callback that pumps events again must not nest another update */
+  size_t   nested = 0;
+  uint32_t id     = context->addEventCallback([&] {
+    ++nested;
+    context->processEvents();
+  });
+
+  std::vector<rndr::MeshHandle> handles;
+  for (int i = 0; i < 8; ++i) {
+    handles.push_back(assets.loadMesh(
+        writeTetrahedron("asset_ring_" + std::to_string(i) + ".obj")));
+  }
+
+  for (rndr::MeshHandle handle : handles) {
+    pumpUntilSettled(*context, assets, handle);
+    REQUIRE(assets.isReady(handle));
+    REQUIRE(assets.getMesh(handle)->getIndexCount() == 12);
+  }
+
+  REQUIRE(uploads.getStats().dedicated_uploads > 0);
+  REQUIRE(uploads.getStats().chunks_allocated == 1);
+  REQUIRE(nested > 0);
+  REQUIRE(assets.getStats().resident_bytes == 8 * (4 * 12 + 12 * 4));
+
+  context->removeEventCallback(id);
+}
@@ -0,0 +1,78 @@
+#include "rndr/assets/asset_table.h"
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct TestSlot {
+  int value = 0;
+};
+
+using TestTable = rndr::AssetTable<TestSlot, TestSlot, std::string>;
+
+static std::vector<TestTable::Finished> waitForLoads(TestTable &table,
+                                                     size_t     count)
+{
+  std::vector<TestTable::Finished> finished;
+  for (int i = 0; i < 1000 && finished.size() < count; ++i) {
+    for (auto &done : table.takeFinished()) {
+      finished.push_back(std::move(done));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return finished;
+}
+
+TEST_CASE("Asset table dedups paths and loads in the background", "[assets]")
+{
+  rndr::JobSystem jobs;
+  TestTable       table(jobs);
+
+  auto [a, created_a] = table.load("a.obj", [] { return std::string("a"); });
+  auto [again, created_again]
+      = table.load("a.obj", [] { return std::string("again"); });
+  auto [b, created_b] = table.load("b.obj", [] { return std::string("b"); });
+
+  REQUIRE(created_a);
+  REQUIRE(!created_again);
+  REQUIRE(created_b);
+  REQUIRE(again == a);
+  REQUIRE(table.size() == 2);
+  REQUIRE(table.getRefs(a.id) == 2);
+
+  auto finished = waitForLoads(table, 2);
+  REQUIRE(finished.size() == 2);
+  for (auto &[id, loaded] : finished) {
+    REQUIRE(loaded == (id == a.id ? "a" : "b"));
+  }
+}
+
+TEST_CASE("Asset table handles go stale once their slot is reused",
+          "[assets]")
+{
+  rndr::JobSystem jobs;
+  TestTable       table(jobs);
+
+  auto [a, created] = table.load("a.obj", [] { return std::string(); });
+  waitForLoads(table, 1);
+
+  table.get(a)->value = 7;
+  table.acquire(a);
+  REQUIRE(!table.release(a));
+  REQUIRE(table.release(a));
+  REQUIRE(table.get(a)->value == 7);
+
+  table.destroy(a.id);
+  REQUIRE(table.get(a) == nullptr);
+  REQUIRE(table.size() == 0);
+
+  /* the slot comes back with a new generation and a fresh `Slot` */
+  auto [b, created_b] = table.load("a.obj", [] { return std::string(); });
+  waitForLoads(table, 1);
+  REQUIRE(created_b);
+  REQUIRE(b.id == a.id);
+  REQUIRE(b != a);
+  REQUIRE(table.get(a) == nullptr);
+  REQUIRE(table.get(b)->value == 0);
+  REQUIRE(!table.release(a));
+}
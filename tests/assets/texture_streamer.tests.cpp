@@ -0,0 +1,204 @@
+#include "rndr/assets/texture_streamer.h"
+#include "rndr/context.h"
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+static std::filesystem::path writeCheckerboard(const std::string &name,
+                                               uint32_t           size)
+{
+  std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+  std::ofstream         ofs(path, std::ios::binary);
+  ofs << "P6\n" << size << " " << size << "\n255\n";
+  for (uint32_t y = 0; y < size; ++y) {
+    for (uint32_t x = 0; x < size; ++x) {
+      char value = ((x / 8 + y / 8) % 2) ? char(255) : char(0);
+      ofs << value << value << value;
+    }
+  }
+  return path;
+}
+
+static void pumpUntil(rndr::Context &context, std::function<bool()> done)
+{
+  for (int i = 0; i < 1000 && !done(); ++i) {
+    context.processEvents();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+/* 256 x 256 RGBA8 levels from `level` down to 1 x 1 */
+static uint64_t chainBytes(uint32_t level)
+{
+  uint64_t bytes = 0;
+  for (uint32_t size = 256 >> level; size > 0; size /= 2) {
+    bytes += uint64_t{size} * size * 4;
+  }
+  return bytes;
+}
+
+TEST_CASE("Texture streamer picks mip levels by screen size", "[assets]")
+{
+  REQUIRE(rndr::TextureStreamer::levelFor(256, 256, 256.f) == 0);
+  REQUIRE(rndr::TextureStreamer::levelFor(256, 256, 512.f) == 0);
+  REQUIRE(rndr::TextureStreamer::levelFor(256, 256, 128.f) == 1);
+  REQUIRE(rndr::TextureStreamer::levelFor(256, 256, 100.f) == 1);
+  REQUIRE(rndr::TextureStreamer::levelFor(256, 64, 4.f) == 6);
+  REQUIRE(rndr::TextureStreamer::levelFor(256, 256, 0.f) == 8);
+  REQUIRE(rndr::TextureStreamer::levelFor(256, 256, 0.01f) == 8);
+}
+
+TEST_CASE("Texture streamer loads the tail first, then pages in on request",
+          "[assets]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::JobSystem               jobs;
+  rndr::UploadRing              uploads(*context);
+  rndr::TextureStreamer::Config config;
+  config.tail_size = 32;
+  rndr::TextureStreamer streamer(*context, jobs, uploads, config);
+
+  auto                  path   = writeCheckerboard("streamer_tail.ppm", 256);
+  rndr::TextureHandle   handle = streamer.load(path);
+  rndr::TextureHandle   again  = streamer.load(path);
+  REQUIRE(handle == again);
+  REQUIRE(streamer.getStats().dedup_hits == 1);
+
+  pumpUntil(*context, [&] {
+    return streamer.getState(handle) != rndr::TextureStreamer::State::Loading;
+  });
+  REQUIRE(streamer.getState(handle) == rndr::TextureStreamer::State::Resident);
+  REQUIRE(streamer.getView(handle) != nullptr);
+  REQUIRE(streamer.getLevelCount(handle) == 9);
+  /* 32 x 32 and smaller */
+  REQUIRE(streamer.getResidentLevel(handle) == 3);
+  REQUIRE(streamer.getStats().resident_bytes == chainBytes(3));
+
+  pumpUntil(*context, [&] {
+    streamer.request(handle, 256.f);
+    return streamer.getResidentLevel(handle) == 0;
+  });
+  REQUIRE(streamer.getResidentLevel(handle) == 0);
+  REQUIRE(streamer.getStats().levels_paged_in == 9);
+  REQUIRE(streamer.getStats().resident_bytes == chainBytes(0));
+
+  rndr::TextureHandle missing = streamer.load("does_not_exist.ppm");
+  pumpUntil(*context, [&] {
+    return streamer.getState(missing) != rndr::TextureStreamer::State::Loading;
+  });
+  REQUIRE(streamer.getState(missing) == rndr::TextureStreamer::State::Failed);
+  REQUIRE(!streamer.getError(missing).empty());
+
+  streamer.release(missing);
+  REQUIRE(streamer.getState(missing) == rndr::TextureStreamer::State::Invalid);
+}
+
+TEST_CASE("Texture streamer pages out idle textures over budget", "[assets]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::JobSystem               jobs;
+  rndr::UploadRing              uploads(*context);
+  rndr::TextureStreamer::Config config;
+  config.tail_size    = 32;
+  config.idle_updates = 2;
+  /* one full chain and one tail */
+  config.budget_bytes = chainBytes(0) + chainBytes(3);
+  rndr::TextureStreamer streamer(*context, jobs, uploads, config);
+
+  rndr::TextureHandle   a
+      = streamer.load(writeCheckerboard("streamer_budget_a.ppm", 256));
+  rndr::TextureHandle b
+      = streamer.load(writeCheckerboard("streamer_budget_b.ppm", 256));
+
+  pumpUntil(*context, [&] {
+    streamer.request(a, 256.f);
+    return streamer.getState(a) == rndr::TextureStreamer::State::Resident
+           && streamer.getState(b) == rndr::TextureStreamer::State::Resident
+           && streamer.getResidentLevel(a) == 0;
+  });
+  REQUIRE(streamer.getResidentLevel(a) == 0);
+  REQUIRE(streamer.getResidentLevel(b) == 3);
+
+  /* b only gets sharper once a has gone idle and is paged back to its tail */
+  pumpUntil(*context, [&] {
+    streamer.request(b, 256.f);
+    return streamer.getResidentLevel(b) == 0;
+  });
+  REQUIRE(streamer.getResidentLevel(b) == 0);
+  REQUIRE(streamer.getResidentLevel(a) == 3);
+  REQUIRE(streamer.getStats().levels_paged_out == 3);
+  REQUIRE(streamer.getStats().resident_bytes <= config.budget_bytes);
+  REQUIRE(streamer.getStats().peak_bytes <= config.budget_bytes);
+
+  /* unreferenced textures are evicted outright */
+  streamer.release(a);
+  streamer.release(b);
+  rndr::TextureHandle c
+      = streamer.load(writeCheckerboard("streamer_budget_c.ppm", 256));
+  pumpUntil(*context, [&] {
+    streamer.request(c, 256.f);
+    return streamer.getState(c) == rndr::TextureStreamer::State::Resident
+           && streamer.getResidentLevel(c) == 0;
+  });
+  REQUIRE(streamer.getResidentLevel(c) == 0);
+  REQUIRE(streamer.getStats().evictions >= 1);
+  REQUIRE(streamer.getState(b) == rndr::TextureStreamer::State::Invalid);
+}
+
+TEST_CASE("Texture streamer evicts nothing when it cannot make enough room",
+          "[assets]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::JobSystem               jobs;
+  rndr::UploadRing              uploads(*context);
+  rndr::TextureStreamer::Config config;
+  config.tail_size    = 32;
+  config.idle_updates = 1000;
+  /* one full chain and two tails */
+  config.budget_bytes = chainBytes(0) + 2 * chainBytes(3);
+  rndr::TextureStreamer streamer(*context, jobs, uploads, config);
+
+  /* an unreferenced tail, cached */
+  rndr::TextureHandle   unused
+      = streamer.load(writeCheckerboard("streamer_room_unused.ppm", 256));
+  pumpUntil(*context, [&] {
+    return streamer.getState(unused)
+           == rndr::TextureStreamer::State::Resident;
+  });
+  streamer.release(unused);
+
+  rndr::TextureHandle a
+      = streamer.load(writeCheckerboard("streamer_room_a.ppm", 256));
+  pumpUntil(*context, [&] {
+    streamer.request(a, 256.f);
+    return streamer.getResidentLevel(a) == 0
+           && streamer.getState(a) == rndr::TextureStreamer::State::Resident;
+  });
+
+  /* b's next level needs more than the cached tail would free */
+  rndr::TextureHandle b
+      = streamer.load(writeCheckerboard("streamer_room_b.ppm", 256));
+  for (int i = 0; i < 20; ++i) {
+    streamer.request(a, 256.f);
+    streamer.request(b, 256.f);
+    context->processEvents();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  REQUIRE(streamer.getState(b) == rndr::TextureStreamer::State::Resident);
+  REQUIRE(streamer.getResidentLevel(b) == 3);
+  REQUIRE(streamer.getResidentLevel(a) == 0);
+  REQUIRE(streamer.getState(unused)
+          == rndr::TextureStreamer::State::Resident);
+  REQUIRE(streamer.getStats().evictions == 0);
+}
@@ -0,0 +1,362 @@
+#include "helpers/readback.h"
+#include "rndr/compute/compute_batch.h"
+#include "rndr/compute/compute_kernel.h"
+#include "rndr/compute/storage_buffer.h"
+#include "rndr/context.h"
+#include "rndr/math/matrix.h"
+#include "rndr/memory/upload_ring.h"
+#include "rndr/resources/resource_cache.h"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+static const char *scan_source = R"(
+override WORKGROUP_SIZE_X: u32 = 64;
+
+@group(0) @binding(0) var<storage, read_write> data: array<u32>;
+@group(0) @binding(1) var<storage, read_write> sums: array<u32>;
+
+var<workgroup> tile: array<u32, WORKGROUP_SIZE_X>;
+
+fn load(i: u32, local: u32) {
+  var value = 0u;
+  if (i < arrayLength(&data)) {
+    value = data[i];
+  }
+  tile[local] = value;
+  workgroupBarrier();
+}
+
+/* inclusive scan of each block, whose total goes to `sums` */
+@compute @workgroup_size(WORKGROUP_SIZE_X)
+fn scan(@builtin(global_invocation_id) global: vec3u,
+        @builtin(local_invocation_id) local: vec3u,
+        @builtin(workgroup_id) group: vec3u) {
+  load(global.x, local.x);
+
+  for (var offset = 1u; offset < WORKGROUP_SIZE_X; offset = offset * 2u) {
+    var add = 0u;
+    if (local.x >= offset) {
+      add = tile[local.x - offset];
+    }
+    workgroupBarrier();
+    tile[local.x] = tile[local.x] + add;
+    workgroupBarrier();
+  }
+
+  if (global.x < arrayLength(&data)) {
+    data[global.x] = tile[local.x];
+  }
+  if (local.x == WORKGROUP_SIZE_X - 1u) {
+    sums[group.x] = tile[local.x];
+  }
+}
+
+/* add the scanned totals of the preceding blocks */
+@compute @workgroup_size(WORKGROUP_SIZE_X)
+fn add_offsets(@builtin(global_invocation_id) global: vec3u,
+               @builtin(workgroup_id) group: vec3u) {
+  if (group.x > 0u && global.x < arrayLength(&data)) {
+    data[global.x] = data[global.x] + sums[group.x - 1u];
+  }
+}
+
+/* sum of each block, which goes to `sums` */
+@compute @workgroup_size(WORKGROUP_SIZE_X)
+fn reduce(@builtin(global_invocation_id) global: vec3u,
+          @builtin(local_invocation_id) local: vec3u,
+          @builtin(workgroup_id) group: vec3u) {
+  load(global.x, local.x);
+
+  for (var stride = WORKGROUP_SIZE_X / 2u; stride > 0u; stride = stride / 2u) {
+    if (local.x < stride) {
+      tile[local.x] = tile[local.x] + tile[local.x + stride];
+    }
+    workgroupBarrier();
+  }
+
+  if (local.x == 0u) {
+    sums[group.x] = tile[0];
+  }
+}
+)";
+
+/**
+ * Multi-level scans and reductions over `u32`s: level `k + 1` holds a total
+ * per block of level `k`, down to a single block.
+ */
+class PrefixSum {
+public:
+  using Buffer = rndr::StorageBuffer<uint32_t>;
+
+  PrefixSum(rndr::Context &context, rndr::ResourceCache &cache, size_t count,
+            uint32_t block)
+      : block_(block),
+        scan_(context, cache, config("scan")),
+        add_(context, cache, config("add_offsets")),
+        reduce_(context, cache, config("reduce"))
+  {
+    levels_.push_back(std::make_unique<Buffer>(context, count));
+    while (levels_.back()->size() > block) {
+      size_t blocks = (levels_.back()->size() + block - 1) / block;
+      levels_.push_back(std::make_unique<Buffer>(context, blocks));
+    }
+    levels_.push_back(std::make_unique<Buffer>(context, 1));
+  }
+
+  void initialize()
+  {
+    REQUIRE(scan_.initialize().ok());
+    REQUIRE(add_.initialize().ok());
+    REQUIRE(reduce_.initialize().ok());
+
+    for (size_t k = 0; k + 1 < levels_.size(); ++k) {
+      wgpu::BindGroupEntry entries[2]
+          = {levels_[k]->entry(0), levels_[k + 1]->entry(1)};
+      groups_.push_back(scan_.bind(entries));
+    }
+  }
+
+  Buffer &data()
+  {
+    return *levels_.front();
+  }
+
+  Buffer &total()
+  {
+    return *levels_.back();
+  }
+
+  void scan(rndr::ComputeBatch &batch)
+  {
+    for (size_t k = 0; k < groups_.size(); ++k) {
+      REQUIRE(batch.add(scan_, groups_[k], {invocations(k), 1, 1}).ok());
+    }
+    for (size_t k = groups_.size() - 1; k-- > 0;) {
+      REQUIRE(batch.add(add_, groups_[k], {invocations(k), 1, 1}).ok());
+    }
+  }
+
+  void reduce(rndr::ComputeBatch &batch)
+  {
+    for (size_t k = 0; k < groups_.size(); ++k) {
+      REQUIRE(batch.add(reduce_, groups_[k], {invocations(k), 1, 1}).ok());
+    }
+  }
+
+private:
+  rndr::ComputeKernel::Config config(const char *entry_point) const
+  {
+    return {.source         = scan_source,
+            .entry_point    = entry_point,
+            .workgroup_size = {block_, 1, 1},
+            .entries        = {Buffer::layoutEntry(0, false),
+                               Buffer::layoutEntry(1, false)}};
+  }
+
+  /* every block of level `k` runs, including its padding */
+  uint32_t invocations(size_t k) const
+  {
+    return static_cast<uint32_t>(levels_[k]->size());
+  }
+
+  const uint32_t                       block_;
+  rndr::ComputeKernel                  scan_;
+  rndr::ComputeKernel                  add_;
+  rndr::ComputeKernel                  reduce_;
+  std::vector<std::unique_ptr<Buffer>> levels_ = {};
+  std::vector<wgpu::BindGroup>         groups_ = {};
+};
+
+static std::vector<uint32_t> sequence(size_t count)
+{
+  std::vector<uint32_t> values(count);
+  for (size_t i = 0; i < count; ++i) {
+    values[i] = static_cast<uint32_t>(i * 7 % 13);
+  }
+  return values;
+}
+
+TEST_CASE("Storage buffers bind arrays of tensors", "[compute]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  context->setForceFallbackAdapter(true);
+  REQUIRE(context->initialize().ok());
+
+  rndr::ResourceCache cache(*context);
+  rndr::UploadRing    uploads(*context);
+
+  using Transforms = rndr::StorageBuffer<rndr::math::matrix<4, 4>>;
+  using Points     = rndr::StorageBuffer<rndr::math::vec4>;
+
+  rndr::ComputeKernel kernel(*context, cache,
+                             {.source = R"(
+@group(0) @binding(0) var<storage, read> transforms: array<mat4x4f>;
+@group(0) @binding(1) var<storage, read> points: array<vec4f>;
+@group(0) @binding(2) var<storage, read_write> result: array<vec4f>;
+
+@compute @workgroup_size(64)
+fn main(@builtin(global_invocation_id) id: vec3u) {
+  if (id.x < arrayLength(&result)) {
+    result[id.x] = transforms[id.x] * points[id.x];
+  }
+}
+)",
+                              .entries = {Transforms::layoutEntry(0, true),
+                                          Points::layoutEntry(1, true),
+                                          Points::layoutEntry(2, false)}});
+  REQUIRE(kernel.initialize().ok());
+
+  constexpr size_t                      count = 100;
+  Transforms                            transforms(*context, count);
+  Points                                points(*context, count);
+  Points                                result(*context, count);
+
+  std::vector<rndr::math::matrix<4, 4>> transform_data(count);
+  std::vector<rndr::math::vec4>         point_data(count);
+  for (size_t i = 0; i < count; ++i) {
+    transform_data[i]          = rndr::math::matrix<4, 4>::identity<4>();
+    transform_data[i].at(3, 0) = float(i);
+    transform_data[i].at(3, 1) = float(2 * i);
+    point_data[i]              = rndr::math::vec4({1.f, 1.f, float(i), 1.f});
+  }
+  REQUIRE(transforms.upload(uploads, transform_data).ok());
+  REQUIRE(points.upload(uploads, point_data).ok());
+  REQUIRE(!points.upload(uploads, point_data, 1).ok());
+  REQUIRE(uploads.submit().ok());
+
+  wgpu::BindGroupEntry entries[3]
+      = {transforms.entry(0), points.entry(1), result.entry(2)};
+  wgpu::BindGroup    group = kernel.bind(entries);
+
+  rndr::ComputeBatch batch(*context);
+  REQUIRE(batch.add(kernel, group, {count, 1, 1}).ok());
+  batch.submit();
+
+  auto values = test_helpers::readBack<rndr::math::vec4>(
+      *context, result.getBuffer(), count);
+  for (size_t i = 0; i < count; ++i) {
+    auto v = values[i].get_data();
+    REQUIRE(v[0] == float(i + 1));
+    REQUIRE(v[1] == float(2 * i + 1));
+    REQUIRE(v[2] == float(i));
+    REQUIRE(v[3] == 1.f);
+  }
+}
+
+TEST_CASE("Compute kernels reject workgroups beyond the device's limits",
+          "[compute]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  context->setForceFallbackAdapter(true);
+  REQUIRE(context->initialize().ok());
+
+  rndr::ResourceCache cache(*context);
+  uint32_t too_large = context->getLimits().maxComputeWorkgroupSizeX + 1;
+
+  rndr::ComputeKernel kernel(*context, cache,
+                             {.source         = scan_source,
+                              .entry_point    = "scan",
+                              .workgroup_size = {too_large, 1, 1}});
+  REQUIRE(!kernel.initialize().ok());
+
+  rndr::ComputeKernel empty(*context, cache, {});
+  REQUIRE(!empty.initialize().ok());
+}
+
+TEST_CASE("Batched scans and reductions match the CPU", "[compute]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  context->setForceFallbackAdapter(true);
+  REQUIRE(context->initialize().ok());
+
+  rndr::ResourceCache cache(*context);
+  rndr::UploadRing    uploads(*context);
+  rndr::ComputeBatch  batch(*context);
+
+  /* one, two and three levels of blocks, with partial blocks at the end */
+  for (size_t count : {size_t{50}, size_t{3000}, size_t{70000}}) {
+    std::vector<uint32_t> values = sequence(count);
+
+    PrefixSum             sum(*context, cache, count, 64);
+    sum.initialize();
+    REQUIRE(sum.data().upload(uploads, values).ok());
+    REQUIRE(uploads.submit().ok());
+
+    sum.reduce(batch);
+    batch.submit();
+    auto total = test_helpers::readBack<uint32_t>(
+        *context, sum.total().getBuffer(), 1);
+    REQUIRE(total[0] == std::accumulate(values.begin(), values.end(), 0u));
+
+    batch.resetStats();
+    sum.scan(batch);
+    batch.submit();
+    REQUIRE(batch.getStats().passes == 1);
+    REQUIRE(batch.getStats().submits == 1);
+
+    std::vector<uint32_t> expected(count);
+    std::inclusive_scan(values.begin(), values.end(), expected.begin());
+    REQUIRE(test_helpers::readBack<uint32_t>(*context, sum.data().getBuffer(),
+                                             count)
+            == expected);
+  }
+
+  /* kernels of the same source, entry point and layout share a pipeline */
+  REQUIRE(cache.getStats().pipelines == 3);
+}
+
+TEST_CASE("GPU scan and reduction against the CPU", "[.][benchmark]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  context->setForceFallbackAdapter(true);
+  REQUIRE(context->initialize().ok());
+
+  rndr::ResourceCache cache(*context);
+  rndr::UploadRing    uploads(*context);
+  rndr::ComputeBatch  batch(*context);
+
+  uint32_t            block
+      = std::min<uint32_t>(256, context->getLimits().maxComputeWorkgroupSizeX);
+
+  for (size_t count : {size_t{1} << 16, size_t{1} << 20}) {
+    std::vector<uint32_t> values = sequence(count);
+    std::vector<uint32_t> scanned(count);
+
+    PrefixSum             sum(*context, cache, count, block);
+    sum.initialize();
+    REQUIRE(sum.data().upload(uploads, values).ok());
+    REQUIRE(uploads.submit().ok());
+
+    std::string suffix = std::to_string(count) + " values";
+
+    BENCHMARK("GPU reduction, " + suffix)
+    {
+      sum.reduce(batch);
+      batch.submit();
+      context->blockOnSubmittedWork();
+    };
+
+    BENCHMARK("CPU reduction, " + suffix)
+    {
+      return std::accumulate(values.begin(), values.end(), 0u);
+    };
+
+    BENCHMARK("GPU scan, " + suffix)
+    {
+      sum.scan(batch);
+      batch.submit();
+      context->blockOnSubmittedWork();
+    };
+
+    BENCHMARK("CPU scan, " + suffix)
+    {
+      std::inclusive_scan(values.begin(), values.end(), scanned.begin());
+      return scanned.back();
+    };
+  }
+}
@@ -0,0 +1,23 @@
+#include "rndr/utils/helpers.h"
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Override constants are matched as whole identifiers", "[compute]")
+{
+  const char *source = "override size_xy: u32 = 1u;\n"
+                       "override fog_enabled: bool = false;\n"
+                       "override shadows: bool;\n";
+
+  REQUIRE(rndr::helpers::declares_override(source, "size_xy"));
+  REQUIRE(rndr::helpers::declares_override(source, "fog_enabled"));
+  REQUIRE(rndr::helpers::declares_override(source, "shadows"));
+
+  /* prefixes of a declared name are not declarations themselves */
+  REQUIRE(!rndr::helpers::declares_override(source, "size_x"));
+  REQUIRE(!rndr::helpers::declares_override(source, "fog"));
+  REQUIRE(!rndr::helpers::declares_override(source, "shadow"));
+
+  /* a later whole match is found past an earlier partial one */
+  REQUIRE(rndr::helpers::declares_override(
+      "override size_xy: u32;\noverride size_x: u32;", "size_x"));
+  REQUIRE(rndr::helpers::declares_override("override size_x", "size_x"));
+}
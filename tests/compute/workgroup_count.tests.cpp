@@ -0,0 +1,54 @@
+#include "rndr/utils/helpers.h"
+#include <catch2/catch_test_macros.hpp>
+
+static wgpu::Limits computeLimits()
+{
+  wgpu::Limits limits                      = {};
+  limits.maxComputeWorkgroupSizeX          = 256;
+  limits.maxComputeWorkgroupSizeY          = 256;
+  limits.maxComputeWorkgroupSizeZ          = 64;
+  limits.maxComputeInvocationsPerWorkgroup = 256;
+  limits.maxComputeWorkgroupsPerDimension  = 65535;
+  return limits;
+}
+
+TEST_CASE("Workgroup sizes are checked against the device's limits", "[compute]")
+{
+  wgpu::Limits limits = computeLimits();
+
+  REQUIRE(rndr::helpers::workgroup_size_supported({256, 1, 1}, limits));
+  REQUIRE(rndr::helpers::workgroup_size_supported({16, 16, 1}, limits));
+  REQUIRE(rndr::helpers::workgroup_size_supported({1, 1, 64}, limits));
+
+  REQUIRE(!rndr::helpers::workgroup_size_supported({512, 1, 1}, limits));
+  REQUIRE(!rndr::helpers::workgroup_size_supported({1, 1, 128}, limits));
+  /* each dimension fits, but not their product */
+  REQUIRE(!rndr::helpers::workgroup_size_supported({32, 32, 1}, limits));
+  REQUIRE(!rndr::helpers::workgroup_size_supported({0, 1, 1}, limits));
+}
+
+TEST_CASE("Workgroup counts cover every invocation", "[compute]")
+{
+  wgpu::Limits limits = computeLimits();
+
+  auto         count  = rndr::helpers::workgroup_count({1000, 1, 1}, {256, 1, 1},
+                                                       limits);
+  REQUIRE(count.ok());
+  REQUIRE((*count)[0] == 4);
+  REQUIRE((*count)[1] == 1);
+  REQUIRE((*count)[2] == 1);
+
+  count = rndr::helpers::workgroup_count({1024, 100, 1}, {16, 16, 1}, limits);
+  REQUIRE(count.ok());
+  REQUIRE((*count)[0] == 64);
+  REQUIRE((*count)[1] == 7);
+
+  count = rndr::helpers::workgroup_count({0, 1, 1}, {64, 1, 1}, limits);
+  REQUIRE(count.ok());
+  REQUIRE((*count)[0] == 0);
+
+  /* 65536 workgroups, one more than a dimension allows */
+  REQUIRE(!rndr::helpers::workgroup_count({65536 * 64, 1, 1}, {64, 1, 1}, limits)
+               .ok());
+  REQUIRE(!rndr::helpers::workgroup_count({64, 1, 1}, {512, 1, 1}, limits).ok());
+}
@@ -0,0 +1,33 @@
+#ifndef RNDR_TESTS_FIXTURES_H_
+#define RNDR_TESTS_FIXTURES_H_
+
+#include "rndr/math/matrix.h"
+#include "rndr/types/types.h"
+
+namespace test_helpers {
+
+/* four faces spanning `[0, scale]` along each axis */
+inline rndr::MeshData tetrahedron(float scale)
+{
+  return {{rndr::math::vec3({scale, 0, scale}), rndr::math::vec3({0, 0, scale}),
+           rndr::math::vec3({scale, scale, scale}),
+           rndr::math::vec3({scale, scale, 0})},
+          {rndr::math::zvec3({1, 2, 3}), rndr::math::zvec3({1, 2, 4}),
+           rndr::math::zvec3({2, 3, 4}), rndr::math::zvec3({1, 3, 4})}};
+}
+
+/* as the shaders read it: column 3 holds the translation, so a column-major
+ * mat4x4f finds x at element 12 */
+inline rndr::math::matrix<4, 4>
+translation(float x, float y = 0.f, float z = 0.f)
+{
+  auto transform     = rndr::math::matrix<4, 4>::identity<4>();
+  transform.at(3, 0) = x;
+  transform.at(3, 1) = y;
+  transform.at(3, 2) = z;
+  return transform;
+}
+
+} // namespace test_helpers
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef RNDR_TESTS_READBACK_H_
+#define RNDR_TESTS_READBACK_H_
+
+#include "rndr/context.h"
+
+#include <cstring>
+#include <vector>
+#include <webgpu/webgpu_cpp.h>
+
+namespace test_helpers {
+
+/* blocking copy of `src[offset, offset + count * sizeof(T))` back to the CPU */
+template <typename T>
+std::vector<T> readBack(rndr::Context      &context,
+                        const wgpu::Buffer &src,
+                        size_t              count,
+                        uint64_t            offset = 0)
+{
+  const wgpu::Device    &device      = context.getDevice();
+  const uint64_t         size        = count * sizeof(T);
+
+  wgpu::BufferDescriptor buffer_desc = {};
+  buffer_desc.usage = wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::MapRead;
+  buffer_desc.size  = size;
+  wgpu::Buffer         readback = device.CreateBuffer(&buffer_desc);
+
+  wgpu::CommandEncoder enc      = device.CreateCommandEncoder();
+  enc.CopyBufferToBuffer(src, offset, readback, 0, size);
+  wgpu::CommandBuffer cbuf = enc.Finish();
+  context.getQueue().Submit(1, &cbuf);
+
+  std::vector<T> out(count);
+  wgpu::Future   map_future = readback.MapAsync(
+      wgpu::MapMode::Read, 0, size, wgpu::CallbackMode::AllowProcessEvents,
+      [&](wgpu::MapAsyncStatus status, const char *message) {
+        if (status == wgpu::MapAsyncStatus::Success) {
+          std::memcpy(out.data(), readback.GetConstMappedRange(0, size), size);
+          readback.Unmap();
+        }
+      });
+  context.blockOnFuture(map_future);
+
+  return out;
+}
+
+} // namespace test_helpers
+
+#endif
@@ -0,0 +1,184 @@
+#include "rndr/jobs/job_system.h"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace rndr;
+
+TEST_CASE("Job system runs every job before the counter clears", "[jobs]")
+{
+  JobSystem::Config config;
+  config.worker_count = 4;
+  JobSystem          jobs(config);
+
+  std::atomic<int>   sum = 0;
+  JobSystem::Counter counter;
+  for (int i = 1; i <= 1000; ++i) {
+    jobs.run([&sum, i] { sum.fetch_add(i); }, &counter);
+  }
+  jobs.wait(counter);
+
+  REQUIRE(counter.done());
+  REQUIRE(sum.load() == 500500);
+  REQUIRE(jobs.getStats().jobs_executed == 1000);
+}
+
+TEST_CASE("Job system parent counters wait on child jobs", "[jobs]")
+{
+  JobSystem::Config config;
+  config.worker_count = 3;
+  JobSystem          jobs(config);
+
+  std::atomic<int>   leaves = 0;
+  JobSystem::Counter counter;
+  for (int parent = 0; parent < 16; ++parent) {
+    jobs.run(
+        [&] {
+          for (int child = 0; child < 16; ++child) {
+            jobs.run([&] { leaves.fetch_add(1); }, &counter);
+          }
+        },
+        &counter);
+  }
+  jobs.wait(counter);
+
+  REQUIRE(leaves.load() == 256);
+}
+
+TEST_CASE("Job system parallel for covers the range once", "[jobs]")
+{
+  JobSystem::Config config;
+  config.worker_count = 4;
+  JobSystem        jobs(config);
+
+  std::vector<int> values(100003, 0);
+  jobs.parallelFor(0, values.size(), 1000, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      values[i] += static_cast<int>(i % 7);
+    }
+  });
+
+  int expected = 0;
+  for (size_t i = 0; i < values.size(); ++i) {
+    expected += i % 7;
+  }
+  REQUIRE(std::accumulate(values.begin(), values.end(), 0) == expected);
+}
+
+TEST_CASE("Job system runs main thread jobs on the main thread", "[jobs]")
+{
+  JobSystem::Config config;
+  config.worker_count = 2;
+  JobSystem          jobs(config);
+
+  std::thread::id    ran_on;
+  JobSystem::Counter counter;
+  jobs.run(
+      [&] {
+        jobs.runOnMainThread([&] { ran_on = std::this_thread::get_id(); },
+                             &counter);
+      },
+      &counter);
+
+  /* waiting from the main thread drains its queue */
+  jobs.wait(counter);
+  REQUIRE(ran_on == std::this_thread::get_id());
+  REQUIRE(jobs.getStats().main_thread_jobs == 1);
+}
+
+TEST_CASE("Job system without workers runs jobs inline", "[jobs]")
+{
+  JobSystem::Config config;
+  config.worker_count = 0;
+  config.cpu_affinity = {0};
+  JobSystem jobs(config);
+
+  if (jobs.getWorkerCount() == 0) {
+    int                calls = 0;
+    JobSystem::Counter counter;
+    jobs.run([&] { ++calls; }, &counter);
+    REQUIRE(calls == 1);
+    REQUIRE(counter.done());
+  }
+}
+
+TEST_CASE("Job system throughput", "[.][benchmark]")
+{
+  constexpr size_t job_count = 100000;
+  JobSystem        jobs;
+
+  BENCHMARK("100k empty jobs")
+  {
+    JobSystem::Counter counter;
+    for (size_t i = 0; i < job_count; ++i) {
+      jobs.run([] {}, &counter);
+    }
+    jobs.wait(counter);
+  };
+
+  BENCHMARK("100k empty jobs spawned from a job")
+  {
+    JobSystem::Counter counter;
+    jobs.run(
+        [&] {
+          for (size_t i = 0; i < job_count; ++i) {
+            jobs.run([] {}, &counter);
+          }
+        },
+        &counter);
+    jobs.wait(counter);
+  };
+
+  std::vector<float> values(1 << 22, 1.f);
+  BENCHMARK("parallel for over 4M floats")
+  {
+    std::atomic<int> chunks = 0;
+    jobs.parallelFor(0, values.size(), 1 << 14, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        values[i] = values[i] * 1.0001f + 0.5f;
+      }
+      chunks.fetch_add(1, std::memory_order_relaxed);
+    });
+    return chunks.load();
+  };
+
+  BENCHMARK("serial loop over 4M floats")
+  {
+    for (float &value : values) {
+      value = value * 1.0001f + 0.5f;
+    }
+    return values.back();
+  };
+}
+
+TEST_CASE("Job system idle cost", "[.][benchmark]")
+{
+  auto busy_work = [] {
+    volatile uint64_t acc = 0;
+    for (uint64_t i = 0; i < 1000000; ++i) {
+      acc = acc + i;
+    }
+    return acc;
+  };
+
+  BENCHMARK("main thread work, no job system")
+  {
+    return busy_work();
+  };
+
+  JobSystem jobs;
+  BENCHMARK("main thread work, idle job system")
+  {
+    return busy_work();
+  };
+
+  BENCHMARK("wake idle workers for one job")
+  {
+    JobSystem::Counter counter;
+    jobs.run([] {}, &counter);
+    jobs.wait(counter);
+  };
+}
@@ -0,0 +1,77 @@
+#include "rndr/jobs/triple_buffer.h"
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace rndr;
+
+TEST_CASE("Triple buffer hands over the latest value", "[jobs]")
+{
+  TripleBuffer<int> buffer;
+  REQUIRE(!buffer.acquire());
+
+  buffer.write() = 1;
+  REQUIRE(!buffer.publish());
+  REQUIRE(buffer.acquire());
+  REQUIRE(buffer.read() == 1);
+  REQUIRE(!buffer.acquire());
+  REQUIRE(buffer.read() == 1);
+
+  /* 2 is published over before it is taken */
+  buffer.write() = 2;
+  REQUIRE(!buffer.publish());
+  buffer.write() = 3;
+  REQUIRE(buffer.publish());
+  REQUIRE(buffer.acquire());
+  REQUIRE(buffer.read() == 3);
+}
+
+TEST_CASE("Triple buffer never tears or goes back in time", "[jobs]")
+{
+  struct Frame {
+    uint64_t              sequence = 0;
+    std::vector<uint64_t> payload  = {};
+  };
+
+  constexpr uint64_t  frame_count = 100000;
+  TripleBuffer<Frame> buffer;
+  std::atomic<bool>   done = false;
+
+  std::thread         producer([&] {
+    for (uint64_t i = 1; i <= frame_count; ++i) {
+      Frame &frame   = buffer.write();
+      frame.sequence = i;
+      frame.payload.assign(16, i);
+      buffer.publish();
+    }
+    done.store(true);
+  });
+
+  uint64_t last     = 0;
+  bool     torn     = false;
+  bool     backward = false;
+  while (true) {
+    /* read before acquiring, so that the final value is still taken */
+    bool finished = done.load();
+    if (!buffer.acquire()) {
+      if (finished) {
+        break;
+      }
+      continue;
+    }
+
+    const Frame &frame = buffer.read();
+    backward           = backward || frame.sequence <= last;
+    for (uint64_t value : frame.payload) {
+      torn = torn || value != frame.sequence;
+    }
+    last = frame.sequence;
+  }
+  producer.join();
+
+  REQUIRE(!torn);
+  REQUIRE(!backward);
+  /* the last value published is never lost */
+  REQUIRE(last == frame_count);
+}
@@ -0,0 +1,67 @@
+#include "rndr/jobs/work_stealing_deque.h"
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace rndr;
+
+TEST_CASE("Work-stealing deque pops newest and steals oldest", "[jobs]")
+{
+  WorkStealingDeque<int> deque(4);
+  REQUIRE(deque.push(1));
+  REQUIRE(deque.push(2));
+  REQUIRE(deque.push(3));
+  REQUIRE(deque.push(4));
+  REQUIRE(!deque.push(5));
+
+  REQUIRE(deque.steal() == 1);
+  REQUIRE(deque.pop() == 4);
+  REQUIRE(deque.size() == 2);
+  REQUIRE(deque.steal() == 2);
+  REQUIRE(deque.pop() == 3);
+  REQUIRE(!deque.pop());
+  REQUIRE(!deque.steal());
+}
+
+TEST_CASE("Work-stealing deque hands every item out exactly once", "[jobs]")
+{
+  constexpr int            item_count  = 200000;
+  constexpr int            thief_count = 3;
+
+  WorkStealingDeque<int>   deque(1024);
+  std::vector<std::atomic<int>> seen(item_count);
+  std::atomic<bool>        done = false;
+
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < thief_count; ++t) {
+    thieves.emplace_back([&] {
+      while (!done.load()) {
+        if (auto item = deque.steal()) {
+          seen[*item].fetch_add(1);
+        }
+      }
+    });
+  }
+
+  for (int i = 0; i < item_count;) {
+    if (deque.push(i)) {
+      ++i;
+    }
+    else if (auto item = deque.pop()) {
+      seen[*item].fetch_add(1);
+    }
+  }
+  while (auto item = deque.pop()) {
+    seen[*item].fetch_add(1);
+  }
+
+  done.store(true);
+  for (auto &thief : thieves) {
+    thief.join();
+  }
+
+  for (int i = 0; i < item_count; ++i) {
+    REQUIRE(seen[i].load() == 1);
+  }
+}
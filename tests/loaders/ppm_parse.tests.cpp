@@ -0,0 +1,62 @@
+#include "rndr/utils/ppm_parser.h"
+#include <catch2/catch_test_macros.hpp>
+#include <fstream>
+#include <string>
+
+using namespace rndr;
+
+TEST_CASE("test PPM parser")
+{
+  using namespace std::filesystem;
+
+  rndr::ImageData expected = {2,
+                              2,
+                              {255, 0, 0, 255, 0, 255, 0, 255, 0, 0, 255, 255,
+                               255, 255, 255, 255}};
+
+  path          plain = temp_directory_path() / "ppmtmp_plain.ppm";
+  std::ofstream ofs(plain);
+  ofs << "P3\n# a comment\n2 2\n255\n255 0 0  0 255 0\n0 0 255  255 255 255\n";
+  ofs.close();
+
+  auto image = rndr::parsePpmFile(plain);
+  REQUIRE(image.has_value());
+  REQUIRE(*image == expected);
+
+  path binary = temp_directory_path() / "ppmtmp_binary.ppm";
+  ofs.open(binary, std::ios::binary);
+  ofs << "P6 2 2 255\n";
+  ofs.write("\xff\x00\x00\x00\xff\x00\x00\x00\xff\xff\xff\xff", 12);
+  ofs.close();
+
+  image = rndr::parsePpmFile(binary);
+  REQUIRE(image.has_value());
+  REQUIRE(*image == expected);
+
+  /* samples are rescaled from smaller maximum values */
+  ofs.open(plain);
+  ofs << "P3 1 1 15 15 0 5";
+  ofs.close();
+  image = rndr::parsePpmFile(plain);
+  REQUIRE(image.has_value());
+  REQUIRE(image->pixels == std::vector<uint8_t>{255, 0, 85, 255});
+
+  /* truncated data */
+  ofs.open(binary, std::ios::binary);
+  ofs << "P6 2 2 255\n\xff\x00";
+  ofs.close();
+  REQUIRE(!rndr::parsePpmFile(binary).has_value());
+
+  /* dimensions the data cannot back, or no texture could have */
+  ofs.open(binary, std::ios::binary);
+  ofs << "P6 16000 16000 255\n\xff\x00\x00";
+  ofs.close();
+  REQUIRE(!rndr::parsePpmFile(binary).has_value());
+
+  ofs.open(plain);
+  ofs << "P3 100000 1 255 0 0 0";
+  ofs.close();
+  REQUIRE(!rndr::parsePpmFile(plain).has_value());
+
+  REQUIRE(!rndr::parsePpmFile(temp_directory_path() / "missing.ppm"));
+}
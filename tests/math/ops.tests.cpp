@@ -0,0 +1,59 @@
+#include "rndr/math/ops.h"
+#include <catch2/catch_test_macros.hpp>
+
+using namespace rndr;
+
+static math::matrix<4, 4> sequence(float first)
+{
+  math::matrix<4, 4> mat;
+  for (int i = 0; i < 16; ++i) {
+    mat.data()[i] = first + static_cast<float>(i);
+  }
+  return mat;
+}
+
+TEST_CASE("mat4 multiply matches the scalar reference", "[math]")
+{
+  math::matrix<4, 4> a = sequence(1.f);
+  math::matrix<4, 4> b = sequence(-7.f);
+
+  math::matrix<4, 4> reference;
+  math::multiply_mat4_scalar(a.data(), b.data(), reference.data());
+  REQUIRE(math::compose_column_major(a, b) == reference);
+
+  /* column-major storage is the transpose of `basic_tensor`'s row-major view,
+   * so its product `b * a` is stored like `a * b` column-major */
+  REQUIRE(reference == b * a);
+}
+
+TEST_CASE("mat4 multiply composes column-major transforms", "[math]")
+{
+  /* as the shaders read it: column 3 holds the translation */
+  auto translate      = math::matrix<4, 4>::identity<4>();
+  translate.at(3, 0)  = 2.f;
+  auto scale          = math::matrix<4, 4>::identity<4>();
+  scale.at(0, 0)      = 3.f;
+
+  /* scale first, then translate: the translation itself is not scaled */
+  math::matrix<4, 4> result = math::compose_column_major(translate, scale);
+  REQUIRE(result.at(0, 0) == 3.f);
+  REQUIRE(result.at(3, 0) == 2.f);
+
+  result = math::compose_column_major(scale, translate);
+  REQUIRE(result.at(3, 0) == 6.f);
+}
+
+TEST_CASE("mat4 multiply may write over its inputs", "[math]")
+{
+  math::matrix<4, 4> a        = sequence(1.f);
+  math::matrix<4, 4> b        = sequence(3.f);
+  math::matrix<4, 4> expected = math::compose_column_major(a, b);
+
+  math::matrix<4, 4> lhs      = a;
+  math::multiply_mat4(lhs.data(), b.data(), lhs.data());
+  REQUIRE(lhs == expected);
+
+  math::matrix<4, 4> rhs = b;
+  math::multiply_mat4(a.data(), rhs.data(), rhs.data());
+  REQUIRE(rhs == expected);
+}
@@ -0,0 +1,140 @@
+#include "helpers/readback.h"
+#include "rndr/context.h"
+#include "rndr/memory/buffer_allocator.h"
+#include "rndr/memory/upload_ring.h"
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+using namespace rndr;
+
+TEST_CASE("Buffer allocator shares blocks and aligns by class", "[memory]")
+{
+  auto context = std::make_unique<Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  BufferAllocator               allocator(*context);
+  std::vector<BufferAllocation> uniforms;
+
+  for (int i = 0; i < 1000; ++i) {
+    auto allocation = allocator.allocate(BufferClass::Uniform, 64);
+    REQUIRE(allocation.ok());
+    uniforms.push_back(*allocation);
+
+    BufferRange range = allocator.resolve(*allocation);
+    REQUIRE(range.offset
+                % context->getLimits().minUniformBufferOffsetAlignment
+            == 0);
+  }
+
+  REQUIRE(allocator.getStats(BufferClass::Uniform).block_count == 1);
+  REQUIRE(allocator.getStats(BufferClass::Uniform).allocation_count == 1000);
+
+  for (BufferAllocation allocation : uniforms) {
+    allocator.free(allocation);
+  }
+  REQUIRE(allocator.getStats(BufferClass::Uniform).used_bytes == 0);
+}
+
+TEST_CASE("Buffer allocator fits aligned ranges as large as a block",
+          "[memory]")
+{
+  auto context = std::make_unique<Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  BufferAllocator::Config config;
+  config.block_size = 1 << 16;
+  BufferAllocator allocator(*context, config);
+
+  /* the first range takes the shared block, so the next ones need their own */
+  auto            first = allocator.allocate(BufferClass::Uniform, 64);
+  REQUIRE(first.ok());
+
+  for (uint64_t alignment : {4, 256, 4096}) {
+    auto allocation
+        = allocator.allocate(BufferClass::Uniform, config.block_size, alignment);
+    REQUIRE(allocation.ok());
+    REQUIRE(allocator.resolve(*allocation).offset % alignment == 0);
+    REQUIRE(allocator.resolve(*allocation).size == config.block_size);
+  }
+
+  auto too_large = allocator.allocate(BufferClass::Storage,
+                                      context->getLimits().maxBufferSize, 256);
+  REQUIRE(!too_large.ok());
+}
+
+TEST_CASE("Buffer allocator ignores stale allocations", "[memory]")
+{
+  auto context = std::make_unique<Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  BufferAllocator allocator(*context);
+
+  auto            first = allocator.allocate(BufferClass::Vertex, 64);
+  REQUIRE(first.ok());
+  allocator.free(*first);
+  REQUIRE(!allocator.isLive(*first));
+
+  /* the second allocation reuses the slot of the first */
+  auto second = allocator.allocate(BufferClass::Vertex, 128);
+  REQUIRE(second.ok());
+  REQUIRE((*second).id == (*first).id);
+  REQUIRE(allocator.isLive(*second));
+
+  REQUIRE(allocator.resolve(*first).buffer == nullptr);
+  allocator.free(*first);
+  REQUIRE(allocator.isLive(*second));
+  REQUIRE(allocator.resolve(*second).size == 128);
+  REQUIRE(allocator.getStats(BufferClass::Vertex).allocation_count == 1);
+}
+
+TEST_CASE("Buffer allocator defragmentation preserves contents", "[memory]")
+{
+  auto context = std::make_unique<Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  BufferAllocator::Config config;
+  config.block_size = 1 << 16;
+  BufferAllocator               allocator(*context, config);
+  UploadRing                    uploads(*context);
+
+  constexpr size_t              count = 256;
+  std::vector<BufferAllocation> allocations;
+  for (uint32_t i = 0; i < count; ++i) {
+    auto allocation = allocator.allocate(BufferClass::Storage, 256);
+    REQUIRE(allocation.ok());
+    allocations.push_back(*allocation);
+
+    std::vector<uint32_t> data(64, i);
+    BufferRange           range = allocator.resolve(*allocation);
+    REQUIRE(uploads.write(range.buffer, range.offset,
+                          std::span<const uint32_t>(data))
+                .ok());
+  }
+  REQUIRE(uploads.submit().ok());
+
+  /* punch holes in every other allocation */
+  for (size_t i = 0; i < count; i += 2) {
+    allocator.free(allocations[i]);
+  }
+  REQUIRE(allocator.getStats(BufferClass::Storage).fragmentation > 0.25f);
+
+  size_t               pending = context->getPendingDestroyCount();
+  wgpu::CommandEncoder encoder = context->getDevice().CreateCommandEncoder();
+  REQUIRE(allocator.defragment(encoder) == count / 2 * 256);
+  wgpu::CommandBuffer commands = encoder.Finish();
+  context->getQueue().Submit(1, &commands);
+
+  REQUIRE(allocator.getGeneration() == 1);
+  /* the old blocks go through the deferred destruction path */
+  REQUIRE(context->getPendingDestroyCount() > pending);
+  REQUIRE(allocator.getStats(BufferClass::Storage).fragmentation < 0.25f);
+
+  for (uint32_t i = 1; i < count; i += 2) {
+    BufferRange range = allocator.resolve(allocations[i]);
+    auto        data  = test_helpers::readBack<uint32_t>(*context, range.buffer,
+                                                         64, range.offset);
+    REQUIRE(data == std::vector<uint32_t>(64, i));
+  }
+}
@@ -0,0 +1,134 @@
+#include "rndr/memory/memory_tracker.h"
+#include <catch2/catch_test_macros.hpp>
+#include <utility>
+#include <vector>
+
+using rndr::MemoryCategory;
+using rndr::MemoryTracker;
+
+TEST_CASE("Memory tracker counts live and peak bytes per category", "[memory]")
+{
+  MemoryTracker tracker;
+
+  {
+    auto mesh    = tracker.track(MemoryCategory::Mesh, 1000);
+    auto texture = tracker.track(MemoryCategory::Texture, 4096);
+
+    auto now     = tracker.snapshot();
+    REQUIRE(now.getLive(MemoryCategory::Mesh) == 1000);
+    REQUIRE(now.getLive(MemoryCategory::Texture) == 4096);
+    REQUIRE(now.total_live == 5096);
+
+    /* moving an allocation does not count it twice */
+    auto moved = std::move(mesh);
+    REQUIRE(tracker.snapshot().total_live == 5096);
+    REQUIRE(moved.getBytes() == 1000);
+    REQUIRE(mesh.getBytes() == 0);
+
+    texture.reset();
+    REQUIRE(tracker.snapshot().getLive(MemoryCategory::Texture) == 0);
+  }
+
+  auto after = tracker.snapshot();
+  REQUIRE(after.total_live == 0);
+  REQUIRE(after.total_peak == 5096);
+  REQUIRE(after.peak[static_cast<size_t>(MemoryCategory::Texture)] == 4096);
+  REQUIRE(after.allocations[static_cast<size_t>(MemoryCategory::Mesh)] == 0);
+}
+
+TEST_CASE("Memory tracker allocations may outlive their tracker", "[memory]")
+{
+  MemoryTracker::Allocation survivor;
+  {
+    MemoryTracker tracker;
+    survivor = tracker.track(MemoryCategory::Mesh, 256);
+    REQUIRE(tracker.snapshot().total_live == 256);
+  }
+
+  /* releases into the counters the allocation shares, not a dead tracker */
+  REQUIRE(survivor.getBytes() == 256);
+  survivor.reset();
+  REQUIRE(survivor.getBytes() == 0);
+}
+
+TEST_CASE("Memory tracker snapshots each frame", "[memory]")
+{
+  MemoryTracker tracker;
+  const size_t  staging = static_cast<size_t>(MemoryCategory::Staging);
+
+  auto          kept    = tracker.track(MemoryCategory::Staging, 100);
+  {
+    auto transient = tracker.track(MemoryCategory::Staging, 900);
+  }
+
+  auto first = tracker.endFrame();
+  REQUIRE(first.frame == 0);
+  REQUIRE(first.frame_peak[staging] == 1000);
+  REQUIRE(first.live[staging] == 100);
+
+  auto second = tracker.endFrame();
+  REQUIRE(second.frame == 1);
+  REQUIRE(second.frame_peak[staging] == 100);
+  REQUIRE(second.peak[staging] == 1000);
+}
+
+TEST_CASE("Memory tracker calls budget callbacks when over budget", "[memory]")
+{
+  MemoryTracker                          tracker;
+  std::vector<MemoryTracker::Allocation> cache;
+  for (int i = 0; i < 4; ++i) {
+    cache.push_back(tracker.track(MemoryCategory::Texture, 256));
+  }
+
+  uint64_t reported = 0;
+  int      calls    = 0;
+  tracker.setBudget(MemoryCategory::Texture, 600,
+                    [&](MemoryCategory category, uint64_t excess) {
+                      REQUIRE(category == MemoryCategory::Texture);
+                      ++calls;
+                      reported = excess;
+                      /* evict until under budget */
+                      while (excess > 0 && !cache.empty()) {
+                        excess -= std::min(excess, cache.back().getBytes());
+                        cache.pop_back();
+                      }
+                    });
+  REQUIRE(tracker.getBudget(MemoryCategory::Texture) == 600);
+
+  tracker.checkBudgets();
+  REQUIRE(calls == 1);
+  REQUIRE(reported == 1024 - 600);
+  REQUIRE(tracker.snapshot().getLive(MemoryCategory::Texture) == 512);
+
+  /* under budget, and budgets of 0 are off */
+  tracker.checkBudgets();
+  tracker.setBudget(MemoryCategory::Texture, 0);
+  cache.push_back(tracker.track(MemoryCategory::Texture, 1 << 20));
+  tracker.checkBudgets();
+  REQUIRE(calls == 1);
+}
+
+TEST_CASE("Memory tracker sizes textures", "[memory]")
+{
+  wgpu::TextureDescriptor desc = {};
+  desc.size                    = {256, 256, 1};
+  desc.format                  = wgpu::TextureFormat::RGBA8Unorm;
+  desc.mipLevelCount           = 1;
+  desc.sampleCount             = 1;
+  REQUIRE(MemoryTracker::textureBytes(desc) == 256 * 256 * 4);
+
+  /* a full chain is a third larger */
+  desc.mipLevelCount = 9;
+  REQUIRE(MemoryTracker::textureBytes(desc) == 4 * 87381);
+
+  /* BC1 is 8 bytes per 4 x 4 block, and a block at least */
+  desc.format = wgpu::TextureFormat::BC1RGBAUnorm;
+  REQUIRE(MemoryTracker::textureBytes(desc)
+          == 8 * (64 * 64 + 32 * 32 + 16 * 16 + 8 * 8 + 4 * 4 + 2 * 2 + 1 + 1 + 1));
+
+  desc.format        = wgpu::TextureFormat::Depth32Float;
+  desc.mipLevelCount = 1;
+  desc.sampleCount   = 4;
+  desc.size          = {128, 64, 2};
+  REQUIRE(MemoryTracker::textureBytes(desc) == 128 * 64 * 4 * 2 * 4);
+}
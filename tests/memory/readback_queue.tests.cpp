@@ -0,0 +1,196 @@
+#include "helpers/readback.h"
+#include "rndr/context.h"
+#include "rndr/memory/readback_queue.h"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+static wgpu::Buffer createSource(rndr::Context &context, size_t count)
+{
+  std::vector<uint32_t> data(count);
+  std::iota(data.begin(), data.end(), 0u);
+
+  wgpu::BufferDescriptor buffer_desc = {};
+  buffer_desc.usage = wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::CopySrc;
+  buffer_desc.size  = count * sizeof(uint32_t);
+  wgpu::Buffer buffer = context.getDevice().CreateBuffer(&buffer_desc);
+  context.getQueue().WriteBuffer(buffer, 0, data.data(), buffer_desc.size);
+  return buffer;
+}
+
+TEST_CASE("Readback queue batches small reads into one mapped chunk",
+          "[memory]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  constexpr size_t    count = 1024;
+  wgpu::Buffer        src   = createSource(*context, count);
+
+  rndr::ReadbackQueue readbacks(*context);
+  std::vector<bool>   matched(count / 4, false);
+
+  for (size_t i = 0; i < count / 4; ++i) {
+    REQUIRE(readbacks
+                .read(src, i * 16, 16,
+                      [&matched, i](ustd::result status,
+                                    rndr::ReadbackQueue::Mapping mapping) {
+                        REQUIRE(status.ok());
+                        auto values = mapping.as<uint32_t>();
+                        REQUIRE(values.size() == 4);
+                        matched[i]
+                            = values[0] == 4 * i && values[3] == 4 * i + 3;
+                      })
+                .ok());
+  }
+
+  REQUIRE(readbacks.submit().ok());
+  REQUIRE(readbacks.getInFlight() == count / 4);
+  readbacks.wait();
+  REQUIRE(readbacks.getInFlight() == 0);
+
+  REQUIRE(std::all_of(matched.begin(), matched.end(), [](bool m) { return m; }));
+  REQUIRE(readbacks.getStats().chunks_allocated == 1);
+  REQUIRE(readbacks.getStats().submissions == 1);
+  REQUIRE(readbacks.getStats().dedicated_readbacks == 0);
+}
+
+TEST_CASE("Readback mappings keep their chunk until released", "[memory]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  wgpu::Buffer                 src = createSource(*context, 64);
+
+  rndr::ReadbackQueue::Config  config;
+  config.chunk_size = 256;
+  config.max_chunks = 1;
+  rndr::ReadbackQueue          readbacks(*context, config);
+
+  rndr::ReadbackQueue::Mapping held;
+  REQUIRE(readbacks
+              .read(src, 0, 64,
+                    [&held](ustd::result                 status,
+                            rndr::ReadbackQueue::Mapping mapping) {
+                      REQUIRE(status.ok());
+                      held = std::move(mapping);
+                    })
+              .ok());
+  REQUIRE(readbacks.submit().ok());
+  readbacks.wait();
+
+  /* zero-copy: the view still reads the mapped chunk after the callback */
+  REQUIRE(!held.empty());
+  REQUIRE(held.as<uint32_t>()[15] == 15);
+
+  /* the only chunk is held, so the next read takes a dedicated buffer */
+  uint32_t last = 0;
+  REQUIRE(readbacks
+              .read(src, 252, 4,
+                    [&last](ustd::result                 status,
+                            rndr::ReadbackQueue::Mapping mapping) {
+                      last = mapping.as<uint32_t>()[0];
+                    })
+              .ok());
+  REQUIRE(readbacks.getStats().dedicated_readbacks == 1);
+  REQUIRE(readbacks.submit().ok());
+  readbacks.wait();
+  REQUIRE(last == 63);
+
+  /* once released, the chunk returns to the pool */
+  held.reset();
+  REQUIRE(readbacks.read(src, 0, 4, nullptr).ok());
+  REQUIRE(readbacks.getStats().dedicated_readbacks == 1);
+  REQUIRE(readbacks.getStats().chunks_allocated == 1);
+  REQUIRE(readbacks.submit().ok());
+  readbacks.wait();
+}
+
+TEST_CASE("Readback queue retires chunks whose map fails", "[memory]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  wgpu::Buffer                src = createSource(*context, 64);
+
+  rndr::ReadbackQueue::Config config;
+  config.chunk_size = 256;
+  config.max_chunks = 1;
+  rndr::ReadbackQueue         readbacks(*context, config);
+
+  bool                        failed = false;
+  REQUIRE(readbacks.read(src, 0, 16, nullptr).ok());
+  REQUIRE(readbacks
+              .read(src, 16, 16,
+                    [&failed](ustd::result                 status,
+                              rndr::ReadbackQueue::Mapping mapping) {
+                      failed = !status.ok() && mapping.empty();
+                    })
+              .ok());
+  REQUIRE(readbacks.submit().ok());
+
+  /* losing the device fails the pending map */
+  context->getDevice().Destroy();
+  readbacks.wait();
+
+  REQUIRE(failed);
+  REQUIRE(readbacks.getInFlight() == 0);
+  REQUIRE(readbacks.getStats().failed_maps == 1);
+  /* the pool has room for a replacement */
+  REQUIRE(readbacks.getStats().chunks_allocated == 0);
+}
+
+TEST_CASE("Readback queue rejects unaligned and out of bounds reads",
+          "[memory]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  wgpu::Buffer        src = createSource(*context, 16);
+  rndr::ReadbackQueue readbacks(*context);
+
+  REQUIRE(!readbacks.read(src, 0, 3, nullptr).ok());
+  REQUIRE(!readbacks.read(src, 2, 4, nullptr).ok());
+  REQUIRE(!readbacks.read(src, 60, 8, nullptr).ok());
+  REQUIRE(!readbacks.read(src, 0, 0, nullptr).ok());
+  REQUIRE(readbacks.getStats().requests == 0);
+}
+
+TEST_CASE("Batched readbacks against one buffer per read", "[.][benchmark]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  constexpr size_t    reads = 1000;
+  wgpu::Buffer        src   = createSource(*context, reads * 4);
+  rndr::ReadbackQueue readbacks(*context);
+
+  BENCHMARK("Readback queue, 1000 reads of 16 bytes")
+  {
+    uint32_t sum = 0;
+    for (size_t i = 0; i < reads; ++i) {
+      REQUIRE(readbacks
+                  .read(src, i * 16, 16,
+                        [&sum](ustd::result                 status,
+                               rndr::ReadbackQueue::Mapping mapping) {
+                          sum += mapping.as<uint32_t>()[0];
+                        })
+                  .ok());
+    }
+    REQUIRE(readbacks.submit().ok());
+    readbacks.wait();
+    return sum;
+  };
+
+  BENCHMARK("Buffer per read, 1000 reads of 16 bytes")
+  {
+    uint32_t sum = 0;
+    for (size_t i = 0; i < reads; ++i) {
+      sum += test_helpers::readBack<uint32_t>(*context, src, 1, i * 16)[0];
+    }
+    return sum;
+  };
+}
@@ -0,0 +1,68 @@
+#include "rndr/memory/tlsf.h"
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <vector>
+
+using namespace rndr;
+
+TEST_CASE("TLSF allocations honour alignment and never overlap", "[memory]")
+{
+  constexpr uint64_t                     capacity = 1 << 20;
+  TlsfAllocator                          tlsf(capacity);
+  std::vector<TlsfAllocator::Allocation> live;
+  std::mt19937                           rng(42);
+
+  for (int i = 0; i < 5000; ++i) {
+    if (live.empty() || rng() % 3 != 0) {
+      uint64_t size      = 1 + rng() % 4096;
+      uint64_t alignment = uint64_t{1} << (rng() % 9);
+      auto     allocation = tlsf.allocate(size, alignment);
+      if (!allocation) {
+        continue;
+      }
+
+      REQUIRE(allocation->offset % alignment == 0);
+      REQUIRE(allocation->offset + allocation->size <= capacity);
+      for (const auto &other : live) {
+        bool disjoint = allocation->offset + allocation->size <= other.offset
+                        || other.offset + other.size <= allocation->offset;
+        REQUIRE(disjoint);
+      }
+      live.push_back(*allocation);
+    }
+    else {
+      size_t index = rng() % live.size();
+      tlsf.free(live[index]);
+      live.erase(live.begin() + index);
+    }
+  }
+
+  for (const auto &allocation : live) {
+    tlsf.free(allocation);
+  }
+
+  REQUIRE(tlsf.getUsed() == 0);
+  REQUIRE(tlsf.getAllocationCount() == 0);
+  REQUIRE(tlsf.getLargestFree() == capacity);
+}
+
+TEST_CASE("TLSF coalesces neighbouring free ranges", "[memory]")
+{
+  TlsfAllocator tlsf(300);
+
+  auto          a = tlsf.allocate(100);
+  auto          b = tlsf.allocate(100);
+  auto          c = tlsf.allocate(100);
+  REQUIRE((a && b && c));
+  REQUIRE(!tlsf.allocate(1));
+
+  tlsf.free(*a);
+  tlsf.free(*c);
+  REQUIRE(tlsf.getLargestFree() == 100);
+  REQUIRE(!tlsf.allocate(200));
+
+  tlsf.free(*b);
+  auto whole = tlsf.allocate(300);
+  REQUIRE(whole);
+  REQUIRE(whole->offset == 0);
+}
@@ -0,0 +1,59 @@
+#include "rndr/context.h"
+#include "rndr/math/matrix.h"
+#include "rndr/memory/uniform_ring.h"
+#include "rndr/memory/upload_ring.h"
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <vector>
+
+using namespace rndr;
+
+TEST_CASE("Uniform ring hands out aligned dynamic offsets", "[memory]")
+{
+  auto context = std::make_unique<Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  UploadRing          uploads(*context);
+  UniformRing::Config config;
+  config.frame_capacity = 4096;
+  UniformRing ring(*context, uploads, config);
+  REQUIRE(ring.initialize().ok());
+
+  const uint64_t alignment
+      = context->getLimits().minUniformBufferOffsetAlignment;
+
+  ring.beginFrame();
+  std::vector<uint32_t> offsets;
+  for (int i = 0; i < 4; ++i) {
+    auto model = math::matrix<4, 4>::identity<4>();
+    model.at(0, 3) = static_cast<float>(i);
+    auto offset    = ring.push(model);
+    REQUIRE(offset.ok());
+    REQUIRE(*offset % alignment == 0);
+    offsets.push_back(*offset);
+  }
+
+  /* all four pushes were contiguous and coalesced into a single copy */
+  REQUIRE(uploads.getStats().copies_coalesced == 3);
+  REQUIRE(ring.getStats().pushes == 4);
+
+  /* the segment runs out once another binding would not fit */
+  while (ring.push(math::vec4{}).ok()) {
+  }
+  REQUIRE(!ring.push(math::vec4{}).ok());
+}
+
+TEST_CASE("Uniform ring rejects bindings the device cannot support",
+          "[memory]")
+{
+  auto context = std::make_unique<Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  UploadRing          uploads(*context);
+  UniformRing::Config config;
+  config.binding_size
+      = context->getLimits().maxUniformBufferBindingSize + 256;
+  config.frame_capacity = config.binding_size;
+  UniformRing ring(*context, uploads, config);
+  REQUIRE(!ring.initialize().ok());
+}
@@ -0,0 +1,167 @@
+#include "helpers/readback.h"
+#include "rndr/context.h"
+#include "rndr/memory/upload_ring.h"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+static wgpu::Buffer createDestination(rndr::Context &context, uint64_t size)
+{
+  wgpu::BufferDescriptor buffer_desc = {};
+  buffer_desc.usage = wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::CopySrc;
+  buffer_desc.size  = size;
+  return context.getDevice().CreateBuffer(&buffer_desc);
+}
+
+TEST_CASE("Upload ring coalesces small uploads and round trips data",
+          "[memory]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  constexpr size_t      count = 256;
+  wgpu::Buffer          dst   = createDestination(*context, count * 4);
+
+  std::vector<uint32_t> data(count);
+  std::iota(data.begin(), data.end(), 0u);
+
+  {
+    rndr::UploadRing ring(*context);
+    for (size_t i = 0; i < count; ++i) {
+      REQUIRE(ring.write(dst, i * 4, &data[i], 4).ok());
+    }
+    REQUIRE(ring.getStats().copies_coalesced == count - 1);
+    REQUIRE(ring.submit().ok());
+    REQUIRE(ring.getSubmissionIndex() == 1);
+
+    REQUIRE(test_helpers::readBack<uint32_t>(*context, dst, count) == data);
+  }
+}
+
+TEST_CASE("Upload ring rejects unaligned uploads", "[memory]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  wgpu::Buffer     dst = createDestination(*context, 64);
+  rndr::UploadRing ring(*context);
+  uint8_t          byte = 0;
+  REQUIRE(!ring.write(dst, 0, &byte, 1).ok());
+  REQUIRE(!ring.write(dst, 2, &byte, 4).ok());
+}
+
+TEST_CASE("Upload ring falls back to dedicated buffers", "[memory]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::UploadRing::Config config;
+  config.chunk_size          = 1024;
+  config.dedicated_threshold = 512;
+  config.max_chunks          = 1;
+
+  constexpr size_t      count = 1024;
+  wgpu::Buffer          dst   = createDestination(*context, count * 4);
+  std::vector<uint32_t> data(count);
+  std::iota(data.begin(), data.end(), 7u);
+
+  rndr::UploadRing ring(*context, config);
+  REQUIRE(ring.write(dst, 0, std::span<const uint32_t>(data)).ok());
+  REQUIRE(ring.getStats().dedicated_uploads == 1);
+  REQUIRE(ring.submit().ok());
+
+  REQUIRE(test_helpers::readBack<uint32_t>(*context, dst, count) == data);
+}
+
+TEST_CASE("Upload ring never processes events while chunks are in flight",
+          "[memory]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  size_t   callbacks = 0;
+  uint32_t id = context->addEventCallback([&callbacks]() { ++callbacks; });
+
+  rndr::UploadRing::Config config;
+  config.chunk_size          = 1024;
+  config.dedicated_threshold = 512;
+  config.max_chunks          = 1;
+
+  constexpr size_t      count = 128;
+  wgpu::Buffer          dst   = createDestination(*context, count * 4);
+  std::vector<uint32_t> data(count);
+  std::iota(data.begin(), data.end(), 3u);
+
+  rndr::UploadRing ring(*context, config);
+  REQUIRE(ring.write(dst, 0, std::span<const uint32_t>(data)).ok());
+  REQUIRE(ring.submit().ok());
+
+  /* the only chunk is in flight, so the next write must not wait for it */
+  REQUIRE(ring.write(dst, 0, std::span<const uint32_t>(data)).ok());
+  REQUIRE(callbacks == 0);
+  REQUIRE(ring.getStats().dedicated_uploads == 1);
+  REQUIRE(ring.submit().ok());
+
+  /* once the chunk has come back, writes use the ring again */
+  context->blockOnSubmittedWork();
+  context->processEvents();
+  REQUIRE(callbacks == 1);
+  REQUIRE(ring.write(dst, 0, std::span<const uint32_t>(data)).ok());
+  REQUIRE(ring.getStats().dedicated_uploads == 1);
+  REQUIRE(ring.submit().ok());
+
+  REQUIRE(test_helpers::readBack<uint32_t>(*context, dst, count) == data);
+  context->removeEventCallback(id);
+}
+
+TEST_CASE("Upload ring throughput", "[.][benchmark]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  constexpr size_t      small_count = 4096;
+  constexpr size_t      small_size  = 64;
+  constexpr size_t      large_count = 4;
+  constexpr size_t      large_size  = 1 << 23;
+
+  wgpu::Buffer          dst = createDestination(*context, large_size);
+  std::vector<uint8_t>  data(large_size, 0xAB);
+  rndr::UploadRing      ring(*context);
+  const wgpu::Queue    &queue = context->getQueue();
+
+  BENCHMARK("many small uploads, upload ring")
+  {
+    for (size_t i = 0; i < small_count; ++i) {
+      (void)ring.write(dst, i * small_size, data.data(), small_size);
+    }
+    (void)ring.submit();
+    context->blockOnSubmittedWork();
+  };
+
+  BENCHMARK("many small uploads, Queue::WriteBuffer")
+  {
+    for (size_t i = 0; i < small_count; ++i) {
+      queue.WriteBuffer(dst, i * small_size, data.data(), small_size);
+    }
+    context->blockOnSubmittedWork();
+  };
+
+  BENCHMARK("few large uploads, upload ring")
+  {
+    for (size_t i = 0; i < large_count; ++i) {
+      (void)ring.write(dst, 0, data.data(), large_size);
+    }
+    (void)ring.submit();
+    context->blockOnSubmittedWork();
+  };
+
+  BENCHMARK("few large uploads, Queue::WriteBuffer")
+  {
+    for (size_t i = 0; i < large_count; ++i) {
+      queue.WriteBuffer(dst, 0, data.data(), large_size);
+    }
+    context->blockOnSubmittedWork();
+  };
+}
@@ -0,0 +1,59 @@
+#include "rndr/context.h"
+#include "rndr/profiling/gpu_profiler.h"
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+
+TEST_CASE("GPU profiler records per-pass timings", "[profiling]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  constexpr size_t frames = 8;
+
+  {
+    rndr::GpuProfiler profiler(*context);
+    REQUIRE(profiler.initialize().ok());
+
+    for (size_t i = 0; i < frames; ++i) {
+      profiler.beginFrame();
+
+      wgpu::CommandEncoder encoder = context->getDevice().CreateCommandEncoder();
+
+      wgpu::ComputePassDescriptor pass_desc = {};
+      pass_desc.timestampWrites             = profiler.computePass("empty");
+      REQUIRE((pass_desc.timestampWrites != nullptr)
+              == profiler.usesTimestamps());
+
+      wgpu::ComputePassEncoder pass = encoder.BeginComputePass(&pass_desc);
+      pass.End();
+
+      profiler.resolve(encoder);
+      wgpu::CommandBuffer command_buffer = encoder.Finish();
+      context->getQueue().Submit(1, &command_buffer);
+      profiler.endFrame();
+
+      context->blockOnSubmittedWork();
+      context->processEvents();
+    }
+
+    auto stats = profiler.getStats();
+    REQUIRE(stats.size() == 1);
+    REQUIRE(stats[0].name
+            == (profiler.usesTimestamps() ? "empty"
+                                          : rndr::GpuProfiler::cpu_fallback_name));
+    REQUIRE(stats[0].samples > 0);
+    REQUIRE(stats[0].min_ms >= 0.0);
+    REQUIRE(stats[0].min_ms <= stats[0].p99_ms);
+  }
+}
+
+TEST_CASE("GPU profiler rejects an empty configuration", "[profiling]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::GpuProfiler::Config config;
+  config.history = 0;
+  rndr::GpuProfiler profiler(*context, config);
+  REQUIRE(!profiler.initialize().ok());
+}
@@ -0,0 +1,124 @@
+#include "rndr/profiling/trace.h"
+#include <catch2/catch_test_macros.hpp>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rndr;
+
+static size_t count_occurrences(const std::string &haystack,
+                                const std::string &needle)
+{
+  size_t count = 0;
+  for (size_t pos = haystack.find(needle); pos != std::string::npos;
+       pos        = haystack.find(needle, pos + needle.size())) {
+    ++count;
+  }
+  return count;
+}
+
+TEST_CASE("Trace zones export as Chrome trace events", "[profiling]")
+{
+  trace::clear();
+
+  {
+    trace::Zone outer("outer");
+    trace::Zone inner("inner \"quoted\"");
+  }
+
+  std::string json = trace::exportChromeTrace();
+  REQUIRE(json.starts_with("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+  REQUIRE(json.ends_with("]}"));
+  REQUIRE(count_occurrences(json, "\"ph\":\"X\"") == 2);
+  REQUIRE(json.find("\"name\":\"outer\"") != std::string::npos);
+  REQUIRE(json.find("\"name\":\"inner \\\"quoted\\\"\"") != std::string::npos);
+
+  trace::clear();
+  REQUIRE(count_occurrences(trace::exportChromeTrace(), "\"ph\":\"X\"") == 0);
+}
+
+TEST_CASE("Trace zones are kept per thread", "[profiling]")
+{
+  trace::clear();
+
+  constexpr size_t         thread_count = 4;
+  constexpr size_t         zone_count   = 100;
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < thread_count; ++t) {
+    threads.emplace_back([] {
+      for (size_t i = 0; i < zone_count; ++i) {
+        trace::Zone zone("worker");
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  std::string json = trace::exportChromeTrace();
+  REQUIRE(count_occurrences(json, "\"name\":\"worker\"")
+          == thread_count * zone_count);
+}
+
+static std::set<std::string> thread_ids(const std::string &json)
+{
+  std::set<std::string> ids;
+  for (size_t pos = json.find("\"tid\":"); pos != std::string::npos;
+       pos        = json.find("\"tid\":", pos + 1)) {
+    ids.insert(json.substr(pos, json.find(',', pos) - pos));
+  }
+  return ids;
+}
+
+TEST_CASE("Trace rings of finished threads are recycled", "[profiling]")
+{
+  trace::clear();
+
+  /* one zone on the main thread, so that its ring shows up too */
+  { trace::Zone zone("main"); }
+
+  constexpr size_t thread_count = 64;
+  for (size_t t = 0; t < thread_count; ++t) {
+    std::thread([] { trace::Zone zone("short-lived"); }).join();
+  }
+
+  std::string json = trace::exportChromeTrace();
+  REQUIRE(count_occurrences(json, "\"name\":\"short-lived\"")
+          == thread_count);
+  /* one after the other, the threads never need more than one ring */
+  REQUIRE(thread_ids(json).size() == 2);
+}
+
+TEST_CASE("Trace rings keep only the newest zones", "[profiling]")
+{
+  trace::clear();
+
+  std::thread([] {
+    for (size_t i = 0; i < trace::ring_capacity + 10; ++i) {
+      trace::Zone zone("overflow");
+    }
+  }).join();
+
+  std::string json = trace::exportChromeTrace();
+  REQUIRE(count_occurrences(json, "\"name\":\"overflow\"")
+          == trace::ring_capacity);
+}
+
+TEST_CASE("Trace export keeps long timestamps exact and escapes names",
+          "[profiling]")
+{
+  trace::clear();
+
+  /* two minutes in, where six significant digits would drop the microseconds */
+  trace::record("late", 123456789012, 123456790512);
+  trace::record("tab\tand\nnewline", 0, 1000);
+
+  std::string json = trace::exportChromeTrace();
+  REQUIRE(json.find("\"ts\":123456789.012,\"dur\":1.500") != std::string::npos);
+  REQUIRE(json.find("\"name\":\"tab\\u0009and\\u000anewline\"")
+          != std::string::npos);
+  REQUIRE(json.find('\n') == std::string::npos);
+
+  trace::clear();
+}
@@ -0,0 +1,267 @@
+#include "rndr/context.h"
+#include "rndr/render/depth_target.h"
+#include "rndr/resources/material.h"
+#include "rndr/resources/resource_cache.h"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <memory>
+#include <string>
+
+/* full-screen layers at 0.05 depth steps, each shading a few sines */
+static const char *shader_source = R"(
+override BACK_TO_FRONT: bool = false;
+
+struct VertexOut {
+  @builtin(position) position: vec4f,
+  @location(0) @interpolate(flat) layer: u32,
+}
+
+@vertex
+fn vs_main(@builtin(vertex_index) vertex: u32,
+           @builtin(instance_index) layer: u32) -> VertexOut {
+  var corners = array<vec2f, 3>(vec2f(-1.0, -1.0), vec2f(3.0, -1.0),
+                                vec2f(-1.0, 3.0));
+  var depth = 0.05 + 0.05 * f32(layer);
+  if (BACK_TO_FRONT) {
+    depth = 0.95 - 0.05 * f32(layer);
+  }
+
+  var out: VertexOut;
+  out.position = vec4f(corners[vertex], depth, 1.0);
+  out.layer    = layer;
+  return out;
+}
+
+@fragment
+fn fs_main(in: VertexOut) -> @location(0) vec4f {
+  var shade = 0.0;
+  for (var i = 0u; i < 64u; i++) {
+    shade += sin(in.position.x * f32(i) + in.position.y) * 1e-6;
+  }
+  return vec4f(f32(in.layer + 1u) * 8.0 / 255.0 + shade, 0.0, 0.0, 1.0);
+}
+)";
+
+enum class DepthMode { None, Test, Prepass };
+
+static rndr::Material::Config layerConfig(DepthMode mode)
+{
+  rndr::Material::Config config = {};
+  config.shader_source          = shader_source;
+  config.uses_mesh              = false;
+  config.color_format           = wgpu::TextureFormat::RGBA8Unorm;
+  config.features               = {"BACK_TO_FRONT"};
+  if (mode != DepthMode::None) {
+    config.depth_format = wgpu::TextureFormat::Depth24Plus;
+  }
+  config.depth_prepass = mode == DepthMode::Prepass;
+  return config;
+}
+
+static wgpu::Texture createTarget(rndr::Context &context, uint32_t size)
+{
+  wgpu::TextureDescriptor texture_desc = {};
+  texture_desc.usage  = wgpu::TextureUsage::RenderAttachment
+                       | wgpu::TextureUsage::CopySrc;
+  texture_desc.format = wgpu::TextureFormat::RGBA8Unorm;
+  texture_desc.size   = {size, size, 1};
+  return context.getDevice().CreateTexture(&texture_desc);
+}
+
+static void drawLayers(rndr::Context        &context,
+                       const wgpu::Texture  &target,
+                       rndr::DepthTarget    &depth,
+                       const rndr::Material &material,
+                       DepthMode             mode,
+                       uint32_t              variant,
+                       uint32_t              layers)
+{
+  wgpu::CommandEncoder encoder = context.getDevice().CreateCommandEncoder();
+  wgpu::BindGroup      frame   = {};
+  depth.fit(target);
+
+  rndr::DrawCall draw = {};
+  draw.element_count  = 3;
+  draw.instance_count = layers;
+
+  wgpu::RenderPassDepthStencilAttachment depth_attachment
+      = depth.attachment(mode != DepthMode::Prepass);
+
+  if (mode == DepthMode::Prepass) {
+    wgpu::RenderPassDepthStencilAttachment prepass_attachment
+        = depth.attachment(true);
+
+    wgpu::RenderPassDescriptor prepass_desc = {};
+    prepass_desc.depthStencilAttachment     = &prepass_attachment;
+
+    material.applyDepthOnly(draw, frame, variant);
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&prepass_desc);
+    rndr::encode_draw(pass, draw);
+    pass.End();
+  }
+
+  wgpu::RenderPassColorAttachment attachment = {};
+  attachment.view                            = target.CreateView();
+  attachment.loadOp                          = wgpu::LoadOp::Clear;
+  attachment.storeOp                         = wgpu::StoreOp::Store;
+
+  wgpu::RenderPassDescriptor pass_desc       = {};
+  pass_desc.colorAttachmentCount             = 1;
+  pass_desc.colorAttachments                 = &attachment;
+  if (mode != DepthMode::None) {
+    pass_desc.depthStencilAttachment = &depth_attachment;
+  }
+
+  material.apply(draw, frame, variant);
+  wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&pass_desc);
+  rndr::encode_draw(pass, draw);
+  pass.End();
+
+  wgpu::CommandBuffer command_buffer = encoder.Finish();
+  context.getQueue().Submit(1, &command_buffer);
+}
+
+/* blocking read of the red channel of the top-left texel */
+static uint8_t readRed(rndr::Context &context, const wgpu::Texture &texture)
+{
+  wgpu::BufferDescriptor buffer_desc = {};
+  buffer_desc.usage = wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::MapRead;
+  buffer_desc.size  = 256;
+  wgpu::Buffer readback = context.getDevice().CreateBuffer(&buffer_desc);
+
+  wgpu::ImageCopyTexture src = {};
+  src.texture                = texture;
+
+  wgpu::ImageCopyBuffer dst  = {};
+  dst.buffer                 = readback;
+  dst.layout.bytesPerRow     = 256;
+
+  wgpu::Extent3D       size  = {1, 1, 1};
+  wgpu::CommandEncoder encoder = context.getDevice().CreateCommandEncoder();
+  encoder.CopyTextureToBuffer(&src, &dst, &size);
+  wgpu::CommandBuffer commands = encoder.Finish();
+  context.getQueue().Submit(1, &commands);
+
+  uint8_t      red        = 0;
+  wgpu::Future map_future = readback.MapAsync(
+      wgpu::MapMode::Read, 0, 256, wgpu::CallbackMode::AllowProcessEvents,
+      [&](wgpu::MapAsyncStatus status, const char *message) {
+        if (status == wgpu::MapAsyncStatus::Success) {
+          red = *static_cast<const uint8_t *>(
+              readback.GetConstMappedRange(0, 256));
+          readback.Unmap();
+        }
+      });
+  context.blockOnFuture(map_future);
+
+  return red;
+}
+
+TEST_CASE("Depth target follows the size of its color target", "[render]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::DepthTarget depth(*context);
+  depth.resize(64, 32);
+  REQUIRE(depth.getWidth() == 64);
+  REQUIRE(depth.getHeight() == 32);
+  REQUIRE(depth.getTexture().GetFormat() == wgpu::TextureFormat::Depth24Plus);
+
+  /* the same size keeps the texture */
+  WGPUTexture first = depth.getTexture().Get();
+  depth.resize(64, 32);
+  REQUIRE(depth.getTexture().Get() == first);
+  REQUIRE(context->getPendingDestroyCount() == 0);
+
+  depth.fit(createTarget(*context, 16));
+  REQUIRE(depth.getWidth() == 16);
+  REQUIRE(depth.getTexture().Get() != first);
+  REQUIRE(context->getPendingDestroyCount() == 1);
+
+  REQUIRE(!rndr::DepthTarget::hasStencil(depth.getFormat()));
+  REQUIRE(depth.attachment(false).depthLoadOp == wgpu::LoadOp::Load);
+  REQUIRE(depth.attachment().stencilLoadOp == wgpu::LoadOp::Undefined);
+}
+
+TEST_CASE("Depth prepass keeps the nearest layer", "[render]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::ResourceCache cache(*context);
+  rndr::DepthTarget   depth(*context);
+  wgpu::Texture       target = createTarget(*context, 16);
+
+  rndr::Material      none(*context, cache, layerConfig(DepthMode::None));
+  rndr::Material      test(*context, cache, layerConfig(DepthMode::Test));
+  rndr::Material prepass(*context, cache, layerConfig(DepthMode::Prepass));
+  REQUIRE(none.initialize().ok());
+  REQUIRE(test.initialize().ok());
+  REQUIRE(prepass.initialize().ok());
+  REQUIRE(prepass.getDepthPipeline().Get() != prepass.getPipeline().Get());
+
+  uint32_t back_to_front = prepass.getVariant({"BACK_TO_FRONT"});
+
+  /* front to back: without depth the farthest layer is drawn last and wins */
+  drawLayers(*context, target, depth, none, DepthMode::None, 0, 8);
+  REQUIRE(readRed(*context, target) == 8 * 8);
+
+  drawLayers(*context, target, depth, test, DepthMode::Test, 0, 8);
+  REQUIRE(readRed(*context, target) == 1 * 8);
+
+  drawLayers(*context, target, depth, prepass, DepthMode::Prepass, 0, 8);
+  REQUIRE(readRed(*context, target) == 1 * 8);
+
+  drawLayers(*context, target, depth, prepass, DepthMode::Prepass,
+             back_to_front, 8);
+  REQUIRE(readRed(*context, target) == 8 * 8);
+
+  auto config          = layerConfig(DepthMode::Prepass);
+  config.depth_format  = wgpu::TextureFormat::Undefined;
+  rndr::Material broken(*context, cache, config);
+  REQUIRE(!broken.initialize().ok());
+}
+
+TEST_CASE("Depth prepass on a high-overdraw scene", "[.][benchmark]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::ResourceCache cache(*context);
+  rndr::DepthTarget   depth(*context);
+  wgpu::Texture       target = createTarget(*context, 1024);
+
+  rndr::Material      none(*context, cache, layerConfig(DepthMode::None));
+  rndr::Material      test(*context, cache, layerConfig(DepthMode::Test));
+  rndr::Material prepass(*context, cache, layerConfig(DepthMode::Prepass));
+  REQUIRE(none.initialize().ok());
+  REQUIRE(test.initialize().ok());
+  REQUIRE(prepass.initialize().ok());
+
+  /* back to front is the worst case for early depth testing */
+  uint32_t       back_to_front = prepass.getVariant({"BACK_TO_FRONT"});
+  const uint32_t layers        = 16;
+
+  BENCHMARK("16 layers, no depth")
+  {
+    drawLayers(*context, target, depth, none, DepthMode::None, back_to_front,
+               layers);
+    context->blockOnSubmittedWork();
+  };
+
+  BENCHMARK("16 layers, depth test")
+  {
+    drawLayers(*context, target, depth, test, DepthMode::Test, back_to_front,
+               layers);
+    context->blockOnSubmittedWork();
+  };
+
+  BENCHMARK("16 layers, depth prepass")
+  {
+    drawLayers(*context, target, depth, prepass, DepthMode::Prepass,
+               back_to_front, layers);
+    context->blockOnSubmittedWork();
+  };
+}
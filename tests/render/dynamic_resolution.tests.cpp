@@ -0,0 +1,95 @@
+#include "helpers/readback.h"
+#include "rndr/context.h"
+#include "rndr/render/dynamic_resolution.h"
+#include "rndr/resources/resource_cache.h"
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+
+static void clearTarget(rndr::Context           &context,
+                        const wgpu::TextureView &view,
+                        wgpu::Color              color)
+{
+  wgpu::RenderPassColorAttachment attachment = {};
+  attachment.view                            = view;
+  attachment.loadOp                          = wgpu::LoadOp::Clear;
+  attachment.storeOp                         = wgpu::StoreOp::Store;
+  attachment.clearValue                      = color;
+
+  wgpu::RenderPassDescriptor pass_desc       = {};
+  pass_desc.colorAttachmentCount             = 1;
+  pass_desc.colorAttachments                 = &attachment;
+
+  wgpu::CommandEncoder encoder = context.getDevice().CreateCommandEncoder();
+  encoder.BeginRenderPass(&pass_desc).End();
+  wgpu::CommandBuffer commands = encoder.Finish();
+  context.getQueue().Submit(1, &commands);
+}
+
+TEST_CASE("Dynamic resolution upscales a scaled target", "[render]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::ResourceCache                cache(*context);
+  rndr::DynamicResolution::Config    config = {};
+  config.controller.target_ms               = 10.0;
+  config.controller.interval                = 1;
+  config.controller.max_step                = 0.5f;
+  config.output_format = wgpu::TextureFormat::RGBA8Unorm;
+  config.filter        = rndr::DynamicResolution::Filter::Sharpen;
+
+  rndr::DynamicResolution resolution(*context, cache, config);
+  REQUIRE(resolution.initialize().ok());
+
+  wgpu::TextureDescriptor output_desc = {};
+  output_desc.usage  = wgpu::TextureUsage::RenderAttachment
+                      | wgpu::TextureUsage::CopySrc;
+  output_desc.format = wgpu::TextureFormat::RGBA8Unorm;
+  output_desc.size   = {64, 64, 1};
+  wgpu::Texture output = context->getDevice().CreateTexture(&output_desc);
+
+  resolution.fit(output);
+  REQUIRE(resolution.getWidth() == 64);
+  REQUIRE(resolution.getHeight() == 64);
+
+  /* a frame four times over budget halves the scale, on the next `fit()` */
+  REQUIRE(resolution.addFrame(40.0, 0.0));
+  REQUIRE(resolution.getWidth() == 64);
+  resolution.fit(output);
+  REQUIRE(resolution.getScale() == 0.5f);
+  REQUIRE(resolution.getWidth() == 32);
+  REQUIRE(resolution.getHeight() == 32);
+  REQUIRE(context->getPendingDestroyCount() == 1);
+
+  /* a flat color survives both the filtering and the sharpening */
+  clearTarget(*context, resolution.getView(), {0.0, 1.0, 0.0, 1.0});
+
+  wgpu::CommandEncoder encoder = context->getDevice().CreateCommandEncoder();
+  resolution.upscale(encoder, output.CreateView());
+
+  wgpu::BufferDescriptor buffer_desc = {};
+  buffer_desc.usage = wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::CopySrc;
+  buffer_desc.size  = 256 * 64;
+  wgpu::Buffer pixels = context->getDevice().CreateBuffer(&buffer_desc);
+
+  wgpu::ImageCopyTexture src = {};
+  src.texture                = output;
+  wgpu::ImageCopyBuffer dst  = {};
+  dst.buffer                 = pixels;
+  dst.layout.bytesPerRow     = 256;
+  wgpu::Extent3D size        = {64, 64, 1};
+  encoder.CopyTextureToBuffer(&src, &dst, &size);
+
+  wgpu::CommandBuffer commands = encoder.Finish();
+  context->getQueue().Submit(1, &commands);
+
+  auto texels = test_helpers::readBack<uint8_t>(*context, pixels, 256 * 64);
+  for (uint32_t y : {0u, 31u, 63u}) {
+    for (uint32_t x : {0u, 17u, 63u}) {
+      const uint8_t *texel = &texels[y * 256 + x * 4];
+      REQUIRE(texel[0] == 0);
+      REQUIRE(texel[1] == 255);
+      REQUIRE(texel[3] == 255);
+    }
+  }
+}
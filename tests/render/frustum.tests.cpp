@@ -0,0 +1,30 @@
+#include "rndr/render/frustum.h"
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Frustum planes come from the view-projection matrix", "[render]")
+{
+  /* the identity maps the clip box x, y in [-1, 1] and z in [0, 1] */
+  auto          identity = rndr::math::matrix<4, 4>::identity<4>();
+  rndr::Frustum frustum  = rndr::Frustum::fromViewProjection(identity);
+
+  REQUIRE(frustum.intersects({0.f, 0.f, 0.5f, 0.1f}));
+  REQUIRE(frustum.intersects({1.05f, 0.f, 0.5f, 0.1f}));
+  REQUIRE(frustum.intersects({0.f, -1.05f, 1.05f, 0.1f}));
+
+  REQUIRE(!frustum.intersects({3.f, 0.f, 0.5f, 0.1f}));
+  REQUIRE(!frustum.intersects({0.f, 1.2f, 0.5f, 0.1f}));
+  REQUIRE(!frustum.intersects({0.f, 0.f, -0.5f, 0.1f}));
+  REQUIRE(!frustum.intersects({0.f, 0.f, 1.5f, 0.1f}));
+}
+
+TEST_CASE("Frustum follows translation in the view-projection", "[render]")
+{
+  /* shift x by 2, as the shaders read it: column 3 holds the translation */
+  auto view_projection      = rndr::math::matrix<4, 4>::identity<4>();
+  view_projection.at(3, 0)  = 2.f;
+  rndr::Frustum frustum
+      = rndr::Frustum::fromViewProjection(view_projection);
+
+  REQUIRE(frustum.intersects({-2.f, 0.f, 0.5f, 0.1f}));
+  REQUIRE(!frustum.intersects({0.f, 0.f, 0.5f, 0.1f}));
+}
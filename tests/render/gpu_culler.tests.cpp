@@ -0,0 +1,248 @@
+#include "helpers/fixtures.h"
+#include "helpers/readback.h"
+#include "rndr/context.h"
+#include "rndr/memory/buffer_allocator.h"
+#include "rndr/memory/upload_ring.h"
+#include "rndr/render/gpu_culler.h"
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+using test_helpers::tetrahedron;
+using test_helpers::translation;
+
+static wgpu::RenderPipeline createCulledPipeline(
+    rndr::Context &context, const wgpu::BindGroupLayout &instance_layout)
+{
+  wgpu::ShaderModuleWGSLDescriptor wgsl_desc = {};
+  wgsl_desc.code                             = R"(
+@group(0) @binding(0) var<storage, read> transforms: array<mat4x4f>;
+@group(0) @binding(1) var<storage, read> visible: array<u32>;
+
+@vertex
+fn vs_main(@builtin(instance_index) instance: u32,
+           @location(0) position: vec3f) -> @builtin(position) vec4f {
+  return transforms[visible[instance]] * vec4f(position, 1.0);
+}
+
+@fragment
+fn fs_main() -> @location(0) vec4f {
+  return vec4f(1.0);
+}
+)";
+
+  wgpu::ShaderModuleDescriptor module_desc = {};
+  module_desc.nextInChain                  = &wgsl_desc;
+  wgpu::ShaderModule module = context.getDevice().CreateShaderModule(&module_desc);
+
+  wgpu::PipelineLayoutDescriptor layout_desc = {};
+  layout_desc.bindGroupLayoutCount           = 1;
+  layout_desc.bindGroupLayouts               = &instance_layout;
+
+  wgpu::VertexAttribute attribute            = {};
+  attribute.format                           = wgpu::VertexFormat::Float32x3;
+  attribute.shaderLocation                   = 0;
+
+  wgpu::VertexBufferLayout vertex_layout     = {};
+  vertex_layout.arrayStride                  = sizeof(rndr::math::vec3);
+  vertex_layout.attributeCount               = 1;
+  vertex_layout.attributes                   = &attribute;
+
+  wgpu::ColorTargetState color_target        = {};
+  color_target.format = wgpu::TextureFormat::BGRA8Unorm;
+
+  wgpu::FragmentState fragment               = {};
+  fragment.module                            = module;
+  fragment.entryPoint                        = "fs_main";
+  fragment.targetCount                       = 1;
+  fragment.targets                           = &color_target;
+
+  wgpu::RenderPipelineDescriptor pipeline_desc = {};
+  pipeline_desc.layout = context.getDevice().CreatePipelineLayout(&layout_desc);
+  pipeline_desc.vertex.module      = module;
+  pipeline_desc.vertex.entryPoint  = "vs_main";
+  pipeline_desc.vertex.bufferCount = 1;
+  pipeline_desc.vertex.buffers     = &vertex_layout;
+  pipeline_desc.fragment           = &fragment;
+
+  return context.getDevice().CreateRenderPipeline(&pipeline_desc);
+}
+
+/* cull on the GPU if `gpu`, else on the CPU, then draw into an offscreen pass */
+static void cullAndDraw(rndr::Context &context, rndr::UploadRing &uploads,
+                        rndr::GpuCuller &culler, bool gpu,
+                        const rndr::GpuCuller::Transform &view_projection)
+{
+  rndr::math::vec3     camera_position({0.f, 0.f, 0.f});
+  wgpu::CommandEncoder encoder = context.getDevice().CreateCommandEncoder();
+
+  if (gpu) {
+    REQUIRE(culler.cull(encoder, view_projection, camera_position).ok());
+  }
+  else {
+    REQUIRE(culler.cullOnCpu(view_projection, camera_position).ok());
+  }
+
+  wgpu::TextureDescriptor texture_desc = {};
+  texture_desc.usage  = wgpu::TextureUsage::RenderAttachment;
+  texture_desc.format = wgpu::TextureFormat::BGRA8Unorm;
+  texture_desc.size   = {64, 64, 1};
+  wgpu::TextureView target
+      = context.getDevice().CreateTexture(&texture_desc).CreateView();
+
+  wgpu::RenderPassColorAttachment attachment = {};
+  attachment.view                            = target;
+  attachment.loadOp                          = wgpu::LoadOp::Clear;
+  attachment.storeOp                         = wgpu::StoreOp::Store;
+
+  wgpu::RenderPassDescriptor pass_desc       = {};
+  pass_desc.colorAttachmentCount             = 1;
+  pass_desc.colorAttachments                 = &attachment;
+
+  wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&pass_desc);
+  culler.draw(pass, 0);
+  pass.End();
+
+  REQUIRE(uploads.submit().ok());
+  wgpu::CommandBuffer command_buffer = encoder.Finish();
+  context.getQueue().Submit(1, &command_buffer);
+}
+
+TEST_CASE("GPU culling matches the CPU reference on the fallback adapter",
+          "[render]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  context->setForceFallbackAdapter(true);
+  REQUIRE(context->initialize().ok());
+
+  rndr::BufferAllocator allocator(*context);
+  rndr::UploadRing      uploads(*context);
+
+  rndr::MeshData        data_near = tetrahedron(0.01f);
+  rndr::MeshData        data_far  = tetrahedron(0.02f);
+  rndr::RenderableMesh  mesh_near(data_near);
+  rndr::RenderableMesh  mesh_far(data_far);
+  REQUIRE(mesh_near.upload(allocator, uploads).ok());
+  REQUIRE(mesh_far.upload(allocator, uploads).ok());
+
+  rndr::GpuCuller culler(*context, uploads);
+  REQUIRE(culler.initialize().ok());
+  wgpu::RenderPipeline pipeline
+      = createCulledPipeline(*context, culler.getBindGroupLayout());
+
+  rndr::GpuCuller::Lod lods[2] = {{&mesh_near, 0.6f}, {&mesh_far, 1.f}};
+  auto                 lod_draw = culler.addDraw(pipeline, lods);
+  REQUIRE(lod_draw.ok());
+
+  rndr::GpuCuller::Lod single[1] = {{&mesh_far, 100.f}};
+  auto                 far_draw  = culler.addDraw(pipeline, single);
+  REQUIRE(far_draw.ok());
+
+  /* the identity view-projection keeps x, y in [-1, 1] and z in [0, 1] */
+  for (int i = -12; i <= 12; ++i) {
+    float x = i * 0.25f;
+    REQUIRE(culler
+                .addInstance(*lod_draw, translation(x, 0.f, 0.5f),
+                             {x, 0.f, 0.5f, 0.01f})
+                .ok());
+    REQUIRE(culler
+                .addInstance(*far_draw, translation(x, 0.5f, 0.5f),
+                             {x, 0.5f, 0.5f, 0.01f})
+                .ok());
+  }
+  REQUIRE(culler.build().ok());
+  REQUIRE(culler.getStats().slots == 3);
+
+  auto view_projection = rndr::GpuCuller::Transform::identity<4>();
+  cullAndDraw(*context, uploads, culler, true, view_projection);
+
+  auto args = test_helpers::readBack<uint32_t>(
+      *context, culler.getArgsBuffer(), 3 * 5);
+  auto visible = test_helpers::readBack<uint32_t>(
+      *context, culler.getVisibleBuffer(),
+      culler.getVisibleBuffer().GetSize() / sizeof(uint32_t));
+
+  /* the same cull on the CPU fills in the same slots */
+  cullAndDraw(*context, uploads, culler, false, view_projection);
+  auto counts = culler.getCpuCounts();
+
+  uint32_t first = culler.getFirstSlot(*lod_draw);
+  REQUIRE(counts[first] == 3);
+  REQUIRE(counts[first + 1] == 4);
+  REQUIRE(counts[culler.getFirstSlot(*far_draw)] == 9);
+
+  for (uint32_t slot = 0; slot < 3; ++slot) {
+    INFO("slot " << slot);
+    REQUIRE(args[slot * 5 + 1] == counts[slot]);
+  }
+
+  /*
+   * both fill the prefix of every slot's region, the GPU in any order, so
+   * the lists hold the same instances once sorted
+   */
+  auto cpu_visible = test_helpers::readBack<uint32_t>(
+      *context, culler.getVisibleBuffer(), visible.size());
+  std::sort(visible.begin(), visible.end());
+  std::sort(cpu_visible.begin(), cpu_visible.end());
+  REQUIRE(visible == cpu_visible);
+}
+
+TEST_CASE("GPU culling against the CPU path", "[.][benchmark]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::BufferAllocator allocator(*context);
+  rndr::UploadRing      uploads(*context);
+
+  rndr::MeshData        data_near = tetrahedron(0.001f);
+  rndr::MeshData        data_far  = tetrahedron(0.002f);
+  rndr::RenderableMesh  mesh_near(data_near);
+  rndr::RenderableMesh  mesh_far(data_far);
+  REQUIRE(mesh_near.upload(allocator, uploads).ok());
+  REQUIRE(mesh_far.upload(allocator, uploads).ok());
+
+  rndr::GpuCuller culler(*context, uploads);
+  REQUIRE(culler.initialize().ok());
+  wgpu::RenderPipeline pipeline
+      = createCulledPipeline(*context, culler.getBindGroupLayout());
+
+  rndr::GpuCuller::Lod lods[2] = {{&mesh_near, 1.f}, {&mesh_far, 2.f}};
+
+  for (uint32_t instance_count : {100000u, 1000000u}) {
+    culler.clear();
+    auto draw = culler.addDraw(pipeline, lods);
+    REQUIRE(draw.ok());
+
+    /* a 4 x 4 x 2 volume, of which the clip box holds roughly an eighth */
+    for (uint32_t i = 0; i < instance_count; ++i) {
+      float x = (i % 100) / 25.f - 2.f;
+      float y = (i / 100 % 100) / 25.f - 2.f;
+      float z = (i / 10000 % 100) / 50.f - 0.5f;
+      REQUIRE(culler
+                  .addInstance(*draw, translation(x, y, z),
+                               {x, y, z, 0.005f})
+                  .ok());
+    }
+    REQUIRE(culler.build().ok());
+    REQUIRE(uploads.submit().ok());
+
+    auto        view_projection = rndr::GpuCuller::Transform::identity<4>();
+    std::string suffix          = std::to_string(instance_count) + " instances";
+
+    BENCHMARK("GPU cull and draw, " + suffix)
+    {
+      cullAndDraw(*context, uploads, culler, true, view_projection);
+      context->blockOnSubmittedWork();
+    };
+
+    BENCHMARK("CPU cull, upload and draw, " + suffix)
+    {
+      cullAndDraw(*context, uploads, culler, false, view_projection);
+      context->blockOnSubmittedWork();
+    };
+  }
+}
@@ -0,0 +1,195 @@
+#include "helpers/fixtures.h"
+#include "helpers/readback.h"
+#include "rndr/context.h"
+#include "rndr/memory/buffer_allocator.h"
+#include "rndr/memory/upload_ring.h"
+#include "rndr/render/instance_batcher.h"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <vector>
+
+using test_helpers::tetrahedron;
+using test_helpers::translation;
+
+static wgpu::RenderPipeline createInstancedPipeline(
+    rndr::Context &context, const wgpu::BindGroupLayout &instance_layout)
+{
+  wgpu::ShaderModuleWGSLDescriptor wgsl_desc = {};
+  wgsl_desc.code                             = R"(
+@group(0) @binding(0) var<storage, read> transforms: array<mat4x4f>;
+
+@vertex
+fn vs_main(@builtin(instance_index) instance: u32,
+           @location(0) position: vec3f) -> @builtin(position) vec4f {
+  return transforms[instance] * vec4f(position, 1.0);
+}
+
+@fragment
+fn fs_main() -> @location(0) vec4f {
+  return vec4f(1.0);
+}
+)";
+
+  wgpu::ShaderModuleDescriptor module_desc = {};
+  module_desc.nextInChain                  = &wgsl_desc;
+  wgpu::ShaderModule module = context.getDevice().CreateShaderModule(&module_desc);
+
+  wgpu::PipelineLayoutDescriptor layout_desc = {};
+  layout_desc.bindGroupLayoutCount           = 1;
+  layout_desc.bindGroupLayouts               = &instance_layout;
+
+  wgpu::VertexAttribute attribute            = {};
+  attribute.format                           = wgpu::VertexFormat::Float32x3;
+  attribute.shaderLocation                   = 0;
+
+  wgpu::VertexBufferLayout vertex_layout     = {};
+  vertex_layout.arrayStride                  = sizeof(rndr::math::vec3);
+  vertex_layout.attributeCount               = 1;
+  vertex_layout.attributes                   = &attribute;
+
+  wgpu::ColorTargetState color_target        = {};
+  color_target.format = wgpu::TextureFormat::BGRA8Unorm;
+
+  wgpu::FragmentState fragment               = {};
+  fragment.module                            = module;
+  fragment.entryPoint                        = "fs_main";
+  fragment.targetCount                       = 1;
+  fragment.targets                           = &color_target;
+
+  wgpu::RenderPipelineDescriptor pipeline_desc = {};
+  pipeline_desc.layout = context.getDevice().CreatePipelineLayout(&layout_desc);
+  pipeline_desc.vertex.module      = module;
+  pipeline_desc.vertex.entryPoint  = "vs_main";
+  pipeline_desc.vertex.bufferCount = 1;
+  pipeline_desc.vertex.buffers     = &vertex_layout;
+  pipeline_desc.fragment           = &fragment;
+
+  return context.getDevice().CreateRenderPipeline(&pipeline_desc);
+}
+
+static void drawFrame(rndr::Context               &context,
+                      const rndr::InstanceBatcher &batcher)
+{
+  wgpu::TextureDescriptor texture_desc = {};
+  texture_desc.usage  = wgpu::TextureUsage::RenderAttachment;
+  texture_desc.format = wgpu::TextureFormat::BGRA8Unorm;
+  texture_desc.size   = {64, 64, 1};
+  wgpu::TextureView target
+      = context.getDevice().CreateTexture(&texture_desc).CreateView();
+
+  wgpu::RenderPassColorAttachment attachment = {};
+  attachment.view                            = target;
+  attachment.loadOp                          = wgpu::LoadOp::Clear;
+  attachment.storeOp                         = wgpu::StoreOp::Store;
+
+  wgpu::RenderPassDescriptor pass_desc       = {};
+  pass_desc.colorAttachmentCount             = 1;
+  pass_desc.colorAttachments                 = &attachment;
+
+  wgpu::CommandEncoder encoder = context.getDevice().CreateCommandEncoder();
+  wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&pass_desc);
+  batcher.draw(pass, 0);
+  pass.End();
+
+  wgpu::CommandBuffer command_buffer = encoder.Finish();
+  context.getQueue().Submit(1, &command_buffer);
+}
+
+TEST_CASE("Instance batcher groups instances per mesh and pipeline",
+          "[render]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::BufferAllocator allocator(*context);
+  rndr::UploadRing      uploads(*context);
+
+  rndr::MeshData        data_a = tetrahedron(1.f);
+  rndr::MeshData        data_b = tetrahedron(2.f);
+  rndr::RenderableMesh  mesh_a(data_a);
+  rndr::RenderableMesh  mesh_b(data_b);
+  REQUIRE(mesh_a.upload(allocator, uploads).ok());
+  REQUIRE(mesh_b.upload(allocator, uploads).ok());
+
+  rndr::InstanceBatcher batcher(*context, uploads);
+  REQUIRE(batcher.initialize().ok());
+  wgpu::RenderPipeline pipeline
+      = createInstancedPipeline(*context, batcher.getBindGroupLayout());
+
+  batcher.begin();
+  for (int i = 0; i < 6; ++i) {
+    REQUIRE(batcher.add(i % 2 ? mesh_b : mesh_a, pipeline, translation(i)).ok());
+  }
+  REQUIRE(batcher.build().ok());
+
+  auto batches = batcher.getBatches();
+  REQUIRE(batches.size() == 2);
+  REQUIRE(batches[0].instance_count == 3);
+  REQUIRE(batches[1].first_instance == 3);
+  REQUIRE(batcher.getStats().instances == 6);
+
+  /* both meshes live in the same vertex and index blocks */
+  REQUIRE(batcher.getStats().buffer_binds <= 3);
+
+  REQUIRE(uploads.submit().ok());
+  drawFrame(*context, batcher);
+
+  /* instances are stored grouped by batch, in submission order */
+  auto  stored = test_helpers::readBack<float>(
+      *context, batcher.getInstanceBuffer(), 6 * 16);
+  float first_x = batches[0].mesh == &mesh_a ? 0.f : 1.f;
+  REQUIRE(stored[12] == first_x);
+  REQUIRE(stored[16 + 12] == first_x + 2.f);
+  REQUIRE(stored[3 * 16 + 12] == 1.f - first_x);
+}
+
+TEST_CASE("Instance batcher submit cost", "[.][benchmark]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::BufferAllocator             allocator(*context);
+  rndr::UploadRing                  uploads(*context);
+
+  constexpr size_t                  mesh_count = 16;
+  std::vector<rndr::RenderableMesh> meshes;
+  meshes.reserve(mesh_count);
+  for (size_t i = 0; i < mesh_count; ++i) {
+    rndr::MeshData data = tetrahedron(1.f + i);
+    meshes.emplace_back(data);
+    REQUIRE(meshes.back().upload(allocator, uploads).ok());
+  }
+
+  rndr::InstanceBatcher batcher(*context, uploads);
+  REQUIRE(batcher.initialize().ok());
+  wgpu::RenderPipeline pipeline
+      = createInstancedPipeline(*context, batcher.getBindGroupLayout());
+
+  for (size_t instance_count : {size_t{10000}, size_t{100000}}) {
+    auto record = [&] {
+      batcher.begin();
+      for (size_t i = 0; i < instance_count; ++i) {
+        (void)batcher.add(meshes[i % mesh_count], pipeline,
+                          translation(static_cast<float>(i)));
+      }
+      (void)batcher.build();
+      (void)uploads.submit();
+      drawFrame(*context, batcher);
+    };
+
+    BENCHMARK("CPU submit, " + std::to_string(instance_count) + " instances")
+    {
+      record();
+    };
+
+    /* frame time including the GPU, i.e. 1000 / FPS */
+    BENCHMARK("frame time, " + std::to_string(instance_count) + " instances")
+    {
+      record();
+      context->blockOnSubmittedWork();
+    };
+
+    context->blockOnSubmittedWork();
+  }
+}
@@ -0,0 +1,183 @@
+#include "rndr/context.h"
+#include "rndr/jobs/job_system.h"
+#include "rndr/render/bundle_cache.h"
+#include "rndr/render/parallel_recorder.h"
+#include "rndr/utils/helpers.h"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+static wgpu::TextureView createTarget(rndr::Context &context)
+{
+  wgpu::TextureDescriptor texture_desc = {};
+  texture_desc.usage     = wgpu::TextureUsage::RenderAttachment;
+  texture_desc.format    = wgpu::TextureFormat::BGRA8Unorm;
+  texture_desc.size      = {64, 64, 1};
+  return context.getDevice().CreateTexture(&texture_desc).CreateView();
+}
+
+static wgpu::RenderPassColorAttachment attach(const wgpu::TextureView &view)
+{
+  wgpu::RenderPassColorAttachment color_attachment = {};
+  color_attachment.view                            = view;
+  color_attachment.loadOp                          = wgpu::LoadOp::Clear;
+  color_attachment.storeOp                         = wgpu::StoreOp::Store;
+  color_attachment.clearValue                      = {0, 0, 0, 1};
+  return color_attachment;
+}
+
+TEST_CASE("Parallel recorder splits draws into ordered bundles", "[render]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  wgpu::RenderPipeline           pipeline = rndr::createRenderPipeline(*context);
+  rndr::RenderTargetLayout       layout   = {{wgpu::TextureFormat::BGRA8Unorm}};
+
+  rndr::DrawCall                 draw     = {};
+  draw.pipeline                           = &pipeline;
+  draw.element_count                      = 3;
+  std::vector<rndr::DrawCall>    draws(4096, draw);
+
+  rndr::JobSystem                jobs;
+  rndr::ParallelRecorder::Config config;
+  config.thread_count         = 4;
+  config.min_draws_per_bundle = 1024;
+  rndr::ParallelRecorder recorder(*context, jobs, config);
+
+  auto                   bundles = recorder.record(draws, layout);
+  REQUIRE(bundles.ok());
+  REQUIRE((*bundles).size() == (recorder.isMultithreaded() ? 4 : 1));
+  REQUIRE(recorder.getStats().draws_recorded == draws.size());
+
+  wgpu::TextureView               target     = createTarget(*context);
+  wgpu::RenderPassColorAttachment attachment = attach(target);
+  wgpu::RenderPassDescriptor      pass_desc  = {};
+  pass_desc.colorAttachmentCount             = 1;
+  pass_desc.colorAttachments                 = &attachment;
+  recorder.submit(pass_desc, *bundles);
+  context->blockOnSubmittedWork();
+
+  draws[7].pipeline = nullptr;
+  REQUIRE(!recorder.record(draws, layout).ok());
+}
+
+TEST_CASE("Parallel recorder handles draws that do not divide evenly",
+          "[render]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  wgpu::RenderPipeline           pipeline = rndr::createRenderPipeline(*context);
+  rndr::RenderTargetLayout       layout   = {{wgpu::TextureFormat::BGRA8Unorm}};
+
+  rndr::DrawCall                 draw     = {};
+  draw.pipeline                           = &pipeline;
+  draw.element_count                      = 3;
+
+  rndr::JobSystem                jobs;
+  rndr::ParallelRecorder::Config config;
+  config.thread_count         = 4;
+  config.min_draws_per_bundle = 1;
+  rndr::ParallelRecorder recorder(*context, jobs, config);
+
+  /* 5 draws over 4 threads: slices of 2, so only 3 of them hold any */
+  for (size_t count : {1, 5, 7, 9}) {
+    std::vector<rndr::DrawCall> draws(count, draw);
+    auto                        bundles = recorder.record(draws, layout);
+    REQUIRE(bundles.ok());
+    REQUIRE(!(*bundles).empty());
+    REQUIRE((*bundles).size() <= count);
+    for (const wgpu::RenderBundle &bundle : *bundles) {
+      REQUIRE(bundle);
+    }
+  }
+
+  REQUIRE(recorder.getStats().draws_recorded == 1 + 5 + 7 + 9);
+}
+
+TEST_CASE("Bundle cache re-records only stale entries", "[render]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  wgpu::RenderPipeline        pipeline = rndr::createRenderPipeline(*context);
+  rndr::RenderTargetLayout    layout   = {{wgpu::TextureFormat::BGRA8Unorm}};
+  rndr::DrawCall              draw     = {};
+  draw.pipeline                        = &pipeline;
+  draw.element_count                   = 3;
+  std::vector<rndr::DrawCall> draws(16, draw);
+
+  rndr::JobSystem             jobs;
+  rndr::ParallelRecorder      recorder(*context, jobs);
+  rndr::BundleCache           cache;
+
+  REQUIRE(cache.getOrRecord(recorder, 1, 0, draws, layout).ok());
+  REQUIRE(cache.getOrRecord(recorder, 1, 0, draws, layout).ok());
+  REQUIRE(cache.getStats().hits == 1);
+  REQUIRE(recorder.getStats().draws_recorded == draws.size());
+
+  REQUIRE(cache.getOrRecord(recorder, 1, 1, draws, layout).ok());
+  REQUIRE(cache.getStats().misses == 2);
+  REQUIRE(recorder.getStats().draws_recorded == 2 * draws.size());
+
+  cache.erase(1);
+  REQUIRE(cache.find(1, 1) == nullptr);
+  REQUIRE(cache.getStats().entries == 0);
+}
+
+TEST_CASE("Parallel recording scales with threads", "[.][benchmark]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  constexpr size_t draw_count = 50000;
+
+  wgpu::RenderPipeline            pipeline = rndr::createRenderPipeline(*context);
+  rndr::RenderTargetLayout        layout   = {{wgpu::TextureFormat::BGRA8Unorm}};
+  rndr::DrawCall                  draw     = {};
+  draw.pipeline                            = &pipeline;
+  draw.element_count                       = 3;
+  std::vector<rndr::DrawCall>     draws(draw_count, draw);
+
+  wgpu::TextureView               target     = createTarget(*context);
+  wgpu::RenderPassColorAttachment attachment = attach(target);
+  wgpu::RenderPassDescriptor      pass_desc  = {};
+  pass_desc.colorAttachmentCount             = 1;
+  pass_desc.colorAttachments                 = &attachment;
+
+  BENCHMARK("single pass encoder")
+  {
+    wgpu::CommandEncoder encoder = context->getDevice().CreateCommandEncoder();
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&pass_desc);
+    for (const rndr::DrawCall &d : draws) {
+      rndr::encode_draw(pass, d);
+    }
+    pass.End();
+    wgpu::CommandBuffer command_buffer = encoder.Finish();
+    context->getQueue().Submit(1, &command_buffer);
+    context->blockOnSubmittedWork();
+  };
+
+  for (uint32_t threads : {1u, 2u, 4u, 8u}) {
+    rndr::JobSystem::Config job_config;
+    job_config.worker_count = std::max(1u, threads - 1);
+    rndr::JobSystem                jobs(job_config);
+
+    rndr::ParallelRecorder::Config config;
+    config.thread_count = threads;
+    rndr::ParallelRecorder recorder(*context, jobs, config);
+    if (threads > 1 && !recorder.isMultithreaded()) {
+      break;
+    }
+
+    BENCHMARK(std::to_string(threads) + " recording threads")
+    {
+      auto bundles = recorder.record(draws, layout);
+      recorder.submit(pass_desc, *bundles);
+      context->blockOnSubmittedWork();
+    };
+  }
+}
@@ -0,0 +1,66 @@
+#include "rndr/render/render_queue.h"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <vector>
+
+TEST_CASE("Radix sort orders entries like a stable sort", "[render]")
+{
+  std::mt19937_64 rng(7);
+
+  for (size_t count : {size_t{0}, size_t{1}, size_t{100}, size_t{10000}}) {
+    std::vector<rndr::SortEntry> entries(count);
+    for (uint32_t i = 0; i < count; ++i) {
+      /* shared high bytes and duplicates exercise skipped passes */
+      entries[i] = {(uint64_t{0xab} << 56) | (rng() & 0xff00ff), i};
+    }
+
+    std::vector<rndr::SortEntry> expected = entries;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const rndr::SortEntry &a, const rndr::SortEntry &b) {
+                       return a.key < b.key;
+                     });
+
+    std::vector<rndr::SortEntry> scratch(count);
+    rndr::radix_sort(entries, scratch);
+
+    for (size_t i = 0; i < count; ++i) {
+      REQUIRE(entries[i].key == expected[i].key);
+      REQUIRE(entries[i].index == expected[i].index);
+    }
+  }
+}
+
+TEST_CASE("Render queue keys order passes before depth", "[render]")
+{
+  wgpu::RenderPipeline pipeline;
+  rndr::DrawCall       draw;
+  draw.pipeline = &pipeline;
+
+  rndr::RenderQueue queue;
+  REQUIRE(queue.makeKey(0, draw, 0.9f) < queue.makeKey(1, draw, 0.1f));
+  REQUIRE(queue.makeKey(2, draw, 0.1f) < queue.makeKey(2, draw, 0.2f));
+
+  /* out-of-range depths clamp rather than spill into other fields */
+  REQUIRE(queue.makeKey(0, draw, 5.f) < queue.makeKey(1, draw, -5.f));
+}
+
+TEST_CASE("Render queue returns draws sorted per pass", "[render]")
+{
+  wgpu::RenderPipeline pipeline;
+  rndr::RenderQueue    queue;
+  queue.begin();
+
+  for (uint32_t i = 0; i < 8; ++i) {
+    rndr::DrawCall draw;
+    draw.pipeline      = &pipeline;
+    draw.element_count = i;
+    queue.push(i % 2, draw, 1.f - i / 8.f);
+  }
+
+  auto draws = queue.getSortedDraws(1);
+  REQUIRE(draws.size() == 4);
+  REQUIRE(draws[0].element_count == 7);
+  REQUIRE(draws[3].element_count == 1);
+  REQUIRE(queue.getStats().queued == 8);
+}
@@ -0,0 +1,82 @@
+#include "rndr/render/render_thread.h"
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+struct TestFrame {
+  uint64_t              index     = 0;
+  std::vector<uint32_t> draw_list = {};
+};
+
+TEST_CASE("Render thread draws the frames the application submits",
+          "[render]")
+{
+  std::atomic<uint64_t>    last_drawn = 0;
+  std::atomic<bool>        in_order   = true;
+  std::thread::id          render_id  = {};
+
+  rndr::RenderThread<TestFrame> renderer([&](const TestFrame &frame) {
+    render_id = std::this_thread::get_id();
+    if (frame.index <= last_drawn.load()
+        || frame.draw_list.size() != frame.index % 7) {
+      in_order.store(false);
+    }
+    last_drawn.store(frame.index);
+    return ustd::result{};
+  });
+  renderer.start();
+  REQUIRE(renderer.isRunning());
+
+  constexpr uint64_t frame_count = 2000;
+  for (uint64_t i = 1; i <= frame_count; ++i) {
+    TestFrame &frame = renderer.beginFrame();
+    frame.index      = i;
+    frame.draw_list.assign(i % 7, 0);
+    renderer.submit();
+  }
+
+  /* the newest frame always gets drawn */
+  for (int i = 0; i < 5000 && last_drawn.load() != frame_count; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  renderer.stop();
+
+  REQUIRE(!renderer.isRunning());
+  REQUIRE(last_drawn.load() == frame_count);
+  REQUIRE(in_order.load());
+  REQUIRE(render_id != std::this_thread::get_id());
+
+  auto stats = renderer.getStats();
+  REQUIRE(stats.submitted == frame_count);
+  REQUIRE(stats.rendered + stats.dropped == frame_count);
+}
+
+TEST_CASE("Render thread stops on a failed frame", "[render]")
+{
+  rndr::RenderThread<int> renderer([](const int &frame) -> ustd::result {
+    if (frame == 3) {
+      return ustd::unexpected("Surface lost");
+    }
+    return {};
+  });
+  renderer.start();
+
+  for (int i = 1; i <= 3; ++i) {
+    renderer.beginFrame() = i;
+    renderer.submit();
+    /* give every frame a chance to be drawn */
+    for (int j = 0; j < 1000 && renderer.getStats().rendered < uint64_t(i)
+                    && renderer.isRunning();
+         ++j) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  for (int i = 0; i < 1000 && renderer.isRunning(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  REQUIRE(!renderer.isRunning());
+  REQUIRE(!renderer.getResult());
+}
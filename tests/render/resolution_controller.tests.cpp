@@ -0,0 +1,101 @@
+#include "rndr/render/resolution_controller.h"
+#include <catch2/catch_test_macros.hpp>
+
+static rndr::ResolutionController::Config controllerConfig()
+{
+  rndr::ResolutionController::Config config = {};
+  config.target_ms                          = 10.0;
+  config.min_scale                          = 0.5f;
+  config.max_scale                          = 1.f;
+  config.interval                           = 4;
+  config.headroom                           = 0.2;
+  config.max_step                           = 0.25f;
+  config.history                            = 6;
+  return config;
+}
+
+/* frames at a cost proportional to the pixel count at the current scale */
+static bool runFrames(rndr::ResolutionController &controller,
+                      double                      full_ms,
+                      uint32_t                    frames)
+{
+  bool changed = false;
+  for (uint32_t i = 0; i < frames; ++i) {
+    float scale = controller.getScale();
+    changed     = controller.addFrame(full_ms * scale * scale, 0.0) || changed;
+  }
+  return changed;
+}
+
+TEST_CASE("Resolution scale drops over budget and holds within it",
+          "[render]")
+{
+  rndr::ResolutionController controller(controllerConfig());
+  REQUIRE(controller.getScale() == 1.f);
+
+  /* adjustments only happen once per interval */
+  REQUIRE(!runFrames(controller, 16.0, 3));
+  REQUIRE(controller.getScale() == 1.f);
+  REQUIRE(runFrames(controller, 16.0, 1));
+
+  /* 16ms at full scale, aiming for 9ms: sqrt(9 / 16) = 0.75 */
+  REQUIRE(controller.getScale() == 0.75f);
+  REQUIRE(controller.getAdjustments() == 1);
+
+  /* 16 * 0.75^2 = 9ms, inside [8, 10], so it holds */
+  REQUIRE(!runFrames(controller, 16.0, 40));
+  REQUIRE(controller.getScale() == 0.75f);
+
+  auto [width, height] = controller.scaled(1280, 720);
+  REQUIRE(width == 960);
+  REQUIRE(height == 540);
+}
+
+TEST_CASE("Resolution scale steps and clamps", "[render]")
+{
+  rndr::ResolutionController controller(controllerConfig());
+
+  /* far over budget: by at most `max_step`, down to `min_scale` */
+  REQUIRE(runFrames(controller, 100.0, 4));
+  REQUIRE(controller.getScale() == 0.75f);
+  REQUIRE(runFrames(controller, 100.0, 4));
+  REQUIRE(controller.getScale() == 0.5f);
+  REQUIRE(!runFrames(controller, 100.0, 4));
+  REQUIRE(controller.getScale() == 0.5f);
+
+  /* cheap frames climb back to `max_scale` */
+  REQUIRE(runFrames(controller, 1.0, 8));
+  REQUIRE(controller.getScale() == 1.f);
+  REQUIRE(!runFrames(controller, 1.0, 8));
+
+  /* the CPU time is used only without a GPU time */
+  controller.reset(1.f);
+  for (int i = 0; i < 4; ++i) {
+    controller.addFrame(0.0, 20.0);
+  }
+  REQUIRE(controller.getScale() < 1.f);
+
+  controller.reset(0.1f);
+  REQUIRE(controller.getScale() == 0.5f);
+  REQUIRE(controller.scaled(1, 1) == std::pair<uint32_t, uint32_t>{1, 1});
+}
+
+TEST_CASE("Resolution controller keeps a timing history", "[render]")
+{
+  rndr::ResolutionController controller(controllerConfig());
+  REQUIRE(controller.getHistory().empty());
+
+  for (int i = 1; i <= 8; ++i) {
+    controller.addFrame(i, 2.0 * i);
+  }
+
+  /* the last `history` frames, oldest first */
+  auto history = controller.getHistory();
+  REQUIRE(history.size() == 6);
+  REQUIRE(history.front().gpu_ms == 3.0);
+  REQUIRE(history.front().cpu_ms == 6.0);
+  REQUIRE(history.back().gpu_ms == 8.0);
+  for (const auto &frame : history) {
+    REQUIRE(frame.scale == 1.f);
+  }
+}
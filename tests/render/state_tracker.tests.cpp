@@ -0,0 +1,89 @@
+#include "rndr/context.h"
+#include "rndr/render/render_queue.h"
+#include "rndr/utils/helpers.h"
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <memory>
+#include <vector>
+
+static wgpu::Buffer createIndexBuffer(rndr::Context &context)
+{
+  wgpu::BufferDescriptor buffer_desc = {};
+  buffer_desc.usage                  = wgpu::BufferUsage::Index;
+  buffer_desc.size                   = 3 * sizeof(uint32_t);
+  return context.getDevice().CreateBuffer(&buffer_desc);
+}
+
+using PassRecorder = std::function<void(const wgpu::RenderPassEncoder &)>;
+
+static void encodeOffscreen(rndr::Context &context, const PassRecorder &record)
+{
+  wgpu::TextureDescriptor texture_desc = {};
+  texture_desc.usage  = wgpu::TextureUsage::RenderAttachment;
+  texture_desc.format = wgpu::TextureFormat::BGRA8Unorm;
+  texture_desc.size   = {16, 16, 1};
+  wgpu::TextureView target
+      = context.getDevice().CreateTexture(&texture_desc).CreateView();
+
+  wgpu::RenderPassColorAttachment attachment = {};
+  attachment.view                            = target;
+  attachment.loadOp                          = wgpu::LoadOp::Clear;
+  attachment.storeOp                         = wgpu::StoreOp::Store;
+
+  wgpu::RenderPassDescriptor pass_desc       = {};
+  pass_desc.colorAttachmentCount             = 1;
+  pass_desc.colorAttachments                 = &attachment;
+
+  wgpu::CommandEncoder encoder = context.getDevice().CreateCommandEncoder();
+  wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&pass_desc);
+  record(pass);
+  pass.End();
+
+  wgpu::CommandBuffer command_buffer = encoder.Finish();
+  context.getQueue().Submit(1, &command_buffer);
+}
+
+TEST_CASE("Sorted render queue skips redundant state changes", "[render]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  wgpu::RenderPipeline pipelines[2] = {rndr::createRenderPipeline(*context),
+                                       rndr::createRenderPipeline(*context)};
+  wgpu::Buffer         indices[2]   = {createIndexBuffer(*context),
+                                       createIndexBuffer(*context)};
+
+  /* the worst case for submission order: every draw changes everything */
+  std::vector<rndr::DrawCall> draws(64);
+  for (size_t i = 0; i < draws.size(); ++i) {
+    draws[i].pipeline      = &pipelines[i % 2];
+    draws[i].index_buffer  = &indices[i / 2 % 2];
+    draws[i].element_count = 3;
+  }
+
+  rndr::StateTracker unsorted;
+  encodeOffscreen(*context, [&](const wgpu::RenderPassEncoder &pass) {
+    for (const rndr::DrawCall &draw : draws) {
+      unsorted.encode(pass, draw);
+    }
+  });
+  REQUIRE(unsorted.getCounts().pipelines == 64);
+
+  rndr::RenderQueue queue;
+  queue.begin();
+  for (const rndr::DrawCall &draw : draws) {
+    queue.push(0, draw);
+  }
+
+  encodeOffscreen(*context, [&](const wgpu::RenderPassEncoder &pass) {
+    queue.encode(pass, 0);
+  });
+
+  const auto &stats = queue.getStats();
+  REQUIRE(stats.state.draws == 64);
+  REQUIRE(stats.state.pipelines == 2);
+  REQUIRE(stats.state.index_buffers == 4);
+  REQUIRE(stats.state.skipped == 2 * 64 - 6);
+
+  context->blockOnSubmittedWork();
+}
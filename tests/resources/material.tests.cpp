@@ -0,0 +1,215 @@
+#include "rndr/context.h"
+#include "rndr/render/render_queue.h"
+#include "rndr/resources/material.h"
+#include "rndr/resources/resource_cache.h"
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+
+static const char *shader_source = R"(
+@group(0) @binding(0) var<uniform> view_projection: mat4x4f;
+@group(1) @binding(0) var<uniform> color: vec4f;
+
+@vertex
+fn vs_main(@builtin(vertex_index) index: u32) -> @builtin(position) vec4f {
+  let p = vec2f(f32(index % 2u), f32(index / 2u));
+  return view_projection * vec4f(p, 0.0, 1.0);
+}
+
+@fragment
+fn fs_main() -> @location(0) vec4f {
+  return color;
+}
+)";
+
+static wgpu::BindGroupLayoutEntry uniformEntry(wgpu::ShaderStage visibility,
+                                               uint64_t          size)
+{
+  wgpu::BindGroupLayoutEntry entry = {};
+  entry.binding                    = 0;
+  entry.visibility                 = visibility;
+  entry.buffer.type                = wgpu::BufferBindingType::Uniform;
+  entry.buffer.minBindingSize      = size;
+  return entry;
+}
+
+static wgpu::Buffer createUniform(rndr::Context &context, uint64_t size)
+{
+  wgpu::BufferDescriptor buffer_desc = {};
+  buffer_desc.usage = wgpu::BufferUsage::Uniform | wgpu::BufferUsage::CopyDst;
+  buffer_desc.size  = size;
+  return context.getDevice().CreateBuffer(&buffer_desc);
+}
+
+static rndr::Material::Config materialConfig()
+{
+  rndr::Material::Config config = {};
+  config.shader_source          = shader_source;
+  config.uses_mesh              = false;
+  config.frame_entries = {uniformEntry(wgpu::ShaderStage::Vertex, 64)};
+  config.material_entries
+      = {uniformEntry(wgpu::ShaderStage::Fragment, 16)};
+  return config;
+}
+
+TEST_CASE("Materials share interned layouts and cached bind groups",
+          "[resources]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::ResourceCache cache(*context);
+  rndr::Material      red(*context, cache, materialConfig());
+  rndr::Material      blue(*context, cache, materialConfig());
+  REQUIRE(red.initialize().ok());
+  REQUIRE(blue.initialize().ok());
+
+  for (uint32_t group : {rndr::frame_group, rndr::material_group}) {
+    REQUIRE(red.getBindGroupLayout(group).Get()
+            == blue.getBindGroupLayout(group).Get());
+  }
+  /* frame, material and the empty object layout */
+  REQUIRE(cache.getStats().layouts == 3);
+
+  wgpu::Buffer         red_color  = createUniform(*context, 16);
+  wgpu::Buffer         blue_color = createUniform(*context, 16);
+
+  wgpu::BindGroupEntry entry      = {};
+  entry.binding                   = 0;
+  entry.buffer                    = red_color;
+  entry.size                      = 16;
+  REQUIRE(red.setBindings({&entry, 1}).ok());
+  REQUIRE(blue.setBindings({&entry, 1}).ok());
+  REQUIRE(red.getBindGroup().Get() == blue.getBindGroup().Get());
+  REQUIRE(cache.getStats().group_hits == 1);
+
+  entry.buffer = blue_color;
+  REQUIRE(blue.setBindings({&entry, 1}).ok());
+  REQUIRE(red.getBindGroup().Get() != blue.getBindGroup().Get());
+  REQUIRE(!blue.setBindings({}).ok());
+}
+
+TEST_CASE("Draws only rebind the groups that change", "[resources]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::ResourceCache cache(*context);
+  rndr::Material      red(*context, cache, materialConfig());
+  rndr::Material      blue(*context, cache, materialConfig());
+  REQUIRE(red.initialize().ok());
+  REQUIRE(blue.initialize().ok());
+
+  wgpu::Buffer         camera     = createUniform(*context, 64);
+  wgpu::Buffer         red_color  = createUniform(*context, 16);
+  wgpu::Buffer         blue_color = createUniform(*context, 16);
+
+  wgpu::BindGroupEntry entry      = {};
+  entry.binding                   = 0;
+  entry.buffer                    = red_color;
+  REQUIRE(red.setBindings({&entry, 1}).ok());
+  entry.buffer = blue_color;
+  REQUIRE(blue.setBindings({&entry, 1}).ok());
+
+  /* one frame group serves both materials */
+  entry.buffer                 = camera;
+  const wgpu::BindGroup &frame = cache.getBindGroup(
+      red.getBindGroupLayout(rndr::frame_group), {&entry, 1});
+
+  rndr::RenderQueue queue;
+  queue.begin();
+  for (int i = 0; i < 16; ++i) {
+    rndr::DrawCall draw = {};
+    draw.element_count  = 3;
+    (i % 2 ? red : blue).apply(draw, frame);
+    queue.push(0, draw);
+  }
+
+  wgpu::TextureDescriptor texture_desc = {};
+  texture_desc.usage  = wgpu::TextureUsage::RenderAttachment;
+  texture_desc.format = wgpu::TextureFormat::BGRA8Unorm;
+  texture_desc.size   = {16, 16, 1};
+  wgpu::TextureView target
+      = context->getDevice().CreateTexture(&texture_desc).CreateView();
+
+  wgpu::RenderPassColorAttachment attachment = {};
+  attachment.view                            = target;
+  attachment.loadOp                          = wgpu::LoadOp::Clear;
+  attachment.storeOp                         = wgpu::StoreOp::Store;
+
+  wgpu::RenderPassDescriptor pass_desc       = {};
+  pass_desc.colorAttachmentCount             = 1;
+  pass_desc.colorAttachments                 = &attachment;
+
+  wgpu::CommandEncoder encoder = context->getDevice().CreateCommandEncoder();
+  wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&pass_desc);
+  queue.encode(pass, 0);
+  pass.End();
+
+  wgpu::CommandBuffer command_buffer = encoder.Finish();
+  context->getQueue().Submit(1, &command_buffer);
+  context->blockOnSubmittedWork();
+
+  /* the frame group once, then a material group per material */
+  REQUIRE(queue.getStats().state.pipelines == 2);
+  REQUIRE(queue.getStats().state.bind_groups == 3);
+}
+
+TEST_CASE("Material variants specialize override constants", "[resources]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::ResourceCache    cache(*context);
+  rndr::Material::Config config = {};
+  config.uses_mesh              = false;
+  config.features               = {"ALPHA_TEST", "TINT"};
+  config.shader_source          = R"(
+override ALPHA_TEST: bool = true;
+override TINT: bool = true;
+
+@vertex
+fn vs_main(@builtin(vertex_index) index: u32) -> @builtin(position) vec4f {
+  return vec4f(f32(index % 2u), f32(index / 2u), 0.0, 1.0);
+}
+
+@fragment
+fn fs_main(@builtin(position) position: vec4f) -> @location(0) vec4f {
+  var color = vec4f(1.0, 1.0, 1.0, fract(position.x * 0.1));
+  if (ALPHA_TEST && color.a < 0.5) {
+    discard;
+  }
+  if (TINT) {
+    color = color * vec4f(1.0, 0.5, 0.5, 1.0);
+  }
+  return color;
+}
+)";
+
+  rndr::Material material(*context, cache, config);
+  REQUIRE(material.initialize().ok());
+  REQUIRE(material.isCompiled(0));
+
+  uint32_t tinted = material.getVariant({"TINT"});
+  uint32_t both   = material.getVariant({"ALPHA_TEST", "TINT"});
+  REQUIRE(tinted == 2);
+  REQUIRE(both == 3);
+
+  REQUIRE(material.getPipeline(tinted).Get()
+          != material.getPipeline(0).Get());
+  REQUIRE(material.getPipeline(tinted).Get()
+          == material.getPipeline(tinted).Get());
+
+  /* the remaining variants compile in the background */
+  uint32_t variants[2] = {1, both};
+  material.precompile(variants);
+  for (int i = 0; i < 10000 && cache.getStats().pending > 0; ++i) {
+    context->processEvents();
+  }
+  REQUIRE(material.isCompiled(1));
+  REQUIRE(material.isCompiled(both));
+  REQUIRE(cache.getStats().pipelines == 4);
+
+  config.features = {"MISSING"};
+  rndr::Material broken(*context, cache, config);
+  REQUIRE(!broken.initialize().ok());
+}
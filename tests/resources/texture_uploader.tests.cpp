@@ -0,0 +1,271 @@
+#include "rndr/context.h"
+#include "rndr/memory/upload_ring.h"
+#include "rndr/resources/resource_cache.h"
+#include "rndr/resources/texture_uploader.h"
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* an opaque image whose red channel alternates between 0 and 255 */
+static rndr::ImageData stripes(uint32_t width, uint32_t height)
+{
+  rndr::ImageData image{width, height, {}};
+  image.pixels.resize(size_t{width} * height * 4);
+  for (uint32_t y = 0; y < height; ++y) {
+    for (uint32_t x = 0; x < width; ++x) {
+      uint8_t *texel = &image.pixels[(size_t{y} * width + x) * 4];
+      texel[0]       = x % 2 == 0 ? 0 : 255;
+      texel[1]       = 64;
+      texel[2]       = 0;
+      texel[3]       = 255;
+    }
+  }
+  return image;
+}
+
+/* blocking copy of one level, `bytes` per texel (or per 4 x 4 block) row */
+static std::vector<uint8_t> readLevel(rndr::Context       &context,
+                                      const wgpu::Texture &texture,
+                                      uint32_t             level,
+                                      wgpu::Extent3D       size,
+                                      uint32_t             row_bytes,
+                                      uint32_t             rows)
+{
+  const wgpu::Device    &device        = context.getDevice();
+  uint32_t               bytes_per_row = (row_bytes + 255) / 256 * 256;
+
+  wgpu::BufferDescriptor buffer_desc   = {};
+  buffer_desc.usage = wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::MapRead;
+  buffer_desc.size  = uint64_t{bytes_per_row} * rows;
+  wgpu::Buffer           readback = device.CreateBuffer(&buffer_desc);
+
+  wgpu::ImageCopyTexture src      = {};
+  src.texture                     = texture;
+  src.mipLevel                    = level;
+
+  wgpu::ImageCopyBuffer dst       = {};
+  dst.buffer                      = readback;
+  dst.layout.bytesPerRow          = bytes_per_row;
+  dst.layout.rowsPerImage         = rows;
+
+  wgpu::CommandEncoder encoder    = device.CreateCommandEncoder();
+  encoder.CopyTextureToBuffer(&src, &dst, &size);
+  wgpu::CommandBuffer commands = encoder.Finish();
+  context.getQueue().Submit(1, &commands);
+
+  std::vector<uint8_t> out(size_t{row_bytes} * rows);
+  wgpu::Future         map_future = readback.MapAsync(
+      wgpu::MapMode::Read, 0, buffer_desc.size,
+      wgpu::CallbackMode::AllowProcessEvents,
+      [&](wgpu::MapAsyncStatus status, const char *message) {
+        if (status == wgpu::MapAsyncStatus::Success) {
+          auto *mapped = static_cast<const uint8_t *>(
+              readback.GetConstMappedRange(0, buffer_desc.size));
+          for (uint32_t y = 0; y < rows; ++y) {
+            std::memcpy(out.data() + size_t{y} * row_bytes,
+                        mapped + size_t{y} * bytes_per_row, row_bytes);
+          }
+          readback.Unmap();
+        }
+      });
+  context.blockOnFuture(map_future);
+
+  return out;
+}
+
+TEST_CASE("Texture mips are filtered on the GPU", "[resources]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  context->setForceFallbackAdapter(true);
+  REQUIRE(context->initialize().ok());
+
+  rndr::ResourceCache   cache(*context);
+  rndr::UploadRing      uploads(*context);
+  rndr::TextureUploader uploader(*context, cache, uploads);
+  REQUIRE(uploader.initialize().ok());
+
+  rndr::TextureUploader::Config config;
+  config.compress = false;
+
+  auto linear     = uploader.create(stripes(64, 48), config);
+  config.srgb     = true;
+  auto srgb       = uploader.create(stripes(64, 48), config);
+  REQUIRE(linear.ok());
+  REQUIRE(srgb.ok());
+  REQUIRE(linear->mip_levels == 7);
+  REQUIRE(srgb->format == wgpu::TextureFormat::RGBA8UnormSrgb);
+
+  REQUIRE(uploader.submit().ok());
+  REQUIRE(uploader.getStats().levels_generated == 12);
+
+  /* the base level arrives untouched */
+  auto base = readLevel(*context, linear->texture, 0, {64, 48, 1}, 64 * 4, 48);
+  REQUIRE(base == stripes(64, 48).pixels);
+
+  /* every level below averages the stripes away */
+  for (uint32_t level = 1; level < 7; ++level) {
+    uint32_t width  = std::max(64u >> level, 1u);
+    uint32_t height = std::max(48u >> level, 1u);
+    auto     texels = readLevel(*context, linear->texture, level,
+                                {width, height, 1}, width * 4, height);
+    for (size_t i = 0; i < texels.size(); i += 4) {
+      REQUIRE(std::abs(int(texels[i]) - 128) <= 1);
+      REQUIRE(texels[i + 1] == 64);
+      REQUIRE(texels[i + 3] == 255);
+    }
+  }
+
+  /* half of full intensity in linear light is ~188 once encoded as sRGB */
+  auto texels = readLevel(*context, srgb->texture, 1, {32, 24, 1}, 32 * 4, 24);
+  REQUIRE(std::abs(int(texels[0]) - 188) <= 2);
+}
+
+TEST_CASE("Textures are BC1 compressed when the device supports it",
+          "[resources]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::ResourceCache   cache(*context);
+  rndr::UploadRing      uploads(*context);
+  rndr::TextureUploader uploader(*context, cache, uploads);
+  REQUIRE(uploader.initialize().ok());
+
+  rndr::ImageData red{16, 16, {}};
+  for (size_t i = 0; i < 16 * 16; ++i) {
+    red.pixels.insert(red.pixels.end(), {255, 0, 0, 255});
+  }
+
+  rndr::ImageData translucent = red;
+  translucent.pixels[3]       = 128;
+  REQUIRE(!uploader.canCompress(translucent, {}));
+  REQUIRE(!uploader.canCompress(stripes(18, 16), {}));
+
+  if (!context->hasFeature(wgpu::FeatureName::TextureCompressionBC)) {
+    WARN("TextureCompressionBC is unavailable, skipping");
+    return;
+  }
+
+  auto texture = uploader.create(red);
+  REQUIRE(texture.ok());
+  REQUIRE(texture->compressed);
+  REQUIRE(texture->format == wgpu::TextureFormat::BC1RGBAUnorm);
+  REQUIRE(uploader.submit().ok());
+  REQUIRE(uploader.getStats().levels_encoded == 5);
+
+  /* a solid block has equal endpoints of 565 red, and all indices 0 */
+  for (uint32_t level : {0u, 4u}) {
+    uint32_t blocks = std::max(4u >> level, 1u);
+    auto     data   = readLevel(*context, texture->texture, level,
+                                {blocks * 4, blocks * 4, 1}, blocks * 8, blocks);
+    uint32_t words[2];
+    std::memcpy(words, data.data(), sizeof(words));
+    REQUIRE(words[0] == 0xF800F800u);
+    REQUIRE(words[1] == 0u);
+  }
+}
+
+TEST_CASE("Texture uploader rejects malformed images", "[resources]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::ResourceCache   cache(*context);
+  rndr::UploadRing      uploads(*context);
+  rndr::TextureUploader uploader(*context, cache, uploads);
+  REQUIRE(uploader.initialize().ok());
+
+  REQUIRE(!uploader.create(rndr::ImageData{}).ok());
+  REQUIRE(!uploader.create(rndr::ImageData{4, 4, std::vector<uint8_t>(15)}).ok());
+  REQUIRE(rndr::TextureUploader::mipLevelCount(1, 1) == 1);
+  REQUIRE(rndr::TextureUploader::mipLevelCount(1024, 3) == 11);
+}
+
+/* the reference the GPU path replaces: a full box-filtered chain on the CPU */
+static size_t cpuMipChain(const rndr::ImageData &image)
+{
+  rndr::ImageData level = image;
+  size_t          bytes = 0;
+  while (level.width > 1 || level.height > 1) {
+    rndr::ImageData next{std::max(level.width / 2, 1u),
+                         std::max(level.height / 2, 1u), {}};
+    next.pixels.resize(size_t{next.width} * next.height * 4);
+    for (uint32_t y = 0; y < next.height; ++y) {
+      for (uint32_t x = 0; x < next.width; ++x) {
+        for (uint32_t c = 0; c < 4; ++c) {
+          uint32_t sum = 0;
+          for (uint32_t i = 0; i < 4; ++i) {
+            uint32_t sx = std::min(2 * x + i % 2, level.width - 1);
+            uint32_t sy = std::min(2 * y + i / 2, level.height - 1);
+            sum += level.pixels[(size_t{sy} * level.width + sx) * 4 + c];
+          }
+          next.pixels[(size_t{y} * next.width + x) * 4 + c] = sum / 4;
+        }
+      }
+    }
+    bytes += next.pixels.size();
+    level  = std::move(next);
+  }
+  return bytes;
+}
+
+TEST_CASE("Texture upload and mip generation per resolution", "[.][benchmark]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  rndr::ResourceCache   cache(*context);
+  rndr::UploadRing      uploads(*context);
+  rndr::TextureUploader uploader(*context, cache, uploads);
+  REQUIRE(uploader.initialize().ok());
+
+  bool compression = context->hasFeature(wgpu::FeatureName::TextureCompressionBC);
+
+  for (uint32_t size : {256u, 1024u, 2048u}) {
+    rndr::ImageData image  = stripes(size, size);
+    std::string     suffix = std::to_string(size) + "x" + std::to_string(size);
+
+    rndr::TextureUploader::Config upload_only;
+    upload_only.generate_mips = false;
+    upload_only.compress      = false;
+
+    rndr::TextureUploader::Config mips;
+    mips.compress = false;
+
+    BENCHMARK("Upload, " + suffix)
+    {
+      auto texture = uploader.create(image, upload_only);
+      REQUIRE(uploader.submit().ok());
+      context->blockOnSubmittedWork();
+      return texture.ok();
+    };
+
+    BENCHMARK("Upload and GPU mips, " + suffix)
+    {
+      auto texture = uploader.create(image, mips);
+      REQUIRE(uploader.submit().ok());
+      context->blockOnSubmittedWork();
+      return texture.ok();
+    };
+
+    BENCHMARK("CPU mips, " + suffix)
+    {
+      return cpuMipChain(image);
+    };
+
+    if (compression) {
+      BENCHMARK("Upload, GPU mips and BC1, " + suffix)
+      {
+        auto texture = uploader.create(image);
+        REQUIRE(uploader.submit().ok());
+        context->blockOnSubmittedWork();
+        return texture.ok();
+      };
+    }
+  }
+}
@@ -2,6 +2,8 @@
 #include "ustd/expected.h"
 #include <catch2/catch_test_macros.hpp>
 #include <memory>
+#include <thread>
+#include <vector>
 
 /** TODO unhide this test when we are able to initialize without a surface */
 TEST_CASE("Application initializes and destructs without fault", "[sanity]")
@@ -13,3 +15,102 @@ TEST_CASE("Application initializes and destructs without fault", "[sanity]")
   REQUIRE(!context->getSurface());
   REQUIRE(context->isInitialized());
 }
+
+TEST_CASE("Application initializes in two phases", "[sanity]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->beginInitialize().ok());
+  REQUIRE(!context->beginInitialize().ok());
+
+  /* the device is requested in the background, the caller may work here */
+
+  REQUIRE(context->finishInitialize().ok());
+  REQUIRE(context->isInitialized());
+  REQUIRE(!context->finishInitialize().ok());
+
+  const auto &timings = context->getInitTimings();
+  REQUIRE(timings.device_ms > 0.0);
+  REQUIRE(timings.total_ms >= timings.device_wait_ms);
+  REQUIRE(timings.window_ms == 0.0);
+}
+
+TEST_CASE("Context accounts for the memory it creates", "[sanity]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  auto &tracker = context->getMemoryTracker();
+  auto  before  = tracker.snapshot();
+
+  {
+    wgpu::BufferDescriptor buffer_desc = {};
+    buffer_desc.usage = wgpu::BufferUsage::Uniform | wgpu::BufferUsage::CopyDst;
+    buffer_desc.size  = 256;
+    rndr::TrackedBuffer buffer
+        = context->createBuffer(buffer_desc, rndr::MemoryCategory::Uniform);
+
+    wgpu::TextureDescriptor texture_desc = {};
+    texture_desc.size                    = {64, 64, 1};
+    texture_desc.format                  = wgpu::TextureFormat::RGBA8Unorm;
+    texture_desc.usage = wgpu::TextureUsage::TextureBinding;
+    rndr::TrackedTexture texture = context->createTexture(texture_desc);
+
+    /* copies share one allocation */
+    rndr::TrackedTexture copy    = texture;
+    REQUIRE(copy.getTrackedBytes() == 64 * 64 * 4);
+
+    auto during = tracker.snapshot();
+    REQUIRE(during.getLive(rndr::MemoryCategory::Uniform)
+            == before.getLive(rndr::MemoryCategory::Uniform) + 256);
+    REQUIRE(during.getLive(rndr::MemoryCategory::Texture)
+            == before.getLive(rndr::MemoryCategory::Texture) + 64 * 64 * 4);
+  }
+
+  REQUIRE(tracker.snapshot().total_live == before.total_live);
+}
+
+TEST_CASE("Context destroys released resources once the GPU is done",
+          "[sanity]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  auto                  &tracker     = context->getMemoryTracker();
+  uint64_t               live_before = tracker.snapshot().total_live;
+
+  wgpu::BufferDescriptor buffer_desc = {};
+  buffer_desc.usage = wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::CopySrc;
+  buffer_desc.size  = 1024;
+  rndr::TrackedBuffer buffer
+      = context->createBuffer(buffer_desc, rndr::MemoryCategory::Other);
+
+  std::vector<uint8_t> data(1024, 7);
+  context->getQueue().WriteBuffer(buffer, 0, data.data(), data.size());
+
+  context->destroyLater(std::move(buffer));
+  context->destroyLater(rndr::TrackedBuffer{});
+  REQUIRE(context->getPendingDestroyCount() == 1);
+  /* still accounted for while the write may be in flight */
+  REQUIRE(tracker.snapshot().total_live == live_before + 1024);
+
+  for (int i = 0; i < 1000 && context->getPendingDestroyCount() > 0; ++i) {
+    context->processEvents();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  REQUIRE(context->getPendingDestroyCount() == 0);
+  REQUIRE(tracker.snapshot().total_live == live_before);
+}
+
+TEST_CASE("Context without a surface has no frames to present", "[sanity]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  /* the format pipelines target when nothing was negotiated */
+  REQUIRE(context->getSurfaceFormat() == wgpu::TextureFormat::BGRA8Unorm);
+  REQUIRE(context->getPresentMode() == wgpu::PresentMode::Fifo);
+
+  REQUIRE(!context->acquireFrame());
+  context->present();
+  REQUIRE(context->getPresentStats().frames == 0);
+}
@@ -0,0 +1,46 @@
+#include "rndr/utils/helpers.h"
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+TEST_CASE("Surface formats are negotiated in order of preference", "[sanity]")
+{
+  using wgpu::TextureFormat;
+  std::vector<TextureFormat> preferred = {TextureFormat::BGRA8Unorm,
+                                          TextureFormat::RGBA8Unorm};
+
+  std::vector<TextureFormat> supported = {TextureFormat::RGBA8UnormSrgb,
+                                          TextureFormat::RGBA8Unorm,
+                                          TextureFormat::BGRA8Unorm};
+  REQUIRE(rndr::helpers::choose_surface_format(preferred, supported)
+          == TextureFormat::BGRA8Unorm);
+
+  /* none preferred: the surface's own preference, its first format */
+  supported = {TextureFormat::RGBA16Float, TextureFormat::RGB10A2Unorm};
+  REQUIRE(rndr::helpers::choose_surface_format(preferred, supported)
+          == TextureFormat::RGBA16Float);
+
+  REQUIRE(rndr::helpers::choose_surface_format(preferred, {})
+          == TextureFormat::Undefined);
+}
+
+TEST_CASE("Present modes fall back to Fifo", "[sanity]")
+{
+  using wgpu::PresentMode;
+  std::vector<PresentMode> low_latency = {PresentMode::Mailbox,
+                                          PresentMode::Immediate,
+                                          PresentMode::Fifo};
+
+  std::vector<PresentMode> supported   = {PresentMode::Fifo,
+                                          PresentMode::Immediate};
+  REQUIRE(rndr::helpers::choose_present_mode(low_latency, supported)
+          == PresentMode::Immediate);
+
+  supported.push_back(PresentMode::Mailbox);
+  REQUIRE(rndr::helpers::choose_present_mode(low_latency, supported)
+          == PresentMode::Mailbox);
+
+  supported = {PresentMode::Fifo};
+  REQUIRE(rndr::helpers::choose_present_mode(low_latency, supported)
+          == PresentMode::Fifo);
+  REQUIRE(rndr::helpers::choose_present_mode({}, {}) == PresentMode::Fifo);
+}
@@ -0,0 +1,159 @@
+#include "helpers/fixtures.h"
+#include "rndr/math/ops.h"
+#include "rndr/scene/scene.h"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <random>
+
+using rndr::Scene;
+using test_helpers::translation;
+
+static float worldX(const Scene &scene, Scene::Node node)
+{
+  return scene.getWorld(node).get_data()[12];
+}
+
+TEST_CASE("Scene propagates transforms down the hierarchy", "[scene]")
+{
+  Scene       scene;
+  Scene::Node root  = scene.addNode(translation(1.f, 0.f, 0.f));
+  Scene::Node child = scene.addNode(translation(2.f, 0.f, 0.f), root);
+  Scene::Node leaf  = scene.addNode(translation(4.f, 0.f, 0.f), child);
+  Scene::Node other = scene.addNode(translation(8.f, 0.f, 0.f));
+
+  scene.update();
+  REQUIRE(scene.getStats().updated == 4);
+  REQUIRE(worldX(scene, root) == 1.f);
+  REQUIRE(worldX(scene, child) == 3.f);
+  REQUIRE(worldX(scene, leaf) == 7.f);
+  REQUIRE(worldX(scene, other) == 8.f);
+  REQUIRE(scene.getDepth(leaf) == 2);
+  REQUIRE(scene.getParent(leaf) == child);
+
+  /* only the changed subtree is recomputed */
+  scene.setLocal(child, translation(16.f, 0.f, 0.f));
+  scene.update();
+  REQUIRE(scene.getStats().updated == 2);
+  REQUIRE(worldX(scene, child) == 17.f);
+  REQUIRE(worldX(scene, leaf) == 21.f);
+  REQUIRE(worldX(scene, other) == 8.f);
+
+  scene.update();
+  REQUIRE(scene.getStats().updated == 0);
+}
+
+TEST_CASE("Scene keeps node handles when it reorders by depth", "[scene]")
+{
+  Scene       scene;
+  Scene::Node root  = scene.addNode(translation(1.f, 0.f, 0.f));
+  Scene::Node child = scene.addNode(translation(2.f, 0.f, 0.f), root);
+  Scene::Node leaf  = scene.addNode(translation(4.f, 0.f, 0.f), child);
+  scene.update();
+  REQUIRE(scene.getStats().sorts == 0);
+
+  /* shallower than the last node, so the arrays are sorted again */
+  Scene::Node late  = scene.addNode(translation(8.f, 0.f, 0.f), root);
+  Scene::Node other = scene.addNode(translation(32.f, 0.f, 0.f));
+  scene.update();
+  REQUIRE(scene.getStats().sorts == 1);
+  REQUIRE(scene.getStats().updated == 5);
+
+  REQUIRE(worldX(scene, leaf) == 7.f);
+  REQUIRE(worldX(scene, late) == 9.f);
+  REQUIRE(worldX(scene, other) == 32.f);
+  REQUIRE(scene.getParent(leaf) == child);
+
+  /* parents precede their children, and instances index the worlds */
+  for (Scene::Node node : {root, child, leaf, late, other}) {
+    Scene::Node parent = scene.getParent(node);
+    if (parent != Scene::no_parent) {
+      REQUIRE(scene.getInstance(parent) < scene.getInstance(node));
+    }
+    REQUIRE(scene.getWorlds()[scene.getInstance(node)]
+            == scene.getWorld(node));
+  }
+
+  scene.setLocal(root, translation(0.f, 0.f, 0.f));
+  scene.update();
+  REQUIRE(worldX(scene, leaf) == 6.f);
+  REQUIRE(worldX(scene, late) == 8.f);
+}
+
+/* a wide tree of `count` nodes, each parented to a random earlier one */
+static void buildScene(Scene &scene, size_t count)
+{
+  std::mt19937 rng(7);
+  scene.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    Scene::Node parent = Scene::no_parent;
+    if (i >= 64) {
+      parent = std::uniform_int_distribution<Scene::Node>(0, i - 1)(rng);
+    }
+    scene.addNode(translation(1.f, 0.f, 0.f), parent);
+  }
+  scene.update();
+}
+
+TEST_CASE("Scene incremental updates match a full recompute", "[scene]")
+{
+  constexpr size_t node_count = 2000;
+
+  Scene            scene;
+  buildScene(scene, node_count);
+
+  std::mt19937     rng(3);
+  for (int round = 0; round < 8; ++round) {
+    for (int i = 0; i < 50; ++i) {
+      auto  node = std::uniform_int_distribution<Scene::Node>(
+          0, node_count - 1)(rng);
+      float x    = std::uniform_int_distribution<int>(-8, 8)(rng);
+      scene.setLocal(node, translation(x, 1.f, 0.f));
+    }
+    scene.update();
+
+    for (Scene::Node node = 0; node < node_count; ++node) {
+      Scene::Node      parent = scene.getParent(node);
+      Scene::Transform expected
+          = parent == Scene::no_parent
+                ? scene.getLocal(node)
+                : rndr::math::compose_column_major(scene.getWorld(parent),
+                                                   scene.getLocal(node));
+      REQUIRE(scene.getWorld(node) == expected);
+    }
+  }
+}
+
+TEST_CASE("Scene update benchmarks", "[.][benchmark]")
+{
+  constexpr size_t node_count = 100000;
+
+  Scene            scene;
+  buildScene(scene, node_count);
+
+  std::vector<Scene::Node> nodes(node_count);
+  for (size_t i = 0; i < node_count; ++i) {
+    nodes[i] = static_cast<Scene::Node>(i);
+  }
+  std::shuffle(nodes.begin(), nodes.end(), std::mt19937(11));
+
+  const Scene::Transform local = translation(1.f, 0.f, 0.f);
+
+  BENCHMARK("100k nodes, 1% dirty")
+  {
+    for (size_t i = 0; i < node_count / 100; ++i) {
+      scene.setLocal(nodes[i], local);
+    }
+    scene.update();
+    return scene.getStats().updated;
+  };
+
+  BENCHMARK("100k nodes, 100% dirty")
+  {
+    for (Scene::Node node : nodes) {
+      scene.setLocal(node, local);
+    }
+    scene.update();
+    return scene.getStats().updated;
+  };
+}
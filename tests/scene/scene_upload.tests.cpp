@@ -0,0 +1,62 @@
+#include "helpers/fixtures.h"
+#include "helpers/readback.h"
+#include "rndr/context.h"
+#include "rndr/memory/upload_ring.h"
+#include "rndr/scene/scene.h"
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+
+using rndr::Scene;
+using test_helpers::translation;
+
+TEST_CASE("Scene uploads only the changed world transforms", "[scene]")
+{
+  auto context = std::make_unique<rndr::Context>(false);
+  REQUIRE(context->initialize().ok());
+
+  constexpr size_t node_count = 64;
+
+  Scene            scene;
+  Scene::Node      root = scene.addNode(translation(1.f));
+  for (size_t i = 1; i < node_count; ++i) {
+    scene.addNode(translation(static_cast<float>(i)), root);
+  }
+
+  wgpu::BufferDescriptor buffer_desc = {};
+  buffer_desc.usage = wgpu::BufferUsage::Storage | wgpu::BufferUsage::CopyDst
+                      | wgpu::BufferUsage::CopySrc;
+  buffer_desc.size = node_count * sizeof(Scene::Transform);
+  wgpu::Buffer     instances = context->getDevice().CreateBuffer(&buffer_desc);
+  rndr::UploadRing ring(*context);
+
+  scene.update();
+  REQUIRE(scene.upload(ring, instances).ok());
+  REQUIRE(scene.getStats().uploaded == node_count);
+  REQUIRE(scene.getStats().copies == 1);
+  REQUIRE(ring.submit().ok());
+
+  /* one leaf changes, so only its transform goes out */
+  Scene::Node leaf = 40;
+  scene.setLocal(leaf, translation(100.f));
+  scene.update();
+  REQUIRE(scene.upload(ring, instances).ok());
+  REQUIRE(scene.getStats().uploaded == 1);
+  REQUIRE(ring.submit().ok());
+
+  auto worlds = test_helpers::readBack<Scene::Transform>(*context, instances,
+                                                         node_count);
+  for (Scene::Node node = 0; node < node_count; ++node) {
+    REQUIRE(worlds[scene.getInstance(node)] == scene.getWorld(node));
+  }
+  REQUIRE(worlds[scene.getInstance(leaf)].get_data()[12] == 101.f);
+
+  /* nothing changed, nothing to upload */
+  scene.update();
+  REQUIRE(scene.upload(ring, instances).ok());
+  REQUIRE(scene.getStats().copies == 0);
+
+  /* a buffer too small for every instance is rejected */
+  buffer_desc.size  = sizeof(Scene::Transform);
+  wgpu::Buffer tiny = context->getDevice().CreateBuffer(&buffer_desc);
+  REQUIRE(!scene.upload(ring, tiny).ok());
+}